@@ -18,17 +18,26 @@
  */
 
 #include "Golay24128.h"
+#include "FECTables.h"
 #include "Hamming.h"
+#include "CPUFeatures.h"
 #include "AMBEFEC.h"
 #include "Utils.h"
+#include "Log.h"
 
 #include <cstdio>
 #include <cassert>
+#include <cstring>
+#include <cstdint>
 
-const unsigned char BIT_MASK_TABLE[] = {0x80U, 0x40U, 0x20U, 0x10U, 0x08U, 0x04U, 0x02U, 0x01U};
+#if defined(CPU_HAS_BMI2_CODE)
+#include <immintrin.h>
+#endif
 
-#define WRITE_BIT(p,i,b) p[(i)>>3] = (b) ? (p[(i)>>3] | BIT_MASK_TABLE[(i)&7]) : (p[(i)>>3] & ~BIT_MASK_TABLE[(i)&7])
-#define READ_BIT(p,i)    (p[(i)>>3] & BIT_MASK_TABLE[(i)&7])
+#if defined(USE_DMR) || defined(USE_YSF) || defined(USE_NXDN)
+// The most AMBE frames decoded together, a whole number of DMR bursts
+const unsigned int AMBE_BATCH = 15U;
+#endif
 
 const unsigned int PRNG_TABLE[] = {
 	0x42CC47U, 0x19D6FEU, 0x304729U, 0x6B2CD0U, 0x60BF47U, 0x39650EU, 0x7354F1U, 0xEACF60U, 0x819C9FU, 0xDE25CEU, 
@@ -443,31 +452,51 @@ const unsigned int PRNG_TABLE[] = {
 	0xF9A540U, 0x205ED9U, 0x634EB6U, 0x5A9567U, 0x11A6D8U, 0x0B3F09U};
 
 #if defined(USE_DMR) || defined(USE_YSF) || defined(USE_NXDN)
-const unsigned int DMR_A_TABLE[] = { 0U,  4U,  8U, 12U, 16U, 20U, 24U, 28U, 32U, 36U, 40U, 44U,
-									48U, 52U, 56U, 60U, 64U, 68U,  1U,  5U,  9U, 13U, 17U, 21U};
-const unsigned int DMR_B_TABLE[] = {25U, 29U, 33U, 37U, 41U, 45U, 49U, 53U, 57U, 61U, 65U, 69U,
-									 2U,  6U, 10U, 14U, 18U, 22U, 26U, 30U, 34U, 38U, 42U};
-const unsigned int DMR_C_TABLE[] = {46U, 50U, 54U, 58U, 62U, 66U, 70U,  3U,  7U, 11U, 15U, 19U,
-									23U, 27U, 31U, 35U, 39U, 43U, 47U, 51U, 55U, 59U, 63U, 67U, 71U};
+/*
+ * A DMR AMBE frame is 72 bits interleaved four ways, bit n belongs to phase n % 4.
+ * Phase 0 then the top of phase 1 form A, the rest of phase 1 and the top of phase 2
+ * form B, and the rest of phase 2 and phase 3 form C.
+ *
+ * Each byte holds two bits of every phase, which the gather table spreads into 16-bit
+ * fields, phase 0 highest, so that the bytes can be shifted in one after another. The
+ * scatter table gives the bits of the byte for each phase's two bits.
+ */
+constexpr CPhaseTables<4U, 1U, 16U> DMR_PHASES;
+
+static_assert(DMR_PHASES.verify(), "The DMR AMBE phase tables don't invert each other");
+static_assert(DMR_PHASES.m_gather[0U][0x10U] == 0x0000000000000002ULL && DMR_PHASES.m_gather[0U][0xFFU] == 0x0003000300030003ULL, "DMR AMBE gather table mismatch");
+static_assert(DMR_PHASES.m_scatter[0U][0x01U] == 0x08U && DMR_PHASES.m_scatter[3U][0x02U] == 0x10U, "DMR AMBE scatter table mismatch");
 #endif
 #if defined(USE_DSTAR)
-const unsigned int DSTAR_A_TABLE[] = {0U,  6U, 12U, 18U, 24U, 30U, 36U, 42U, 48U, 54U, 60U, 66U,
-									  1U,  7U, 13U, 19U, 25U, 31U, 37U, 43U, 49U, 55U, 61U, 67U};
-const unsigned int DSTAR_B_TABLE[] = {2U,  8U, 14U, 20U, 26U, 32U, 38U, 44U, 50U, 56U, 62U, 68U,
-									  3U,  9U, 15U, 21U, 27U, 33U, 39U, 45U, 51U, 57U, 63U, 69U};
-const unsigned int DSTAR_C_TABLE[] = {4U, 10U, 16U, 22U, 28U, 34U, 40U, 46U, 52U, 58U, 64U, 70U,
-									  5U, 11U, 17U, 23U, 29U, 35U, 41U, 47U, 53U, 59U, 65U, 71U};
+/*
+ * A D-Star AMBE frame is 72 bits interleaved six ways, bit n belongs to phase n % 6,
+ * and A, B and C are phases 0+1, 2+3 and 4+5. Every three bytes hold four bits of each
+ * phase, so the gather table is indexed by the byte's place within its group of three
+ * and gives a nibble for each phase in 8-bit fields, phase 0 highest. The scatter table
+ * gives the 24-bit group for each phase's nibble.
+ */
+constexpr CPhaseTables<6U, 3U, 8U> DSTAR_PHASES;
+
+static_assert(DSTAR_PHASES.verify(), "The D-Star AMBE phase tables don't invert each other");
+static_assert(DSTAR_PHASES.m_gather[0U][0x01U] == 0x000400000000ULL && DSTAR_PHASES.m_gather[0U][0x04U] == 0x000000000008ULL, "D-Star AMBE gather table mismatch");
+static_assert(DSTAR_PHASES.m_scatter[0U][0x01U] == 0x000020U && DSTAR_PHASES.m_scatter[5U][0x0FU] == 0x041041U, "D-Star AMBE scatter table mismatch");
 #endif
 
 #if defined(USE_YSF) || defined(USE_P25)
-const unsigned int IMBE_INTERLEAVE[] = {
-	0,  7, 12, 19, 24, 31, 36, 43, 48, 55, 60, 67, 72, 79, 84, 91,  96, 103, 108, 115, 120, 127, 132, 139,
-	1,  6, 13, 18, 25, 30, 37, 42, 49, 54, 61, 66, 73, 78, 85, 90,  97, 102, 109, 114, 121, 126, 133, 138,
-	2,  9, 14, 21, 26, 33, 38, 45, 50, 57, 62, 69, 74, 81, 86, 93,  98, 105, 110, 117, 122, 129, 134, 141,
-	3,  8, 15, 20, 27, 32, 39, 44, 51, 56, 63, 68, 75, 80, 87, 92,  99, 104, 111, 116, 123, 128, 135, 140,
-	4, 11, 16, 23, 28, 35, 40, 47, 52, 59, 64, 71, 76, 83, 88, 95, 100, 107, 112, 119, 124, 131, 136, 143,
-	5, 10, 17, 22, 29, 34, 41, 46, 53, 58, 65, 70, 77, 82, 89, 94, 101, 106, 113, 118, 125, 130, 137, 142
-};
+/*
+ * The position in the de-interleaved IMBE frame of each transmitted bit. Taking the frame as
+ * six rows of 24 bits, every 12 bits sent hold the next bit of each row in turn and then the
+ * one after it with the rows swapped in pairs, and every 24 bits sent move four bits along.
+ */
+constexpr CInterleaveTables<unsigned int, 144U> IMBE_DEINTERLEAVE([](unsigned int n) {
+	unsigned int col = (n / 24U) * 4U + ((n % 24U) / 12U) * 2U;
+	unsigned int row = n % 12U;
+
+	return (row < 6U) ? (row * 24U + col) : (((row - 6U) ^ 1U) * 24U + col + 1U);
+});
+
+static_assert(IMBE_DEINTERLEAVE.verify(144U), "The IMBE interleave isn't a permutation of the frame");
+static_assert(IMBE_DEINTERLEAVE.m_place[6U] == 25U && IMBE_DEINTERLEAVE.m_place[23U] == 99U && IMBE_DEINTERLEAVE.m_place[143U] == 119U, "IMBE interleave mismatch");
 #endif
 
 CAMBEFEC::CAMBEFEC()
@@ -480,104 +509,58 @@ CAMBEFEC::~CAMBEFEC()
 
 #if defined(USE_DMR) || defined(USE_YSF) || defined(USE_NXDN)
 unsigned int CAMBEFEC::regenerateDMR(unsigned char* bytes) const
+{
+	return regenerateDMR(bytes, 1U, 33U);
+}
+
+unsigned int CAMBEFEC::regenerateDMR(unsigned char* bytes, unsigned int count, unsigned int stride, unsigned int* errors) const
 {
 	assert(bytes != nullptr);
 
-	unsigned int a1 = 0U, a2 = 0U, a3 = 0U;
-	unsigned int MASK = 0x800000U;
-	for (unsigned int i = 0U; i < 24U; i++, MASK >>= 1) {
-		unsigned int a1Pos = DMR_A_TABLE[i];
-		unsigned int a2Pos = a1Pos + 72U;
-		if (a2Pos >= 108U)
-			a2Pos += 48U;
-		unsigned int a3Pos = a1Pos + 192U;
-
-		if (READ_BIT(bytes, a1Pos))
-			a1 |= MASK;
-		if (READ_BIT(bytes, a2Pos))
-			a2 |= MASK;
-		if (READ_BIT(bytes, a3Pos))
-			a3 |= MASK;
-	}
+	unsigned int a[AMBE_BATCH], b[AMBE_BATCH], c[AMBE_BATCH], errs[AMBE_BATCH];
+	unsigned int total = 0U;
 
-	unsigned int b1 = 0U, b2 = 0U, b3 = 0U;
-	MASK = 0x400000U;
-	for (unsigned int i = 0U; i < 23U; i++, MASK >>= 1) {
-		unsigned int b1Pos = DMR_B_TABLE[i];
-		unsigned int b2Pos = b1Pos + 72U;
-		if (b2Pos >= 108U)
-			b2Pos += 48U;
-		unsigned int b3Pos = b1Pos + 192U;
-
-		if (READ_BIT(bytes, b1Pos))
-			b1 |= MASK;
-		if (READ_BIT(bytes, b2Pos))
-			b2 |= MASK;
-		if (READ_BIT(bytes, b3Pos))
-			b3 |= MASK;
-	}
+	for (unsigned int n = 0U; n < count; n += AMBE_BATCH / 3U) {
+		unsigned int batch = ((count - n) < (AMBE_BATCH / 3U)) ? (count - n) : (AMBE_BATCH / 3U);
 
-	unsigned int c1 = 0U, c2 = 0U, c3 = 0U;
-	MASK = 0x1000000U;
-	for (unsigned int i = 0U; i < 25U; i++, MASK >>= 1) {
-		unsigned int c1Pos = DMR_C_TABLE[i];
-		unsigned int c2Pos = c1Pos + 72U;
-		if (c2Pos >= 108U)
-			c2Pos += 48U;
-		unsigned int c3Pos = c1Pos + 192U;
-
-		if (READ_BIT(bytes, c1Pos))
-			c1 |= MASK;
-		if (READ_BIT(bytes, c2Pos))
-			c2 |= MASK;
-		if (READ_BIT(bytes, c3Pos))
-			c3 |= MASK;
-	}
+		for (unsigned int i = 0U; i < batch; i++) {
+			const unsigned char* burst = bytes + (n + i) * stride;
 
-	unsigned int errors = regenerateDMR(a1, b1, c1);
-	errors += regenerateDMR(a2, b2, c2);
-	errors += regenerateDMR(a3, b3, c3);
-
-	MASK = 0x800000U;
-	for (unsigned int i = 0U; i < 24U; i++, MASK >>= 1) {
-		unsigned int a1Pos = DMR_A_TABLE[i];
-		unsigned int a2Pos = a1Pos + 72U;
-		if (a2Pos >= 108U)
-			a2Pos += 48U;
-		unsigned int a3Pos = a1Pos + 192U;
-
-		WRITE_BIT(bytes, a1Pos, a1 & MASK);
-		WRITE_BIT(bytes, a2Pos, a2 & MASK);
-		WRITE_BIT(bytes, a3Pos, a3 & MASK);
-	}
+			// The second AMBE frame is split by the 48 bits of sync or EMB in the middle of the burst
+			unsigned char frame2[9U];
+			::memcpy(frame2 + 0U, burst + 9U, 4U);
+			frame2[4U] = (burst[13U] & 0xF0U) | (burst[19U] & 0x0FU);
+			::memcpy(frame2 + 5U, burst + 20U, 4U);
 
-	MASK = 0x400000U;
-	for (unsigned int i = 0U; i < 23U; i++, MASK >>= 1) {
-		unsigned int b1Pos = DMR_B_TABLE[i];
-		unsigned int b2Pos = b1Pos + 72U;
-		if (b2Pos >= 108U)
-			b2Pos += 48U;
-		unsigned int b3Pos = b1Pos + 192U;
-
-		WRITE_BIT(bytes, b1Pos, b1 & MASK);
-		WRITE_BIT(bytes, b2Pos, b2 & MASK);
-		WRITE_BIT(bytes, b3Pos, b3 & MASK);
-	}
+			gatherDMR(burst + 0U, a[i * 3U + 0U], b[i * 3U + 0U], c[i * 3U + 0U]);
+			gatherDMR(frame2,     a[i * 3U + 1U], b[i * 3U + 1U], c[i * 3U + 1U]);
+			gatherDMR(burst + 24U, a[i * 3U + 2U], b[i * 3U + 2U], c[i * 3U + 2U]);
+		}
+
+		regenerateDMR(a, b, c, errs, batch * 3U);
+
+		for (unsigned int i = 0U; i < batch; i++) {
+			unsigned char* burst = bytes + (n + i) * stride;
+
+			scatterDMR(burst + 0U, a[i * 3U + 0U], b[i * 3U + 0U], c[i * 3U + 0U]);
+
+			unsigned char frame2[9U];
+			scatterDMR(frame2, a[i * 3U + 1U], b[i * 3U + 1U], c[i * 3U + 1U]);
+			::memcpy(burst + 9U, frame2 + 0U, 4U);
+			burst[13U] = (burst[13U] & 0x0FU) | (frame2[4U] & 0xF0U);
+			burst[19U] = (burst[19U] & 0xF0U) | (frame2[4U] & 0x0FU);
+			::memcpy(burst + 20U, frame2 + 5U, 4U);
+
+			scatterDMR(burst + 24U, a[i * 3U + 2U], b[i * 3U + 2U], c[i * 3U + 2U]);
 
-	MASK = 0x1000000U;
-	for (unsigned int i = 0U; i < 25U; i++, MASK >>= 1) {
-		unsigned int c1Pos = DMR_C_TABLE[i];
-		unsigned int c2Pos = c1Pos + 72U;
-		if (c2Pos >= 108U)
-			c2Pos += 48U;
-		unsigned int c3Pos = c1Pos + 192U;
-
-		WRITE_BIT(bytes, c1Pos, c1 & MASK);
-		WRITE_BIT(bytes, c2Pos, c2 & MASK);
-		WRITE_BIT(bytes, c3Pos, c3 & MASK);
+			unsigned int e = errs[i * 3U + 0U] + errs[i * 3U + 1U] + errs[i * 3U + 2U];
+			if (errors != nullptr)
+				errors[n + i] = e;
+			total += e;
+		}
 	}
 
-	return errors;
+	return total;
 }
 #endif
 
@@ -586,30 +569,12 @@ unsigned int CAMBEFEC::regenerateDStar(unsigned char* bytes) const
 {
 	assert(bytes != nullptr);
 
-	unsigned int a = 0U;
-	unsigned int b = 0U;
-	unsigned int c = 0U;
-
-	unsigned int MASK = 0x800000U;
-	for (unsigned int i = 0U; i < 24U; i++) {
-		if (READ_BIT(bytes, DSTAR_A_TABLE[i]))
-			a |= MASK;
-		if (READ_BIT(bytes, DSTAR_B_TABLE[i]))
-			b |= MASK;
-		if (READ_BIT(bytes, DSTAR_C_TABLE[i]))
-			c |= MASK;
-		MASK >>= 1;
-	}
+	unsigned int a, b, c;
+	gatherDStar(bytes, a, b, c);
 
 	unsigned int errors = regenerateDStar(a, b);
 
-	MASK = 0x800000U;
-	for (unsigned int i = 0U; i < 24U; i++) {
-		WRITE_BIT(bytes, DSTAR_A_TABLE[i], a & MASK);
-		WRITE_BIT(bytes, DSTAR_B_TABLE[i], b & MASK);
-		WRITE_BIT(bytes, DSTAR_C_TABLE[i], c & MASK);
-		MASK >>= 1;
-	}
+	scatterDStar(bytes, a, b, c);
 
 	return errors;
 }
@@ -618,53 +583,34 @@ unsigned int CAMBEFEC::regenerateDStar(unsigned char* bytes) const
 #if defined(USE_YSF) || defined(USE_NXDN)
 unsigned int CAMBEFEC::regenerateYSFDN(unsigned char* bytes) const
 {
-	assert(bytes != nullptr);
+	return regenerateYSFDN(bytes, 1U, 9U);
+}
 
-	unsigned int a = 0U;
-	unsigned int MASK = 0x800000U;
-	for (unsigned int i = 0U; i < 24U; i++, MASK >>= 1) {
-		unsigned int aPos = DMR_A_TABLE[i];
-		if (READ_BIT(bytes, aPos))
-			a |= MASK;
-	}
+unsigned int CAMBEFEC::regenerateYSFDN(unsigned char* bytes, unsigned int count, unsigned int stride, unsigned int* errors) const
+{
+	assert(bytes != nullptr);
 
-	unsigned int b = 0U;
-	MASK = 0x400000U;
-	for (unsigned int i = 0U; i < 23U; i++, MASK >>= 1) {
-		unsigned int bPos = DMR_B_TABLE[i];
-		if (READ_BIT(bytes, bPos))
-			b |= MASK;
-	}
+	unsigned int a[AMBE_BATCH], b[AMBE_BATCH], c[AMBE_BATCH], errs[AMBE_BATCH];
+	unsigned int total = 0U;
 
-	unsigned int c = 0U;
-	MASK = 0x1000000U;
-	for (unsigned int i = 0U; i < 25U; i++, MASK >>= 1) {
-		unsigned int cPos = DMR_C_TABLE[i];
-		if (READ_BIT(bytes, cPos))
-			c |= MASK;
-	}
+	for (unsigned int n = 0U; n < count; n += AMBE_BATCH) {
+		unsigned int batch = ((count - n) < AMBE_BATCH) ? (count - n) : AMBE_BATCH;
 
-	unsigned int errors = regenerateDMR(a, b, c);
+		for (unsigned int i = 0U; i < batch; i++)
+			gatherDMR(bytes + (n + i) * stride, a[i], b[i], c[i]);
 
-	MASK = 0x800000U;
-	for (unsigned int i = 0U; i < 24U; i++, MASK >>= 1) {
-		unsigned int aPos = DMR_A_TABLE[i];
-		WRITE_BIT(bytes, aPos, a & MASK);
-	}
+		regenerateDMR(a, b, c, errs, batch);
 
-	MASK = 0x400000U;
-	for (unsigned int i = 0U; i < 23U; i++, MASK >>= 1) {
-		unsigned int bPos = DMR_B_TABLE[i];
-		WRITE_BIT(bytes, bPos, b & MASK);
-	}
+		for (unsigned int i = 0U; i < batch; i++) {
+			scatterDMR(bytes + (n + i) * stride, a[i], b[i], c[i]);
 
-	MASK = 0x1000000U;
-	for (unsigned int i = 0U; i < 25U; i++, MASK >>= 1) {
-		unsigned int cPos = DMR_C_TABLE[i];
-		WRITE_BIT(bytes, cPos, c & MASK);
+			if (errors != nullptr)
+				errors[n + i] = errs[i];
+			total += errs[i];
+		}
 	}
 
-	return errors;
+	return total;
 }
 #endif
 
@@ -676,10 +622,12 @@ unsigned int CAMBEFEC::regenerateIMBE(unsigned char* bytes) const
 	bool orig[144U];
 	bool temp[144U];
 
-	// De-interleave
-	for (unsigned int i = 0U; i < 144U; i++) {
-		unsigned int n = IMBE_INTERLEAVE[i];
-		orig[i] = temp[i] = READ_BIT(bytes, n);
+	// De-interleave, a byte at a time
+	for (unsigned int i = 0U; i < 18U; i++) {
+		const unsigned int* pos = IMBE_DEINTERLEAVE.m_place + i * 8U;
+		unsigned int v = bytes[i];
+		for (unsigned int j = 0U; j < 8U; j++, v <<= 1)
+			orig[pos[j]] = temp[pos[j]] = (v & 0x80U) == 0x80U;
 	}
 
 	// now ..
@@ -717,8 +665,8 @@ unsigned int CAMBEFEC::regenerateIMBE(unsigned char* bytes) const
 	for (unsigned int i = 0U; i < 23U; i++)
 		g1 = (g1 << 1) | (bit[i] ? 0x01U : 0x00U);
 	unsigned int c0data = CGolay24128::decode23127(g1);
-	unsigned int g2 = CGolay24128::encode23127(c0data);
-	for (int i = 23; i >= 0; i--) {
+	unsigned int g2 = CGolay24128::encode23127(c0data) >> 1;
+	for (int i = 22; i >= 0; i--) {
 		bit[i] = (g2 & 0x01U) == 0x01U;
 		g2 >>= 1;
 	}
@@ -737,41 +685,24 @@ unsigned int CAMBEFEC::regenerateIMBE(unsigned char* bytes) const
 	for (unsigned int i = 0U; i < 114U; i++)
 		temp[i + 23U] ^= prn[i];
 
-	// c1
-	g1 = 0U;
-	for (unsigned int i = 0U; i < 23U; i++)
-		g1 = (g1 << 1) | (bit[i] ? 0x01U : 0x00U);
-	unsigned int c1data = CGolay24128::decode23127(g1);
-	g2 = CGolay24128::encode23127(c1data);
-	for (int i = 23; i >= 0; i--) {
-		bit[i] = (g2 & 0x01U) == 0x01U;
-		g2 >>= 1;
+	// c1, c2 and c3 don't depend on each other so they're decoded together
+	unsigned int g[3U], cdata[3U];
+	for (unsigned int n = 0U; n < 3U; n++) {
+		g[n] = 0U;
+		for (unsigned int i = 0U; i < 23U; i++)
+			g[n] = (g[n] << 1) | (bit[n * 23U + i] ? 0x01U : 0x00U);
 	}
-	bit += 23U;
 
-	// c2
-	g1 = 0;
-	for (unsigned int i = 0U; i < 23U; i++)
-		g1 = (g1 << 1) | (bit[i] ? 0x01U : 0x00U);
-	unsigned int c2data = CGolay24128::decode23127(g1);
-	g2 = CGolay24128::encode23127(c2data);
-	for (int i = 23; i >= 0; i--) {
-		bit[i] = (g2 & 0x01U) == 0x01U;
-		g2 >>= 1;
-	}
-	bit += 23U;
+	CGolay24128::decode23127(g, cdata, nullptr, 3U);
 
-	// c3
-	g1 = 0U;
-	for (unsigned int i = 0U; i < 23U; i++)
-		g1 = (g1 << 1) | (bit[i] ? 0x01U : 0x00U);
-	unsigned int c3data = CGolay24128::decode23127(g1);
-	g2 = CGolay24128::encode23127(c3data);
-	for (int i = 23; i >= 0; i--) {
-		bit[i] = (g2 & 0x01U) == 0x01U;
-		g2 >>= 1;
+	for (unsigned int n = 0U; n < 3U; n++) {
+		g2 = CGolay24128::encode23127(cdata[n]) >> 1;
+		for (int i = 22; i >= 0; i--) {
+			bit[n * 23U + i] = (g2 & 0x01U) == 0x01U;
+			g2 >>= 1;
+		}
 	}
-	bit += 23U;
+	bit += 69U;
 
 	// c4
 	CHamming::decode15113_1(bit);
@@ -794,10 +725,13 @@ unsigned int CAMBEFEC::regenerateIMBE(unsigned char* bytes) const
 			errors++;
 	}
 
-	// Interleave
-	for (unsigned int i = 0U; i < 144U; i++) {
-		unsigned int n = IMBE_INTERLEAVE[i];
-		WRITE_BIT(bytes, n, temp[i]);
+	// Interleave, every bit of the frame is rewritten so whole bytes can be stored
+	for (unsigned int i = 0U; i < 18U; i++) {
+		const unsigned int* pos = IMBE_DEINTERLEAVE.m_place + i * 8U;
+		unsigned int v = 0U;
+		for (unsigned int j = 0U; j < 8U; j++)
+			v = (v << 1) | (temp[pos[j]] ? 0x01U : 0x00U);
+		bytes[i] = v;
 	}
 
 	return errors;
@@ -840,46 +774,256 @@ unsigned int CAMBEFEC::regenerateDStar(unsigned int& a, unsigned int& b) const
 #endif
 
 #if defined(USE_DMR) || defined(USE_YSF) || defined(USE_NXDN)
-unsigned int CAMBEFEC::regenerateDMR(unsigned int& a, unsigned int& b, unsigned int& c) const
+void CAMBEFEC::regenerateDMR(unsigned int* a, unsigned int* b, unsigned int* c, unsigned int* errors, unsigned int count) const
 {
-	unsigned int orig_a = a;
-	unsigned int orig_b = b;
+	assert(count <= AMBE_BATCH);
 
-	unsigned int data;
-	bool valid = CGolay24128::decode24128(a, data);
+	unsigned int data[AMBE_BATCH], datb[AMBE_BATCH], orig_b[AMBE_BATCH], p[AMBE_BATCH];
+	bool valid[AMBE_BATCH];
 
-	a = CGolay24128::encode24128(data);
+	// The B words are whitened by the data of the A words, so all the A words are decoded first
+	CGolay24128::decode24128(a, data, valid, nullptr, count);
 
-	// The PRNG
-	unsigned int p = PRNG_TABLE[data] >> 1;
+	for (unsigned int i = 0U; i < count; i++) {
+		// The PRNG
+		p[i] = PRNG_TABLE[data[i]] >> 1;
 
-	b ^= p;
+		orig_b[i] = b[i];
+		b[i] ^= p[i];
+	}
 
-	unsigned int datb = CGolay24128::decode23127(b);
+	CGolay24128::decode23127(b, datb, nullptr, count);
 
-	b = CGolay24128::encode23127(datb) >> 1;
+	for (unsigned int i = 0U; i < count; i++) {
+		unsigned int orig_a = a[i];
 
-	b ^= p;
+		a[i] = CGolay24128::encode24128(data[i]);
+		b[i] = (CGolay24128::encode23127(datb[i]) >> 1) ^ p[i];
+
+		if (!valid[i]) {
+			a[i] = 0xF00292U;
+			b[i] = 0x0E0B20U;
+			c[i] = 0x000000U;
+			errors[i] = 10U;		// An invalid A block gives an error count of 10
+			continue;
+		}
+
+		unsigned int v = a[i] ^ orig_a;
+		unsigned int errsA = CUtils::countBits(v);
 
-	if (!valid) {
-		a = 0xF00292U;
-		b = 0x0E0B20U;
-		c = 0x000000U;
-		return 10U;		// An invalid A block gives an error count of 10
+		v = b[i] ^ orig_b[i];
+		unsigned int errsB = CUtils::countBits(v);
+
+		if (errsA >= 4U || ((errsA + errsB) >= 6U && errsA >= 2U)) {
+			a[i] = 0xF00292U;
+			b[i] = 0x0E0B20U;
+			c[i] = 0x000000U;
+		}
+
+		errors[i] = errsA + errsB;
 	}
+}
+#endif
 
-	unsigned int v = a ^ orig_a;
-	unsigned int errsA = CUtils::countBits(v);
+#if defined(USE_DMR) || defined(USE_YSF) || defined(USE_NXDN)
+// The four 18-bit phases of a DMR AMBE frame, each taken from every fourth bit
+static void gatherDMRTable(const unsigned char* in, unsigned int* ph)
+{
+	// Eight bits of each phase from the first four bytes, ten from the last five
+	uint64_t hi = 0U;
+	for (unsigned int i = 0U; i < 4U; i++)
+		hi = (hi << 2) | DMR_PHASES.m_gather[0U][in[i]];
+
+	uint64_t lo = 0U;
+	for (unsigned int i = 4U; i < 9U; i++)
+		lo = (lo << 2) | DMR_PHASES.m_gather[0U][in[i]];
+
+	ph[0U] = (unsigned int)((((hi >> 48) & 0xFFU) << 10) | ((lo >> 48) & 0x3FFU));
+	ph[1U] = (unsigned int)((((hi >> 32) & 0xFFU) << 10) | ((lo >> 32) & 0x3FFU));
+	ph[2U] = (unsigned int)((((hi >> 16) & 0xFFU) << 10) | ((lo >> 16) & 0x3FFU));
+	ph[3U] = (unsigned int)((((hi >> 0)  & 0xFFU) << 10) | ((lo >> 0)  & 0x3FFU));
+}
 
-	v = b ^ orig_b;
-	unsigned int errsB = CUtils::countBits(v);
+static void scatterDMRTable(unsigned char* out, const unsigned int* ph)
+{
+	for (unsigned int i = 0U; i < 9U; i++) {
+		unsigned int shift = 16U - i * 2U;
+		out[i] = (unsigned char)(DMR_PHASES.m_scatter[0U][(ph[0U] >> shift) & 0x03U] | DMR_PHASES.m_scatter[1U][(ph[1U] >> shift) & 0x03U] |
+					 DMR_PHASES.m_scatter[2U][(ph[2U] >> shift) & 0x03U] | DMR_PHASES.m_scatter[3U][(ph[3U] >> shift) & 0x03U]);
+	}
+}
+
+#if defined(CPU_HAS_BMI2_CODE)
+CPU_TARGET_BMI2 static void gatherDMRBMI2(const unsigned char* in, unsigned int* ph)
+{
+	uint64_t hi = 0U;
+	for (unsigned int i = 0U; i < 8U; i++)
+		hi = (hi << 8) | in[i];
+	unsigned int lo = in[8U];
+
+	ph[0U] = (unsigned int)(_pext_u64(hi, 0x8888888888888888ULL) << 2) | _pext_u32(lo, 0x88U);
+	ph[1U] = (unsigned int)(_pext_u64(hi, 0x4444444444444444ULL) << 2) | _pext_u32(lo, 0x44U);
+	ph[2U] = (unsigned int)(_pext_u64(hi, 0x2222222222222222ULL) << 2) | _pext_u32(lo, 0x22U);
+	ph[3U] = (unsigned int)(_pext_u64(hi, 0x1111111111111111ULL) << 2) | _pext_u32(lo, 0x11U);
+}
+
+CPU_TARGET_BMI2 static void scatterDMRBMI2(unsigned char* out, const unsigned int* ph)
+{
+	uint64_t hi = _pdep_u64(ph[0U] >> 2, 0x8888888888888888ULL) | _pdep_u64(ph[1U] >> 2, 0x4444444444444444ULL) |
+		      _pdep_u64(ph[2U] >> 2, 0x2222222222222222ULL) | _pdep_u64(ph[3U] >> 2, 0x1111111111111111ULL);
+	for (unsigned int i = 0U; i < 8U; i++)
+		out[i] = (unsigned char)(hi >> (56U - i * 8U));
+
+	out[8U] = (unsigned char)(_pdep_u32(ph[0U] & 0x03U, 0x88U) | _pdep_u32(ph[1U] & 0x03U, 0x44U) | _pdep_u32(ph[2U] & 0x03U, 0x22U) | _pdep_u32(ph[3U] & 0x03U, 0x11U));
+}
+#endif
 
-	if (errsA >= 4U || ((errsA + errsB) >= 6U && errsA >= 2U)) {
-		a = 0xF00292U;
-		b = 0x0E0B20U;
-		c = 0x000000U;
+static void (*gatherDMRPhases)(const unsigned char* in, unsigned int* ph) = gatherDMRTable;
+static void (*scatterDMRPhases)(unsigned char* out, const unsigned int* ph) = scatterDMRTable;
+
+void CAMBEFEC::gatherDMR(const unsigned char* in, unsigned int& a, unsigned int& b, unsigned int& c) const
+{
+	assert(in != nullptr);
+
+	unsigned int ph[4U];
+	gatherDMRPhases(in, ph);
+
+	a = (ph[0U] << 6) | (ph[1U] >> 12);
+	b = ((ph[1U] & 0xFFFU) << 11) | (ph[2U] >> 7);
+	c = ((ph[2U] & 0x7FU) << 18) | ph[3U];
+}
+
+void CAMBEFEC::scatterDMR(unsigned char* out, unsigned int a, unsigned int b, unsigned int c) const
+{
+	assert(out != nullptr);
+
+	unsigned int ph[4U];
+	ph[0U] = a >> 6;
+	ph[1U] = ((a & 0x3FU) << 12) | (b >> 11);
+	ph[2U] = ((b & 0x7FFU) << 7) | (c >> 18);
+	ph[3U] = c & 0x3FFFFU;
+
+	scatterDMRPhases(out, ph);
+}
+#endif
+
+#if defined(USE_DSTAR)
+// The six 12-bit phases of a D-Star AMBE frame, each taken from every sixth bit
+static void gatherDStarTable(const unsigned char* in, unsigned int* ph)
+{
+	// Two groups of three bytes fill the 8-bit fields, the third group is combined separately
+	uint64_t acc = 0U;
+	for (unsigned int i = 0U; i < 6U; i += 3U)
+		acc = (acc << 4) | DSTAR_PHASES.m_gather[0U][in[i + 0U]] | DSTAR_PHASES.m_gather[1U][in[i + 1U]] | DSTAR_PHASES.m_gather[2U][in[i + 2U]];
+
+	uint64_t last = DSTAR_PHASES.m_gather[0U][in[6U]] | DSTAR_PHASES.m_gather[1U][in[7U]] | DSTAR_PHASES.m_gather[2U][in[8U]];
+
+	for (unsigned int i = 0U; i < 6U; i++) {
+		unsigned int shift = 40U - i * 8U;
+		ph[i] = (unsigned int)((((acc >> shift) & 0xFFU) << 4) | ((last >> shift) & 0x0FU));
 	}
+}
 
-	return errsA + errsB;
+static void scatterDStarTable(unsigned char* out, const unsigned int* ph)
+{
+	for (unsigned int i = 0U; i < 3U; i++) {
+		unsigned int shift = 8U - i * 4U;
+		unsigned int v = DSTAR_PHASES.m_scatter[0U][(ph[0U] >> shift) & 0x0FU] | DSTAR_PHASES.m_scatter[1U][(ph[1U] >> shift) & 0x0FU] |
+				 DSTAR_PHASES.m_scatter[2U][(ph[2U] >> shift) & 0x0FU] | DSTAR_PHASES.m_scatter[3U][(ph[3U] >> shift) & 0x0FU] |
+				 DSTAR_PHASES.m_scatter[4U][(ph[4U] >> shift) & 0x0FU] | DSTAR_PHASES.m_scatter[5U][(ph[5U] >> shift) & 0x0FU];
+
+		out[i * 3U + 0U] = (v >> 16) & 0xFFU;
+		out[i * 3U + 1U] = (v >> 8)  & 0xFFU;
+		out[i * 3U + 2U] = (v >> 0)  & 0xFFU;
+	}
+}
+
+#if defined(CPU_HAS_BMI2_CODE)
+CPU_TARGET_BMI2 static void gatherDStarBMI2(const unsigned char* in, unsigned int* ph)
+{
+	uint64_t hi = 0U;
+	for (unsigned int i = 0U; i < 8U; i++)
+		hi = (hi << 8) | in[i];
+	unsigned int lo = in[8U];
+
+	ph[0U] = (unsigned int)(_pext_u64(hi, 0x8208208208208208ULL) << 1) | _pext_u32(lo, 0x20U);
+	ph[1U] = (unsigned int)(_pext_u64(hi, 0x4104104104104104ULL) << 1) | _pext_u32(lo, 0x10U);
+	ph[2U] = (unsigned int)(_pext_u64(hi, 0x2082082082082082ULL) << 1) | _pext_u32(lo, 0x08U);
+	ph[3U] = (unsigned int)(_pext_u64(hi, 0x1041041041041041ULL) << 1) | _pext_u32(lo, 0x04U);
+	ph[4U] = (unsigned int)(_pext_u64(hi, 0x0820820820820820ULL) << 2) | _pext_u32(lo, 0x82U);
+	ph[5U] = (unsigned int)(_pext_u64(hi, 0x0410410410410410ULL) << 2) | _pext_u32(lo, 0x41U);
+}
+
+CPU_TARGET_BMI2 static void scatterDStarBMI2(unsigned char* out, const unsigned int* ph)
+{
+	uint64_t hi = _pdep_u64(ph[0U] >> 1, 0x8208208208208208ULL) | _pdep_u64(ph[1U] >> 1, 0x4104104104104104ULL) |
+		      _pdep_u64(ph[2U] >> 1, 0x2082082082082082ULL) | _pdep_u64(ph[3U] >> 1, 0x1041041041041041ULL) |
+		      _pdep_u64(ph[4U] >> 2, 0x0820820820820820ULL) | _pdep_u64(ph[5U] >> 2, 0x0410410410410410ULL);
+	for (unsigned int i = 0U; i < 8U; i++)
+		out[i] = (unsigned char)(hi >> (56U - i * 8U));
+
+	out[8U] = (unsigned char)(_pdep_u32(ph[0U] & 0x01U, 0x20U) | _pdep_u32(ph[1U] & 0x01U, 0x10U) | _pdep_u32(ph[2U] & 0x01U, 0x08U) |
+				  _pdep_u32(ph[3U] & 0x01U, 0x04U) | _pdep_u32(ph[4U] & 0x03U, 0x82U) | _pdep_u32(ph[5U] & 0x03U, 0x41U));
+}
+#endif
+
+static void (*gatherDStarPhases)(const unsigned char* in, unsigned int* ph) = gatherDStarTable;
+static void (*scatterDStarPhases)(unsigned char* out, const unsigned int* ph) = scatterDStarTable;
+
+void CAMBEFEC::gatherDStar(const unsigned char* in, unsigned int& a, unsigned int& b, unsigned int& c) const
+{
+	assert(in != nullptr);
+
+	unsigned int ph[6U];
+	gatherDStarPhases(in, ph);
+
+	a = (ph[0U] << 12) | ph[1U];
+	b = (ph[2U] << 12) | ph[3U];
+	c = (ph[4U] << 12) | ph[5U];
+}
+
+void CAMBEFEC::scatterDStar(unsigned char* out, unsigned int a, unsigned int b, unsigned int c) const
+{
+	assert(out != nullptr);
+
+	unsigned int ph[6U];
+	ph[0U] = (a >> 12) & 0xFFFU;
+	ph[1U] = a & 0xFFFU;
+	ph[2U] = (b >> 12) & 0xFFFU;
+	ph[3U] = b & 0xFFFU;
+	ph[4U] = (c >> 12) & 0xFFFU;
+	ph[5U] = c & 0xFFFU;
+
+	scatterDStarPhases(out, ph);
+}
+#endif
+
+#if defined(USE_DMR) || defined(USE_DSTAR) || defined(USE_YSF) || defined(USE_NXDN)
+void CAMBEFEC::init()
+{
+#if defined(CPU_HAS_BMI2_CODE)
+	if (CCPUFeatures::has(CPUF_BMI2)) {
+#if defined(USE_DMR) || defined(USE_YSF) || defined(USE_NXDN)
+		gatherDMRPhases  = gatherDMRBMI2;
+		scatterDMRPhases = scatterDMRBMI2;
+#endif
+#if defined(USE_DSTAR)
+		gatherDStarPhases  = gatherDStarBMI2;
+		scatterDStarPhases = scatterDStarBMI2;
+#endif
+		LogInfo("    AMBE FEC: BMI2");
+		return;
+	}
+#endif
+
+#if defined(USE_DMR) || defined(USE_YSF) || defined(USE_NXDN)
+	gatherDMRPhases  = gatherDMRTable;
+	scatterDMRPhases = scatterDMRTable;
+#endif
+#if defined(USE_DSTAR)
+	gatherDStarPhases  = gatherDStarTable;
+	scatterDStarPhases = scatterDStarTable;
+#endif
+	LogInfo("    AMBE FEC: portable");
 }
 #endif
@@ -26,8 +26,18 @@ public:
 	CAMBEFEC();
 	~CAMBEFEC();
 
+#if defined(USE_DMR) || defined(USE_DSTAR) || defined(USE_YSF) || defined(USE_NXDN)
+	// Choose the fastest bit gathering that the CPU supports, after CCPUFeatures::init()
+	static void init();
+#endif
+
 #if defined(USE_DMR) || defined(USE_YSF) || defined(USE_NXDN)
 	unsigned int regenerateDMR(unsigned char* bytes) const;
+
+	// Regenerate a number of bursts, each stride bytes after the last, with their AMBE frames
+	// decoded together. The error count of each burst is optionally returned, and the total is
+	// returned as for a single burst.
+	unsigned int regenerateDMR(unsigned char* bytes, unsigned int count, unsigned int stride, unsigned int* errors = nullptr) const;
 #endif
 
 #if defined(USE_DSTAR)
@@ -36,6 +46,9 @@ public:
 
 #if defined(USE_YSF) || defined(USE_NXDN)
 	unsigned int regenerateYSFDN(unsigned char* bytes) const;
+
+	// As above for a number of AMBE frames, each stride bytes after the last
+	unsigned int regenerateYSFDN(unsigned char* bytes, unsigned int count, unsigned int stride, unsigned int* errors = nullptr) const;
 #endif
 
 #if defined(USE_YSF) || defined(USE_P25)
@@ -47,7 +60,14 @@ private:
 	unsigned int regenerateDStar(unsigned int& a, unsigned int& b) const;
 #endif
 #if defined(USE_DMR) || defined(USE_YSF) || defined(USE_NXDN)
-	unsigned int regenerateDMR(unsigned int& a, unsigned int& b,unsigned int& c) const;
+	void regenerateDMR(unsigned int* a, unsigned int* b, unsigned int* c, unsigned int* errors, unsigned int count) const;
+
+	void gatherDMR(const unsigned char* in, unsigned int& a, unsigned int& b, unsigned int& c) const;
+	void scatterDMR(unsigned char* out, unsigned int a, unsigned int b, unsigned int c) const;
+#endif
+#if defined(USE_DSTAR)
+	void gatherDStar(const unsigned char* in, unsigned int& a, unsigned int& b, unsigned int& c) const;
+	void scatterDStar(unsigned char* out, unsigned int a, unsigned int b, unsigned int c) const;
 #endif
 };
 
@@ -69,6 +69,7 @@
 *
 */
 
+#include "FECTables.h"
 #include "BCH.h"
 
 #if defined(USE_P25)
@@ -76,6 +77,7 @@
 #include <cmath>
 #include <cstdio>
 #include <cassert>
+#include <cstring>
 
 const unsigned char BIT_MASK_TABLE[] = { 0x80U, 0x40U, 0x20U, 0x10U, 0x08U, 0x04U, 0x02U, 0x01U };
 
@@ -85,9 +87,95 @@ const unsigned char BIT_MASK_TABLE[] = { 0x80U, 0x40U, 0x20U, 0x10U, 0x08U, 0x04
 const int length = 63;
 const int k = 16;
 
-const int g[] = {1, 1, 0,  0, 1, 1,  0, 1, 1,  0, 0, 1,  0, 0, 1,  1, 0, 0,  0, 0, 1,  0, 1, 1,
+constexpr int g[] = {1, 1, 0,  0, 1, 1,  0, 1, 1,  0, 0, 1,  0, 0, 1,  1, 0, 0,  0, 0, 1,  0, 1, 1,
 				 1, 1, 0,  1, 1, 1,  0, 1, 0,  0, 1, 1,  1, 0, 1,  1, 0, 0,  1, 0, 1,  0, 1, 1};
 
+// The number of errors that the code can correct
+const unsigned int BCH_T = 11U;
+
+// The field of g(x), which has alpha^1 to alpha^22 as its roots
+constexpr CGaloisTables<6U> BCH_GF(0x61U);
+
+constexpr bool bchHasRoots()
+{
+	for (unsigned int i = 1U; i <= 2U * BCH_T; i++) {
+		unsigned int sum = 0U;
+		for (unsigned int j = 0U; j <= (unsigned int)(length - k); j++) {
+			if (g[j] != 0)
+				sum ^= BCH_GF.m_exp[(i * j) % BCH_GF.SIZE];
+		}
+
+		if (sum != 0U)
+			return false;
+	}
+
+	return true;
+}
+
+static_assert(BCH_GF.verify(), "GF(2^6) polynomial isn't primitive");
+static_assert(bchHasRoots(), "BCH (63,16,23) generator doesn't have the expected roots");
+
+// The power of x of each bit of the NID, the data bits are the highest powers and the parity
+// bits follow from x^0. The last bit is a parity bit that isn't part of the code.
+constexpr unsigned int bchPower(unsigned int pos)
+{
+	return (pos < (unsigned int)k) ? (pos + (unsigned int)(length - k)) : (pos - (unsigned int)k);
+}
+
+/*
+ * The odd syndromes of a received NID, which are the sums of the powers of alpha^i for its set
+ * bits. They are built up from a table for each byte position, and the even syndromes follow
+ * from them as S(2i) = S(i)^2 for a binary code.
+ */
+class CBCHSyndromeTables {
+public:
+	constexpr CBCHSyndromeTables() :
+	m_table()
+	{
+		for (unsigned int n = 0U; n < BCH_T; n++) {
+			unsigned int i = 2U * n + 1U;
+
+			for (unsigned int b = 0U; b < 8U; b++) {
+				for (unsigned int v = 0U; v < 256U; v++) {
+					unsigned int sum = 0U;
+					for (unsigned int bit = 0U; bit < 8U; bit++) {
+						unsigned int pos = b * 8U + bit;
+						if ((v & (0x80U >> bit)) != 0U && pos < (unsigned int)length)
+							sum ^= BCH_GF.m_exp[(i * bchPower(pos)) % BCH_GF.SIZE];
+					}
+
+					m_table[n][b][v] = (unsigned char)sum;
+				}
+			}
+		}
+	}
+
+	alignas(FEC_TABLE_ALIGNMENT) unsigned char m_table[BCH_T][8U][256U];
+};
+
+constexpr CBCHSyndromeTables BCH_SYNDROMES;
+
+static_assert(BCH_SYNDROMES.m_table[0U][7U][0x01U] == 0U, "BCH (63,16,23) includes the NID parity bit");
+static_assert(BCH_SYNDROMES.m_table[0U][2U][0x80U] == 0x01U, "BCH (63,16,23) syndrome table is wrong");
+
+static unsigned int gfMultiply(unsigned int a, unsigned int b)
+{
+	if (a == 0U || b == 0U)
+		return 0U;
+
+	return BCH_GF.m_exp[BCH_GF.m_log[a] + BCH_GF.m_log[b]];
+}
+
+static unsigned int gfDivide(unsigned int a, unsigned int b)
+{
+	assert(b != 0U);
+
+	if (a == 0U)
+		return 0U;
+
+	return BCH_GF.m_exp[BCH_GF.m_log[a] + BCH_GF.SIZE - BCH_GF.m_log[b]];
+}
+
 CBCH::CBCH()
 {
 }
@@ -140,5 +228,113 @@ void CBCH::encode(unsigned char* nid)
 	}
 }
 
-#endif
+/*
+ * Decode using the syndromes, the Berlekamp-Massey algorithm to find the error locator, and a
+ * Chien search for its roots. The NID is only changed when every error has been located.
+ */
+bool CBCH::decode(unsigned char* nid, unsigned int& errors)
+{
+	assert(nid != nullptr);
+
+	unsigned int s[2U * BCH_T + 1U];
+	s[0U] = 0U;
+
+	bool clean = true;
+	for (unsigned int n = 0U; n < BCH_T; n++) {
+		unsigned int v = 0U;
+		for (unsigned int b = 0U; b < 8U; b++)
+			v ^= BCH_SYNDROMES.m_table[n][b][nid[b]];
+
+		s[2U * n + 1U] = v;
+		if (v != 0U)
+			clean = false;
+	}
+
+	errors = 0U;
+	if (clean)
+		return true;
+
+	for (unsigned int i = 2U; i <= (2U * BCH_T); i += 2U)
+		s[i] = gfMultiply(s[i / 2U], s[i / 2U]);
+
+	// The error locator, and its value at the last length change. For a binary code every
+	// other discrepancy is zero, so only the even steps are taken.
+	unsigned int lambda[2U * BCH_T + 2U] = {1U};
+	unsigned int prev[2U * BCH_T + 2U]   = {1U};
+	unsigned int l     = 0U;
+	unsigned int prevL = 0U;
+	unsigned int m     = 1U;
+	unsigned int b     = 1U;
 
+	for (unsigned int n = 0U; n < (2U * BCH_T); n += 2U) {
+		unsigned int d = s[n + 1U];
+		for (unsigned int i = 1U; i <= l; i++)
+			d ^= gfMultiply(lambda[i], s[n + 1U - i]);
+
+		if (d == 0U) {
+			m += 2U;
+			continue;
+		}
+
+		unsigned int coeff = gfDivide(d, b);
+
+		if ((2U * l) <= n) {
+			unsigned int temp[2U * BCH_T + 2U];
+			::memcpy(temp, lambda, (l + 1U) * sizeof(unsigned int));
+
+			for (unsigned int i = 0U; i <= prevL && (i + m) <= (2U * BCH_T + 1U); i++)
+				lambda[i + m] ^= gfMultiply(coeff, prev[i]);
+
+			unsigned int oldL = l;
+			l = n + 1U - l;
+
+			::memcpy(prev, temp, (oldL + 1U) * sizeof(unsigned int));
+			prevL = oldL;
+			b = d;
+			m = 2U;
+		} else {
+			for (unsigned int i = 0U; i <= prevL && (i + m) <= (2U * BCH_T + 1U); i++)
+				lambda[i + m] ^= gfMultiply(coeff, prev[i]);
+			m += 2U;
+		}
+
+		if (l > BCH_T)
+			return false;
+	}
+
+	// An error at x^j gives a root at alpha^-j, so each term's log drops by its power at every step
+	const unsigned int NO_TERM = 0xFFU;
+	unsigned int logs[BCH_T + 1U];
+	for (unsigned int i = 1U; i <= l; i++)
+		logs[i] = (lambda[i] != 0U) ? BCH_GF.m_log[lambda[i]] : NO_TERM;
+
+	unsigned int positions[BCH_T];
+	unsigned int found = 0U;
+	for (unsigned int j = 0U; j < BCH_GF.SIZE && found < l; j++) {
+		unsigned int sum = 1U;
+		for (unsigned int i = 1U; i <= l; i++) {
+			if (logs[i] != NO_TERM) {
+				sum ^= BCH_GF.m_exp[logs[i]];
+				logs[i] = (logs[i] >= i) ? (logs[i] - i) : (logs[i] + BCH_GF.SIZE - i);
+			}
+		}
+
+		if (sum == 0U)
+			positions[found++] = j;
+	}
+
+	if (found != l)
+		return false;
+
+	for (unsigned int i = 0U; i < found; i++) {
+		unsigned int j   = positions[i];
+		unsigned int pos = (j >= (unsigned int)(length - k)) ? (j - (unsigned int)(length - k)) : (j + (unsigned int)k);
+		nid[pos / 8U] ^= 0x80U >> (pos % 8U);
+	}
+
+	errors = l;
+
+	return true;
+}
+
+#endif
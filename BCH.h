@@ -30,6 +30,10 @@ public:
 
 	void encode(unsigned char* data);
 
+	// Correct up to eleven errors in a NID, giving the number corrected, and return false when
+	// there are too many to correct
+	bool decode(unsigned char* nid, unsigned int& errors);
+
 private:
 	void encode(const int* data, int* bb);
 };
@@ -18,28 +18,71 @@
  */
 
 #include "BPTC19696.h"
+#include "Hamming.h"
+#include "FECTables.h"
 
 #if defined(USE_DMR)
 
-#include "Hamming.h"
-#include "Utils.h"
-
 #include <cstdio>
 #include <cassert>
 #include <cstring>
 
+const unsigned char NO_ROW = 0xFFU;
+
+/*
+ * The de-interleaved block is held as 13 rows of 15 bits, column 0 in bit 14. The
+ * first bit, R(3), is not part of the matrix and is parked in a spare fourteenth row.
+ * This table gives the place of each transmitted bit, as row << 4 | column. Bit a of
+ * the block is sent as bit (a * 181) % 196, and 13 is the inverse of 181 modulo 196.
+ */
+constexpr CInterleaveTables<unsigned char, 196U> INTERLEAVE_TABLE([](unsigned int n) {
+	unsigned int a = (n * 13U) % 196U;
+
+	return (a == 0U) ? 0xD0U : ((((a - 1U) / 15U) << 4) | ((a - 1U) % 15U));
+});
+
+static_assert(INTERLEAVE_TABLE.verify(0xE0U), "The BPTC (196,96) interleave isn't a permutation of the block");
+static_assert(INTERLEAVE_TABLE.m_place[0U] == 0xD0U && INTERLEAVE_TABLE.m_place[1U] == 0x0CU && INTERLEAVE_TABLE.m_place[195U] == 0xC2U, "BPTC (196,96) interleave mismatch");
+
+// The columns are a Hamming (13,9,3) code, row 0 the first bit, with the checks in Hamming.cpp
+constexpr unsigned int CHECKS_1393[] = {0x1ACU, 0x1D6U, 0x1EBU, 0x159U};
+
+constexpr CHammingTables<13U, 9U> HAMMING_1393(CHECKS_1393);
+
+// The row to flip for each column syndrome, the first check in bit 0, or none
+class CColumnFlips {
+public:
+	constexpr CColumnFlips(const CHammingTables<13U, 9U>& hamming) :
+	m_row()
+	{
+		for (unsigned int n = 0U; n < 16U; n++) {
+			// The tables hold the syndrome with the first check highest, and a code with no
+			// data bits set is just its parity bits
+			unsigned int s = ((n & 0x01U) << 3) | ((n & 0x02U) << 1) | ((n & 0x04U) >> 1) | ((n & 0x08U) >> 3);
+			unsigned int error = hamming.error(s);
+
+			m_row[n] = NO_ROW;
+			for (unsigned int r = 0U; r < 13U; r++) {
+				if (error == (1U << (12U - r)))
+					m_row[n] = r;
+			}
+		}
+	}
+
+	unsigned char m_row[16U];
+};
+
+constexpr CColumnFlips COL_FLIP_1393(HAMMING_1393);
+
+static_assert(COL_FLIP_1393.m_row[0x00U] == NO_ROW && COL_FLIP_1393.m_row[0x01U] == 9U && COL_FLIP_1393.m_row[0x0FU] == 0U && COL_FLIP_1393.m_row[0x09U] == NO_ROW, "BPTC (196,96) column flip table mismatch");
+
 CBPTC19696::CBPTC19696() :
-m_rawData(nullptr),
-m_deInterData(nullptr)
+m_rows()
 {
-	m_rawData     = new bool[196];
-	m_deInterData = new bool[196];
 }
 
 CBPTC19696::~CBPTC19696()
 {
-	delete[] m_rawData;
-	delete[] m_deInterData;
 }
 
 // The main decode function
@@ -48,11 +91,8 @@ void CBPTC19696::decode(const unsigned char* in, unsigned char* out)
 	assert(in != nullptr);
 	assert(out != nullptr);
 
-	//  Get the raw binary
-	decodeExtractBinary(in);
-
-	// Deinterleave
-	decodeDeInterleave();
+	//  Get the raw binary and deinterleave it
+	decodeDeInterleave(in);
 
 	// Error check
 	decodeErrorCheck();
@@ -73,66 +113,36 @@ void CBPTC19696::encode(const unsigned char* in, unsigned char* out)
 	// Error check
 	encodeErrorCheck();
 
-	// Deinterleave
-	encodeInterleave();
-
-	//  Get the raw binary
-	encodeExtractBinary(out);
-}
-
-void CBPTC19696::decodeExtractBinary(const unsigned char* in)
-{
-	// First block
-	CUtils::byteToBitsBE(in[0U],  m_rawData + 0U);
-	CUtils::byteToBitsBE(in[1U],  m_rawData + 8U);
-	CUtils::byteToBitsBE(in[2U],  m_rawData + 16U);
-	CUtils::byteToBitsBE(in[3U],  m_rawData + 24U);
-	CUtils::byteToBitsBE(in[4U],  m_rawData + 32U);
-	CUtils::byteToBitsBE(in[5U],  m_rawData + 40U);
-	CUtils::byteToBitsBE(in[6U],  m_rawData + 48U);
-	CUtils::byteToBitsBE(in[7U],  m_rawData + 56U);
-	CUtils::byteToBitsBE(in[8U],  m_rawData + 64U);
-	CUtils::byteToBitsBE(in[9U],  m_rawData + 72U);
-	CUtils::byteToBitsBE(in[10U], m_rawData + 80U);
-	CUtils::byteToBitsBE(in[11U], m_rawData + 88U);
-	CUtils::byteToBitsBE(in[12U], m_rawData + 96U);
-
-	// Handle the two bits
-	bool bits[8U];
-	CUtils::byteToBitsBE(in[20U], bits);
-	m_rawData[98U] = bits[6U];
-	m_rawData[99U] = bits[7U];
-
-	// Second block
-	CUtils::byteToBitsBE(in[21U], m_rawData + 100U);
-	CUtils::byteToBitsBE(in[22U], m_rawData + 108U);
-	CUtils::byteToBitsBE(in[23U], m_rawData + 116U);
-	CUtils::byteToBitsBE(in[24U], m_rawData + 124U);
-	CUtils::byteToBitsBE(in[25U], m_rawData + 132U);
-	CUtils::byteToBitsBE(in[26U], m_rawData + 140U);
-	CUtils::byteToBitsBE(in[27U], m_rawData + 148U);
-	CUtils::byteToBitsBE(in[28U], m_rawData + 156U);
-	CUtils::byteToBitsBE(in[29U], m_rawData + 164U);
-	CUtils::byteToBitsBE(in[30U], m_rawData + 172U);
-	CUtils::byteToBitsBE(in[31U], m_rawData + 180U);
-	CUtils::byteToBitsBE(in[32U], m_rawData + 188U);
+	// Interleave and write the raw binary
+	encodeInterleave(out);
 }
 
 // Deinterleave the raw data
-void CBPTC19696::decodeDeInterleave()
+void CBPTC19696::decodeDeInterleave(const unsigned char* in)
 {
-	for (unsigned int i = 0U; i < 196U; i++)
-		m_deInterData[i] = false;
-
-	// The first bit is R(3) which is not used so can be ignored
-	for (unsigned int a = 0U; a < 196U; a++)	{
-		// Calculate the interleave sequence
-		unsigned int interleaveSequence = (a * 181U) % 196U;
-		// Shuffle the data
-		m_deInterData[a] = m_rawData[interleaveSequence];
+	// The two halves of the block are either side of the 48 bits of sync or EMB and two bits of slot type
+	unsigned char raw[25U];
+	::memcpy(raw, in, 12U);
+	raw[12U] = (in[12U] & 0xC0U) | ((in[20U] & 0x03U) << 4) | (in[21U] >> 4);
+	for (unsigned int i = 0U; i < 11U; i++)
+		raw[13U + i] = (in[21U + i] << 4) | (in[22U + i] >> 4);
+	raw[24U] = in[32U] << 4;
+
+	// Work on a local copy, the compiler cannot keep the members in registers across the byte stores
+	unsigned int rows[14U] = {0U};
+
+	const unsigned char* pos = INTERLEAVE_TABLE.m_place;
+	for (unsigned int i = 0U; i < 25U; i++) {
+		unsigned int v = raw[i];
+		unsigned int n = (i < 24U) ? 8U : 4U;
+		for (unsigned int j = 0U; j < n; j++, v <<= 1, pos++)
+			rows[*pos >> 4] |= ((v >> 7) & 0x01U) << (14U - (*pos & 0x0FU));
 	}
+
+	for (unsigned int r = 0U; r < 14U; r++)
+		m_rows[r] = rows[r];
 }
-	
+
 // Check each row with a Hamming (15,11,3) code and each column with a Hamming (13,9,3) code
 void CBPTC19696::decodeErrorCheck()
 {
@@ -141,212 +151,122 @@ void CBPTC19696::decodeErrorCheck()
 	do {
 		fixing = false;
 
-		// Run through each of the 15 columns
-		bool col[13U];
-		for (unsigned int c = 0U; c < 15U; c++) {
-			unsigned int pos = c + 1U;
-			for (unsigned int a = 0U; a < 13U; a++) {
-				col[a] = m_deInterData[pos];
-				pos = pos + 15U;
-			}
+		// All 15 columns at once, one syndrome bit per column in each word
+		unsigned int s0 = m_rows[0U] ^ m_rows[1U] ^ m_rows[3U] ^ m_rows[5U] ^ m_rows[6U] ^ m_rows[9U];
+		unsigned int s1 = m_rows[0U] ^ m_rows[1U] ^ m_rows[2U] ^ m_rows[4U] ^ m_rows[6U] ^ m_rows[7U] ^ m_rows[10U];
+		unsigned int s2 = m_rows[0U] ^ m_rows[1U] ^ m_rows[2U] ^ m_rows[3U] ^ m_rows[5U] ^ m_rows[7U] ^ m_rows[8U] ^ m_rows[11U];
+		unsigned int s3 = m_rows[0U] ^ m_rows[2U] ^ m_rows[4U] ^ m_rows[5U] ^ m_rows[8U] ^ m_rows[12U];
 
-			if (CHamming::decode1393(col)) {
-				unsigned int pos = c + 1U;
-				for (unsigned int a = 0U; a < 13U; a++) {
-					m_deInterData[pos] = col[a];
-					pos = pos + 15U;
-				}
+		unsigned int errs = s0 | s1 | s2 | s3;
+		for (unsigned int c = 0U; errs != 0U && c < 15U; c++) {
+			unsigned int mask = 0x4000U >> c;
+			if ((errs & mask) == 0U)
+				continue;
 
+			unsigned int n = ((s0 & mask) ? 0x01U : 0x00U) | ((s1 & mask) ? 0x02U : 0x00U) |
+					 ((s2 & mask) ? 0x04U : 0x00U) | ((s3 & mask) ? 0x08U : 0x00U);
+
+			unsigned char row = COL_FLIP_1393.m_row[n];
+			if (row != NO_ROW) {
+				m_rows[row] ^= mask;
 				fixing = true;
 			}
+
+			errs &= ~mask;
 		}
-		
+
 		// Run through each of the 9 rows containing data
 		for (unsigned int r = 0U; r < 9U; r++) {
-			unsigned int pos = (r * 15U) + 1U;
-			if (CHamming::decode15113_2(m_deInterData + pos))
+			unsigned int row = m_rows[r];
+			if (CHamming::decode15113_2(row)) {
+				m_rows[r] = row;
 				fixing = true;
+			}
 		}
 
 		count++;
 	} while (fixing && count < 5U);
 }
 
-// Extract the 96 bits of payload
+// Extract the 96 bits of payload, eight from the first row and eleven from each of the next eight
 void CBPTC19696::decodeExtractData(unsigned char* data) const
 {
-	bool bData[96U];
-	unsigned int pos = 0U;
-	for (unsigned int a = 4U; a <= 11U; a++, pos++)
-		bData[pos] = m_deInterData[a];
-
-	for (unsigned int a = 16U; a <= 26U; a++, pos++)
-		bData[pos] = m_deInterData[a];
-
-	for (unsigned int a = 31U; a <= 41U; a++, pos++)
-		bData[pos] = m_deInterData[a];
-
-	for (unsigned int a = 46U; a <= 56U; a++, pos++)
-		bData[pos] = m_deInterData[a];
-
-	for (unsigned int a = 61U; a <= 71U; a++, pos++)
-		bData[pos] = m_deInterData[a];
-
-	for (unsigned int a = 76U; a <= 86U; a++, pos++)
-		bData[pos] = m_deInterData[a];
-
-	for (unsigned int a = 91U; a <= 101U; a++, pos++)
-		bData[pos] = m_deInterData[a];
-
-	for (unsigned int a = 106U; a <= 116U; a++, pos++)
-		bData[pos] = m_deInterData[a];
-
-	for (unsigned int a = 121U; a <= 131U; a++, pos++)
-		bData[pos] = m_deInterData[a];
-
-	CUtils::bitsToByteBE(bData + 0U,  data[0U]);
-	CUtils::bitsToByteBE(bData + 8U,  data[1U]);
-	CUtils::bitsToByteBE(bData + 16U, data[2U]);
-	CUtils::bitsToByteBE(bData + 24U, data[3U]);
-	CUtils::bitsToByteBE(bData + 32U, data[4U]);
-	CUtils::bitsToByteBE(bData + 40U, data[5U]);
-	CUtils::bitsToByteBE(bData + 48U, data[6U]);
-	CUtils::bitsToByteBE(bData + 56U, data[7U]);
-	CUtils::bitsToByteBE(bData + 64U, data[8U]);
-	CUtils::bitsToByteBE(bData + 72U, data[9U]);
-	CUtils::bitsToByteBE(bData + 80U, data[10U]);
-	CUtils::bitsToByteBE(bData + 88U, data[11U]);
-}
+	unsigned int acc  = (m_rows[0U] >> 4) & 0xFFU;
+	unsigned int bits = 8U;
+	unsigned int n    = 0U;
 
-// Extract the 96 bits of payload
-void CBPTC19696::encodeExtractData(const unsigned char* in) const
-{
-	bool bData[96U];
-	CUtils::byteToBitsBE(in[0U],  bData + 0U);
-	CUtils::byteToBitsBE(in[1U],  bData + 8U);
-	CUtils::byteToBitsBE(in[2U],  bData + 16U);
-	CUtils::byteToBitsBE(in[3U],  bData + 24U);
-	CUtils::byteToBitsBE(in[4U],  bData + 32U);
-	CUtils::byteToBitsBE(in[5U],  bData + 40U);
-	CUtils::byteToBitsBE(in[6U],  bData + 48U);
-	CUtils::byteToBitsBE(in[7U],  bData + 56U);
-	CUtils::byteToBitsBE(in[8U],  bData + 64U);
-	CUtils::byteToBitsBE(in[9U],  bData + 72U);
-	CUtils::byteToBitsBE(in[10U], bData + 80U);
-	CUtils::byteToBitsBE(in[11U], bData + 88U);
-
-	for (unsigned int i = 0U; i < 196U; i++)
-		m_deInterData[i] = false;
-
-	unsigned int pos = 0U;
-	for (unsigned int a = 4U; a <= 11U; a++, pos++)
-		m_deInterData[a] = bData[pos];
-
-	for (unsigned int a = 16U; a <= 26U; a++, pos++)
-		m_deInterData[a] = bData[pos];
-
-	for (unsigned int a = 31U; a <= 41U; a++, pos++)
-		m_deInterData[a] = bData[pos];
-
-	for (unsigned int a = 46U; a <= 56U; a++, pos++)
-		m_deInterData[a] = bData[pos];
-
-	for (unsigned int a = 61U; a <= 71U; a++, pos++)
-		m_deInterData[a] = bData[pos];
-
-	for (unsigned int a = 76U; a <= 86U; a++, pos++)
-		m_deInterData[a] = bData[pos];
-
-	for (unsigned int a = 91U; a <= 101U; a++, pos++)
-		m_deInterData[a] = bData[pos];
-
-	for (unsigned int a = 106U; a <= 116U; a++, pos++)
-		m_deInterData[a] = bData[pos];
-
-	for (unsigned int a = 121U; a <= 131U; a++, pos++)
-		m_deInterData[a] = bData[pos];
+	for (unsigned int r = 1U; r < 9U; r++) {
+		acc  = (acc << 11) | (m_rows[r] >> 4);
+		bits += 11U;
+
+		while (bits >= 8U) {
+			bits -= 8U;
+			data[n++] = (acc >> bits) & 0xFFU;
+		}
+	}
 }
 
-// Check each row with a Hamming (15,11,3) code and each column with a Hamming (13,9,3) code
-void CBPTC19696::encodeErrorCheck()
+// Insert the 96 bits of payload
+void CBPTC19696::encodeExtractData(const unsigned char* in)
 {
-	
-	// Run through each of the 9 rows containing data
-	for (unsigned int r = 0U; r < 9U; r++) {
-		unsigned int pos = (r * 15U) + 1U;
-		CHamming::encode15113_2(m_deInterData + pos);
-	}
-	
-	// Run through each of the 15 columns
-	bool col[13U];
-	for (unsigned int c = 0U; c < 15U; c++) {
-		unsigned int pos = c + 1U;
-		for (unsigned int a = 0U; a < 13U; a++) {
-			col[a] = m_deInterData[pos];
-			pos = pos + 15U;
-		}
+	::memset(m_rows, 0x00U, sizeof(m_rows));
+
+	m_rows[0U] = in[0U] << 4;
 
-		CHamming::encode1393(col);
+	unsigned int acc  = 0U;
+	unsigned int bits = 0U;
+	unsigned int n    = 1U;
 
-		pos = c + 1U;
-		for (unsigned int a = 0U; a < 13U; a++) {
-			m_deInterData[pos] = col[a];
-			pos = pos + 15U;
+	for (unsigned int r = 1U; r < 9U; r++) {
+		while (bits < 11U) {
+			acc  = (acc << 8) | in[n++];
+			bits += 8U;
 		}
+
+		bits -= 11U;
+		m_rows[r] = ((acc >> bits) & 0x7FFU) << 4;
 	}
 }
 
-// Interleave the raw data
-void CBPTC19696::encodeInterleave()
+// Check each row with a Hamming (15,11,3) code and each column with a Hamming (13,9,3) code
+void CBPTC19696::encodeErrorCheck()
 {
-	for (unsigned int i = 0U; i < 196U; i++)
-		m_rawData[i] = false;
-
-	// The first bit is R(3) which is not used so can be ignored
-	for (unsigned int a = 0U; a < 196U; a++)	{
-		// Calculate the interleave sequence
-		unsigned int interleaveSequence = (a * 181U) % 196U;
-		// Unshuffle the data
-		m_rawData[interleaveSequence] = m_deInterData[a];
-	}
+	// Run through each of the 9 rows containing data
+	for (unsigned int r = 0U; r < 9U; r++)
+		m_rows[r] = CHamming::encode15113_2(m_rows[r] >> 4);
+
+	// All 15 columns at once
+	m_rows[9U]  = m_rows[0U] ^ m_rows[1U] ^ m_rows[3U] ^ m_rows[5U] ^ m_rows[6U];
+	m_rows[10U] = m_rows[0U] ^ m_rows[1U] ^ m_rows[2U] ^ m_rows[4U] ^ m_rows[6U] ^ m_rows[7U];
+	m_rows[11U] = m_rows[0U] ^ m_rows[1U] ^ m_rows[2U] ^ m_rows[3U] ^ m_rows[5U] ^ m_rows[7U] ^ m_rows[8U];
+	m_rows[12U] = m_rows[0U] ^ m_rows[2U] ^ m_rows[4U] ^ m_rows[5U] ^ m_rows[8U];
 }
 
-void CBPTC19696::encodeExtractBinary(unsigned char* data)
+// Interleave the data and write the raw binary
+void CBPTC19696::encodeInterleave(unsigned char* data) const
 {
+	unsigned char raw[25U];
+
+	const unsigned char* pos = INTERLEAVE_TABLE.m_place;
+	for (unsigned int i = 0U; i < 25U; i++) {
+		unsigned int v = 0U;
+		unsigned int n = (i < 24U) ? 8U : 4U;
+		for (unsigned int j = 0U; j < n; j++, pos++)
+			v = (v << 1) | ((m_rows[*pos >> 4] >> (14U - (*pos & 0x0FU))) & 0x01U);
+
+		raw[i] = v << (8U - n);
+	}
+
 	// First block
-	CUtils::bitsToByteBE(m_rawData + 0U,  data[0U]);
-	CUtils::bitsToByteBE(m_rawData + 8U,  data[1U]);
-	CUtils::bitsToByteBE(m_rawData + 16U, data[2U]);
-	CUtils::bitsToByteBE(m_rawData + 24U, data[3U]);
-	CUtils::bitsToByteBE(m_rawData + 32U, data[4U]);
-	CUtils::bitsToByteBE(m_rawData + 40U, data[5U]);
-	CUtils::bitsToByteBE(m_rawData + 48U, data[6U]);
-	CUtils::bitsToByteBE(m_rawData + 56U, data[7U]);
-	CUtils::bitsToByteBE(m_rawData + 64U, data[8U]);
-	CUtils::bitsToByteBE(m_rawData + 72U, data[9U]);
-	CUtils::bitsToByteBE(m_rawData + 80U, data[10U]);
-	CUtils::bitsToByteBE(m_rawData + 88U, data[11U]);
+	::memcpy(data, raw, 12U);
 
 	// Handle the two bits
-	unsigned char byte;
-	CUtils::bitsToByteBE(m_rawData + 96U, byte);
-	data[12U] = (data[12U] & 0x3FU) | ((byte >> 0) & 0xC0U);
-	data[20U] = (data[20U] & 0xFCU) | ((byte >> 4) & 0x03U);
+	data[12U] = (data[12U] & 0x3FU) | (raw[12U] & 0xC0U);
+	data[20U] = (data[20U] & 0xFCU) | ((raw[12U] >> 4) & 0x03U);
 
 	// Second block
-	CUtils::bitsToByteBE(m_rawData + 100U,  data[21U]);
-	CUtils::bitsToByteBE(m_rawData + 108U,  data[22U]);
-	CUtils::bitsToByteBE(m_rawData + 116U,  data[23U]);
-	CUtils::bitsToByteBE(m_rawData + 124U,  data[24U]);
-	CUtils::bitsToByteBE(m_rawData + 132U,  data[25U]);
-	CUtils::bitsToByteBE(m_rawData + 140U,  data[26U]);
-	CUtils::bitsToByteBE(m_rawData + 148U,  data[27U]);
-	CUtils::bitsToByteBE(m_rawData + 156U,  data[28U]);
-	CUtils::bitsToByteBE(m_rawData + 164U,  data[29U]);
-	CUtils::bitsToByteBE(m_rawData + 172U,  data[30U]);
-	CUtils::bitsToByteBE(m_rawData + 180U,  data[31U]);
-	CUtils::bitsToByteBE(m_rawData + 188U,  data[32U]);
+	for (unsigned int i = 0U; i < 12U; i++)
+		data[21U + i] = (raw[12U + i] << 4) | (raw[13U + i] >> 4);
 }
 
 #endif
-
@@ -0,0 +1,58 @@
+/*
+ *   Copyright (C) 2010,2014,2016,2018,2023 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(Baseline_AMBEFEC_H)
+#define	Baseline_AMBEFEC_H
+
+#include "Defines.h"
+
+namespace Baseline {
+
+class CAMBEFEC {
+public:
+	CAMBEFEC();
+	~CAMBEFEC();
+
+#if defined(USE_DMR) || defined(USE_YSF) || defined(USE_NXDN)
+	unsigned int regenerateDMR(unsigned char* bytes) const;
+#endif
+
+#if defined(USE_DSTAR)
+	unsigned int regenerateDStar(unsigned char* bytes) const;
+#endif
+
+#if defined(USE_YSF) || defined(USE_NXDN)
+	unsigned int regenerateYSFDN(unsigned char* bytes) const;
+#endif
+
+#if defined(USE_YSF) || defined(USE_P25)
+	unsigned int regenerateIMBE(unsigned char* bytes) const;
+#endif
+
+private:
+#if defined(USE_DSTAR)
+	unsigned int regenerateDStar(unsigned int& a, unsigned int& b) const;
+#endif
+#if defined(USE_DMR) || defined(USE_YSF) || defined(USE_NXDN)
+	unsigned int regenerateDMR(unsigned int& a, unsigned int& b,unsigned int& c) const;
+#endif
+};
+
+}
+
+#endif
@@ -0,0 +1,57 @@
+/*
+ *   Copyright (C) 2015,2016,2023 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(Baseline_CRC_H)
+#define	Baseline_CRC_H
+
+#include "Defines.h"
+
+namespace Baseline {
+
+class CCRC
+{
+public:
+#if defined(USE_DMR)
+	static bool checkFiveBit(bool* in, unsigned int tcrc);
+	static void encodeFiveBit(const bool* in, unsigned int& tcrc);
+#endif
+
+#if defined(USE_DSTAR)
+	static void addCCITT161(unsigned char* in, unsigned int length);
+#endif
+
+#if defined(USE_DMR) || defined(USE_YSF) || defined(USE_P25)
+	static void addCCITT162(unsigned char* in, unsigned int length);
+#endif
+
+#if defined(USE_DSTAR)
+	static bool checkCCITT161(const unsigned char* in, unsigned int length);
+#endif
+
+#if defined(USE_DMR) || defined(USE_YSF) || defined(USE_P25)
+	static bool checkCCITT162(const unsigned char* in, unsigned int length);
+#endif
+
+#if defined(USE_DMR)
+	static unsigned char crc8(const unsigned char* in, unsigned int length);
+#endif
+};
+
+}
+
+#endif
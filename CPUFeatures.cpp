@@ -0,0 +1,176 @@
+/*
+ *   Copyright (C) 2025 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "CPUFeatures.h"
+#include "Log.h"
+
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define	CPU_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#include <immintrin.h>
+#else
+#include <cpuid.h>
+#endif
+#elif (defined(__arm__) || defined(__aarch64__)) && defined(__linux__)
+#define	CPU_ARM_LINUX
+#include <sys/auxv.h>
+#endif
+
+unsigned int CCPUFeatures::m_detected = 0U;
+unsigned int CCPUFeatures::m_features = 0U;
+
+#if defined(CPU_X86)
+static void cpuid(unsigned int leaf, unsigned int subleaf, unsigned int* regs)
+{
+#if defined(_MSC_VER)
+	int r[4U];
+	::__cpuidex(r, int(leaf), int(subleaf));
+	for (unsigned int i = 0U; i < 4U; i++)
+		regs[i] = (unsigned int)r[i];
+#else
+	__cpuid_count(leaf, subleaf, regs[0U], regs[1U], regs[2U], regs[3U]);
+#endif
+}
+
+// The register state the operating system saves on a context switch
+static uint64_t xgetbv()
+{
+#if defined(_MSC_VER)
+	return ::_xgetbv(0U);
+#else
+	unsigned int eax, edx;
+	__asm__ volatile("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0U));
+	return (uint64_t(edx) << 32) | eax;
+#endif
+}
+#endif
+
+void CCPUFeatures::init(bool forceScalar)
+{
+	m_detected = detect();
+	m_features = forceScalar ? 0U : m_detected;
+
+	LogInfo("CPU features: %s", toString(m_detected).c_str());
+	if (forceScalar)
+		LogInfo("    Forced to the portable code");
+}
+
+bool CCPUFeatures::has(CPU_FEATURE feature)
+{
+	return (m_features & feature) == feature;
+}
+
+unsigned int CCPUFeatures::getDetected()
+{
+	return m_detected;
+}
+
+std::string CCPUFeatures::toString(unsigned int features)
+{
+	const struct {
+		CPU_FEATURE m_feature;
+		const char* m_name;
+	} NAMES[] = {
+		{CPUF_SSE2,   "sse2"},
+		{CPUF_SSE42,  "sse4.2"},
+		{CPUF_AVX2,   "avx2"},
+		{CPUF_BMI2,   "bmi2"},
+		{CPUF_PCLMUL, "pclmul"},
+		{CPUF_NEON,   "neon"},
+		{CPUF_CRC32,  "crc32"}};
+
+	std::string text;
+	for (const auto& name : NAMES) {
+		if ((features & name.m_feature) == name.m_feature) {
+			if (!text.empty())
+				text += " ";
+			text += name.m_name;
+		}
+	}
+
+	return text.empty() ? "none" : text;
+}
+
+unsigned int CCPUFeatures::detect()
+{
+	unsigned int features = 0U;
+
+#if defined(CPU_X86)
+	unsigned int regs[4U];
+	cpuid(0U, 0U, regs);
+	unsigned int maxLeaf = regs[0U];
+
+	// The vendor string is held in EBX, EDX, ECX
+	bool amd = regs[1U] == 0x68747541U && regs[3U] == 0x69746E65U && regs[2U] == 0x444D4163U;
+
+	if (maxLeaf < 1U)
+		return features;
+
+	cpuid(1U, 0U, regs);
+
+	unsigned int family = (regs[0U] >> 8) & 0x0FU;
+	if (family == 0x0FU)
+		family += (regs[0U] >> 20) & 0xFFU;
+
+	if ((regs[3U] & (1U << 26)) != 0U)
+		features |= CPUF_SSE2;
+	if ((regs[2U] & (1U << 20)) != 0U)
+		features |= CPUF_SSE42;
+	if ((regs[2U] & (1U << 1)) != 0U)
+		features |= CPUF_PCLMUL;
+
+	// AVX2 also needs the operating system to save the YMM registers
+	bool avx = (regs[2U] & (1U << 27)) != 0U && (regs[2U] & (1U << 28)) != 0U && (xgetbv() & 0x06U) == 0x06U;
+
+	if (maxLeaf >= 7U) {
+		cpuid(7U, 0U, regs);
+
+		if (avx && (regs[1U] & (1U << 5)) != 0U)
+			features |= CPUF_AVX2;
+
+		// PDEP and PEXT are microcoded and much slower than a table before AMD Zen 3
+		if ((regs[1U] & (1U << 8)) != 0U && (!amd || family >= 0x19U))
+			features |= CPUF_BMI2;
+	}
+#elif defined(CPU_ARM_LINUX)
+#if defined(__aarch64__)
+	unsigned long hwcap = ::getauxval(AT_HWCAP);
+
+	if ((hwcap & (1UL << 1)) != 0UL)		// HWCAP_ASIMD
+		features |= CPUF_NEON;
+	if ((hwcap & (1UL << 7)) != 0UL)		// HWCAP_CRC32
+		features |= CPUF_CRC32;
+#else
+	unsigned long hwcap  = ::getauxval(AT_HWCAP);
+	unsigned long hwcap2 = ::getauxval(AT_HWCAP2);
+
+	if ((hwcap & (1UL << 12)) != 0UL)		// HWCAP_NEON
+		features |= CPUF_NEON;
+	if ((hwcap2 & (1UL << 4)) != 0UL)		// HWCAP2_CRC32
+		features |= CPUF_CRC32;
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	// NEON is part of the 64-bit ARM architecture
+	features |= CPUF_NEON;
+#endif
+
+	return features;
+}
@@ -0,0 +1,66 @@
+/*
+ *   Copyright (C) 2025 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(CPUFeatures_H)
+#define	CPUFeatures_H
+
+#include <string>
+
+enum CPU_FEATURE {
+	CPUF_SSE2   = 0x0001U,
+	CPUF_SSE42  = 0x0002U,
+	CPUF_AVX2   = 0x0004U,
+	CPUF_BMI2   = 0x0008U,
+	CPUF_PCLMUL = 0x0010U,
+	CPUF_NEON   = 0x0100U,
+	CPUF_CRC32  = 0x0200U
+};
+
+// Code that uses instructions beyond the compiler's baseline is compiled for them with these
+#if (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(_MSC_VER))
+#define	CPU_HAS_BMI2_CODE
+#if defined(__GNUC__)
+#define	CPU_TARGET_BMI2	__attribute__((target("bmi2")))
+#else
+#define	CPU_TARGET_BMI2
+#endif
+#endif
+
+/*
+ * The instruction set extensions of the CPU we're running on, found once at startup so that
+ * the codecs can choose the fastest of their implementations that will run. When the portable
+ * code is forced, no features are reported.
+ */
+class CCPUFeatures {
+public:
+	static void init(bool forceScalar);
+
+	static bool has(CPU_FEATURE feature);
+
+	static unsigned int getDetected();
+
+	static std::string toString(unsigned int features);
+
+private:
+	static unsigned int m_detected;
+	static unsigned int m_features;
+
+	static unsigned int detect();
+};
+
+#endif
@@ -17,224 +17,178 @@
  */
 
 #include "CRC.h"
-
-#include "Utils.h"
-#include "Log.h"
+#include "FECTables.h"
 
 #include <cstdint>
 #include <cstdio>
 #include <cassert>
-#include <cmath>
+
+// Slice-by-4 tables, m_table[k][b] is the CRC of byte b followed by k zero bytes, so that four
+// bytes of input can be folded in with four independent lookups. The first table is generated
+// from the polynomial, which is bit reversed for a reflected CRC.
+template <typename T, bool REFLECTED>
+class CCRCSliceTables {
+public:
+	constexpr CCRCSliceTables(T poly) :
+	m_table()
+	{
+		const unsigned int TOP = 8U * sizeof(T) - 1U;
+
+		for (unsigned int i = 0U; i < 256U; i++) {
+			T v = REFLECTED ? T(i) : T(i << (TOP - 7U));
+			for (unsigned int n = 0U; n < 8U; n++) {
+				if (REFLECTED)
+					v = ((v & 0x01U) == 0x01U) ? T((v >> 1) ^ poly) : T(v >> 1);
+				else
+					v = (((v >> TOP) & 0x01U) == 0x01U) ? T((v << 1) ^ poly) : T(v << 1);
+			}
+			m_table[0U][i] = v;
+		}
+
+		for (unsigned int k = 1U; k < 4U; k++) {
+			for (unsigned int i = 0U; i < 256U; i++) {
+				T v = m_table[k - 1U][i];
+				if (REFLECTED)
+					m_table[k][i] = T(v >> 8) ^ m_table[0U][v & 0xFFU];
+				else
+					m_table[k][i] = T(v << 8) ^ m_table[0U][v >> (TOP - 7U)];
+			}
+		}
+	}
+
+	alignas(FEC_TABLE_ALIGNMENT) T m_table[4U][256U];
+};
 
 #if defined(USE_DMR)
-const uint8_t CRC8_TABLE[] = {
-	0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31,
-	0x24, 0x23, 0x2A, 0x2D, 0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65,
-	0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D, 0xE0, 0xE7, 0xEE, 0xE9,
-	0xFC, 0xFB, 0xF2, 0xF5, 0xD8, 0xDF, 0xD6, 0xD1, 0xC4, 0xC3, 0xCA, 0xCD,
-	0x90, 0x97, 0x9E, 0x99, 0x8C, 0x8B, 0x82, 0x85, 0xA8, 0xAF, 0xA6, 0xA1,
-	0xB4, 0xB3, 0xBA, 0xBD, 0xC7, 0xC0, 0xC9, 0xCE, 0xDB, 0xDC, 0xD5, 0xD2,
-	0xFF, 0xF8, 0xF1, 0xF6, 0xE3, 0xE4, 0xED, 0xEA, 0xB7, 0xB0, 0xB9, 0xBE,
-	0xAB, 0xAC, 0xA5, 0xA2, 0x8F, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9D, 0x9A,
-	0x27, 0x20, 0x29, 0x2E, 0x3B, 0x3C, 0x35, 0x32, 0x1F, 0x18, 0x11, 0x16,
-	0x03, 0x04, 0x0D, 0x0A, 0x57, 0x50, 0x59, 0x5E, 0x4B, 0x4C, 0x45, 0x42,
-	0x6F, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7D, 0x7A, 0x89, 0x8E, 0x87, 0x80,
-	0x95, 0x92, 0x9B, 0x9C, 0xB1, 0xB6, 0xBF, 0xB8, 0xAD, 0xAA, 0xA3, 0xA4,
-	0xF9, 0xFE, 0xF7, 0xF0, 0xE5, 0xE2, 0xEB, 0xEC, 0xC1, 0xC6, 0xCF, 0xC8,
-	0xDD, 0xDA, 0xD3, 0xD4, 0x69, 0x6E, 0x67, 0x60, 0x75, 0x72, 0x7B, 0x7C,
-	0x51, 0x56, 0x5F, 0x58, 0x4D, 0x4A, 0x43, 0x44, 0x19, 0x1E, 0x17, 0x10,
-	0x05, 0x02, 0x0B, 0x0C, 0x21, 0x26, 0x2F, 0x28, 0x3D, 0x3A, 0x33, 0x34,
-	0x4E, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5C, 0x5B, 0x76, 0x71, 0x78, 0x7F,
-	0x6A, 0x6D, 0x64, 0x63, 0x3E, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2C, 0x2B,
-	0x06, 0x01, 0x08, 0x0F, 0x1A, 0x1D, 0x14, 0x13, 0xAE, 0xA9, 0xA0, 0xA7,
-	0xB2, 0xB5, 0xBC, 0xBB, 0x96, 0x91, 0x98, 0x9F, 0x8A, 0x8D, 0x84, 0x83,
-	0xDE, 0xD9, 0xD0, 0xD7, 0xC2, 0xC5, 0xCC, 0xCB, 0xE6, 0xE1, 0xE8, 0xEF,
-	0xFA, 0xFD, 0xF4, 0xF3, 0x01};
+// CRC-8 with x^8 + x^2 + x + 1
+constexpr CCRCSliceTables<uint8_t, false> CRC8_SLICES(0x07U);
+
+static_assert(CRC8_SLICES.m_table[0U][0x01U] == 0x07U && CRC8_SLICES.m_table[0U][0x10U] == 0x70U && CRC8_SLICES.m_table[0U][0xFFU] == 0xF3U, "CRC-8 table is wrong");
 #endif
 
 #if defined(USE_DSTAR)
-const uint16_t CCITT16_TABLE1[] = {
-	0x0000U, 0x1189U, 0x2312U, 0x329bU, 0x4624U, 0x57adU, 0x6536U, 0x74bfU,
-	0x8c48U, 0x9dc1U, 0xaf5aU, 0xbed3U, 0xca6cU, 0xdbe5U, 0xe97eU, 0xf8f7U,
-	0x1081U, 0x0108U, 0x3393U, 0x221aU, 0x56a5U, 0x472cU, 0x75b7U, 0x643eU,
-	0x9cc9U, 0x8d40U, 0xbfdbU, 0xae52U, 0xdaedU, 0xcb64U, 0xf9ffU, 0xe876U,
-	0x2102U, 0x308bU, 0x0210U, 0x1399U, 0x6726U, 0x76afU, 0x4434U, 0x55bdU,
-	0xad4aU, 0xbcc3U, 0x8e58U, 0x9fd1U, 0xeb6eU, 0xfae7U, 0xc87cU, 0xd9f5U,
-	0x3183U, 0x200aU, 0x1291U, 0x0318U, 0x77a7U, 0x662eU, 0x54b5U, 0x453cU,
-	0xbdcbU, 0xac42U, 0x9ed9U, 0x8f50U, 0xfbefU, 0xea66U, 0xd8fdU, 0xc974U,
-	0x4204U, 0x538dU, 0x6116U, 0x709fU, 0x0420U, 0x15a9U, 0x2732U, 0x36bbU,
-	0xce4cU, 0xdfc5U, 0xed5eU, 0xfcd7U, 0x8868U, 0x99e1U, 0xab7aU, 0xbaf3U,
-	0x5285U, 0x430cU, 0x7197U, 0x601eU, 0x14a1U, 0x0528U, 0x37b3U, 0x263aU,
-	0xdecdU, 0xcf44U, 0xfddfU, 0xec56U, 0x98e9U, 0x8960U, 0xbbfbU, 0xaa72U,
-	0x6306U, 0x728fU, 0x4014U, 0x519dU, 0x2522U, 0x34abU, 0x0630U, 0x17b9U,
-	0xef4eU, 0xfec7U, 0xcc5cU, 0xddd5U, 0xa96aU, 0xb8e3U, 0x8a78U, 0x9bf1U,
-	0x7387U, 0x620eU, 0x5095U, 0x411cU, 0x35a3U, 0x242aU, 0x16b1U, 0x0738U,
-	0xffcfU, 0xee46U, 0xdcddU, 0xcd54U, 0xb9ebU, 0xa862U, 0x9af9U, 0x8b70U,
-	0x8408U, 0x9581U, 0xa71aU, 0xb693U, 0xc22cU, 0xd3a5U, 0xe13eU, 0xf0b7U,
-	0x0840U, 0x19c9U, 0x2b52U, 0x3adbU, 0x4e64U, 0x5fedU, 0x6d76U, 0x7cffU,
-	0x9489U, 0x8500U, 0xb79bU, 0xa612U, 0xd2adU, 0xc324U, 0xf1bfU, 0xe036U,
-	0x18c1U, 0x0948U, 0x3bd3U, 0x2a5aU, 0x5ee5U, 0x4f6cU, 0x7df7U, 0x6c7eU,
-	0xa50aU, 0xb483U, 0x8618U, 0x9791U, 0xe32eU, 0xf2a7U, 0xc03cU, 0xd1b5U,
-	0x2942U, 0x38cbU, 0x0a50U, 0x1bd9U, 0x6f66U, 0x7eefU, 0x4c74U, 0x5dfdU,
-	0xb58bU, 0xa402U, 0x9699U, 0x8710U, 0xf3afU, 0xe226U, 0xd0bdU, 0xc134U,
-	0x39c3U, 0x284aU, 0x1ad1U, 0x0b58U, 0x7fe7U, 0x6e6eU, 0x5cf5U, 0x4d7cU,
-	0xc60cU, 0xd785U, 0xe51eU, 0xf497U, 0x8028U, 0x91a1U, 0xa33aU, 0xb2b3U,
-	0x4a44U, 0x5bcdU, 0x6956U, 0x78dfU, 0x0c60U, 0x1de9U, 0x2f72U, 0x3efbU,
-	0xd68dU, 0xc704U, 0xf59fU, 0xe416U, 0x90a9U, 0x8120U, 0xb3bbU, 0xa232U,
-	0x5ac5U, 0x4b4cU, 0x79d7U, 0x685eU, 0x1ce1U, 0x0d68U, 0x3ff3U, 0x2e7aU,
-	0xe70eU, 0xf687U, 0xc41cU, 0xd595U, 0xa12aU, 0xb0a3U, 0x8238U, 0x93b1U,
-	0x6b46U, 0x7acfU, 0x4854U, 0x59ddU, 0x2d62U, 0x3cebU, 0x0e70U, 0x1ff9U,
-	0xf78fU, 0xe606U, 0xd49dU, 0xc514U, 0xb1abU, 0xa022U, 0x92b9U, 0x8330U,
-	0x7bc7U, 0x6a4eU, 0x58d5U, 0x495cU, 0x3de3U, 0x2c6aU, 0x1ef1U, 0x0f78U};
+// CCITT-16 with x^16 + x^12 + x^5 + 1, reflected
+constexpr CCRCSliceTables<uint16_t, true> CCITT16_SLICES1(0x8408U);
+
+static_assert(CCITT16_SLICES1.m_table[0U][0x01U] == 0x1189U && CCITT16_SLICES1.m_table[0U][0x80U] == 0x8408U && CCITT16_SLICES1.m_table[0U][0xFFU] == 0x0F78U, "CCITT-16 reflected table is wrong");
 #endif
 
 #if defined(USE_DMR) || defined(USE_YSF) || defined(USE_P25)
-const uint16_t CCITT16_TABLE2[] = {
-	0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
-	0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
-	0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
-	0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
-	0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
-	0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
-	0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
-	0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
-	0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
-	0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
-	0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
-	0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
-	0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
-	0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
-	0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
-	0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
-	0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
-	0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
-	0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
-	0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
-	0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
-	0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
-	0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
-	0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
-	0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
-	0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
-	0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
-	0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
-	0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
-	0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
-	0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
-	0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0};
+// CCITT-16 with x^16 + x^12 + x^5 + 1
+constexpr CCRCSliceTables<uint16_t, false> CCITT16_SLICES2(0x1021U);
+
+static_assert(CCITT16_SLICES2.m_table[0U][0x01U] == 0x1021U && CCITT16_SLICES2.m_table[0U][0x80U] == 0x9188U && CCITT16_SLICES2.m_table[0U][0xFFU] == 0x1EF0U, "CCITT-16 table is wrong");
+#endif
+
+#if defined(USE_DMR) || defined(USE_P25) || defined(USE_NXDN)
+// The IEEE 802.3 CRC-32, reflected
+constexpr CCRCSliceTables<uint32_t, true> CRC32_SLICES(0xEDB88320U);
+
+static_assert(CRC32_SLICES.m_table[0U][0x01U] == 0x77073096U && CRC32_SLICES.m_table[0U][0x80U] == 0xEDB88320U && CRC32_SLICES.m_table[0U][0xFFU] == 0x2D02EF8DU, "CRC-32 table is wrong");
 #endif
 
 #if defined(USE_DMR)
-bool CCRC::checkFiveBit(bool* in, unsigned int tcrc)
+// The checksum is the sum of the nine bytes of the LC modulo 31
+bool CCRC::checkFiveBit(const unsigned char* in, unsigned int tcrc)
 {
 	assert(in != nullptr);
 
-	unsigned int crc;
-	encodeFiveBit(in, crc);
-
-	return crc == tcrc;
+	return encodeFiveBit(in) == tcrc;
 }
 
-void CCRC::encodeFiveBit(const bool* in, unsigned int& tcrc)
+unsigned int CCRC::encodeFiveBit(const unsigned char* in)
 {
 	assert(in != nullptr);
 
-	unsigned short total = 0U;
-	for (unsigned int i = 0U; i < 72U; i += 8U) {
-		unsigned char c;
-		CUtils::bitsToByteBE(in + i, c);
-		total += c;
-	}
-
-	total %= 31U;
+	unsigned int total = 0U;
+	for (unsigned int i = 0U; i < 9U; i++)
+		total += in[i];
 
-	tcrc = total;
+	return total % 31U;
 }
 #endif
 
 #if defined(USE_DMR) || defined(USE_YSF) || defined(USE_P25)
-void CCRC::addCCITT162(unsigned char *in, unsigned int length)
+// MSB first CCITT with a zero preset, four bytes per step
+static uint16_t ccitt162(const unsigned char* in, unsigned int length)
 {
-	assert(in != nullptr);
-	assert(length > 2U);
+	const uint16_t (&t)[4U][256U] = CCITT16_SLICES2.m_table;
 
-	union {
-		uint16_t crc16;
-		uint8_t  crc8[2U];
-	};
+	uint16_t crc16 = 0U;
 
-	crc16 = 0U;
-
-	for (unsigned i = 0U; i < (length - 2U); i++)
-		crc16 = (uint16_t(crc8[0U]) << 8) ^ CCITT16_TABLE2[crc8[1U] ^ in[i]];
+	unsigned int i = 0U;
+	for (; (i + 4U) <= length; i += 4U) {
+		unsigned int x = crc16 ^ ((in[i + 0U] << 8) | in[i + 1U]);
+		crc16 = t[3U][x >> 8] ^ t[2U][x & 0xFFU] ^ t[1U][in[i + 2U]] ^ t[0U][in[i + 3U]];
+	}
 
-	crc16 = ~crc16;
+	for (; i < length; i++)
+		crc16 = uint16_t(crc16 << 8) ^ t[0U][(crc16 >> 8) ^ in[i]];
 
-	in[length - 1U] = crc8[0U];
-	in[length - 2U] = crc8[1U];
+	return ~crc16;
 }
 
-bool CCRC::checkCCITT162(const unsigned char *in, unsigned int length)
+void CCRC::addCCITT162(unsigned char *in, unsigned int length)
 {
 	assert(in != nullptr);
 	assert(length > 2U);
 
-	union {
-		uint16_t crc16;
-		uint8_t  crc8[2U];
-	};
+	uint16_t crc16 = ccitt162(in, length - 2U);
 
-	crc16 = 0U;
+	in[length - 2U] = crc16 >> 8;
+	in[length - 1U] = crc16 >> 0;
+}
 
-	for (unsigned i = 0U; i < (length - 2U); i++)
-		crc16 = (uint16_t(crc8[0U]) << 8) ^ CCITT16_TABLE2[crc8[1U] ^ in[i]];
+bool CCRC::checkCCITT162(const unsigned char *in, unsigned int length)
+{
+	assert(in != nullptr);
+	assert(length > 2U);
 
-	crc16 = ~crc16;
+	uint16_t crc16 = ccitt162(in, length - 2U);
 
-	return crc8[0U] == in[length - 1U] && crc8[1U] == in[length - 2U];
+	return in[length - 2U] == ((crc16 >> 8) & 0xFFU) && in[length - 1U] == ((crc16 >> 0) & 0xFFU);
 }
 #endif
 
 #if defined(USE_DSTAR)
-void CCRC::addCCITT161(unsigned char *in, unsigned int length)
+// LSB first CCITT with a 0xFFFF preset, four bytes per step
+static uint16_t ccitt161(const unsigned char* in, unsigned int length)
 {
-	assert(in != nullptr);
-	assert(length > 2U);
+	const uint16_t (&t)[4U][256U] = CCITT16_SLICES1.m_table;
 
-	union {
-		uint16_t crc16;
-		uint8_t  crc8[2U];
-	};
+	uint16_t crc16 = 0xFFFFU;
 
-	crc16 = 0xFFFFU;
-
-	for (unsigned int i = 0U; i < (length - 2U); i++)
-		crc16 = uint16_t(crc8[1U]) ^ CCITT16_TABLE1[crc8[0U] ^ in[i]];
+	unsigned int i = 0U;
+	for (; (i + 4U) <= length; i += 4U) {
+		unsigned int x = crc16 ^ (in[i + 0U] | (in[i + 1U] << 8));
+		crc16 = t[3U][x & 0xFFU] ^ t[2U][x >> 8] ^ t[1U][in[i + 2U]] ^ t[0U][in[i + 3U]];
+	}
 
-	crc16 = ~crc16;
+	for (; i < length; i++)
+		crc16 = (crc16 >> 8) ^ t[0U][(crc16 ^ in[i]) & 0xFFU];
 
-	in[length - 2U] = crc8[0U];
-	in[length - 1U] = crc8[1U];
+	return ~crc16;
 }
 
-bool CCRC::checkCCITT161(const unsigned char *in, unsigned int length)
+void CCRC::addCCITT161(unsigned char *in, unsigned int length)
 {
 	assert(in != nullptr);
 	assert(length > 2U);
 
-	union {
-		uint16_t crc16;
-		uint8_t  crc8[2U];
-	};
+	uint16_t crc16 = ccitt161(in, length - 2U);
 
-	crc16 = 0xFFFFU;
+	in[length - 2U] = crc16 >> 0;
+	in[length - 1U] = crc16 >> 8;
+}
 
-	for (unsigned int i = 0U; i < (length - 2U); i++)
-		crc16 = uint16_t(crc8[1U]) ^ CCITT16_TABLE1[crc8[0U] ^ in[i]];
+bool CCRC::checkCCITT161(const unsigned char *in, unsigned int length)
+{
+	assert(in != nullptr);
+	assert(length > 2U);
 
-	crc16 = ~crc16;
+	uint16_t crc16 = ccitt161(in, length - 2U);
 
-	return crc8[0U] == in[length - 2U] && crc8[1U] == in[length - 1U];
+	return in[length - 2U] == ((crc16 >> 0) & 0xFFU) && in[length - 1U] == ((crc16 >> 8) & 0xFFU);
 }
 #endif
 
@@ -243,13 +197,41 @@ unsigned char CCRC::crc8(const unsigned char *in, unsigned int length)
 {
 	assert(in != nullptr);
 
+	const uint8_t (&t)[4U][256U] = CRC8_SLICES.m_table;
+
 	uint8_t crc = 0U;
 
-	for (unsigned int i = 0U; i < length; i++)
-		crc = CRC8_TABLE[crc ^ in[i]];
+	unsigned int i = 0U;
+	for (; (i + 4U) <= length; i += 4U)
+		crc = t[3U][crc ^ in[i + 0U]] ^ t[2U][in[i + 1U]] ^ t[1U][in[i + 2U]] ^ t[0U][in[i + 3U]];
+
+	for (; i < length; i++)
+		crc = t[0U][crc ^ in[i]];
 
 	return crc;
 }
 
 #endif
 
+#if defined(USE_DMR) || defined(USE_P25) || defined(USE_NXDN)
+// LSB first with a 0xFFFFFFFF preset, four bytes per step, as used for the binary ID files
+unsigned int CCRC::crc32(const unsigned char* in, unsigned int length)
+{
+	assert(in != nullptr);
+
+	const uint32_t (&t)[4U][256U] = CRC32_SLICES.m_table;
+
+	uint32_t crc = 0xFFFFFFFFU;
+
+	unsigned int i = 0U;
+	for (; (i + 4U) <= length; i += 4U) {
+		uint32_t x = crc ^ (in[i + 0U] | (in[i + 1U] << 8) | (in[i + 2U] << 16) | (uint32_t(in[i + 3U]) << 24));
+		crc = t[3U][x & 0xFFU] ^ t[2U][(x >> 8) & 0xFFU] ^ t[1U][(x >> 16) & 0xFFU] ^ t[0U][x >> 24];
+	}
+
+	for (; i < length; i++)
+		crc = (crc >> 8) ^ t[0U][(crc ^ in[i]) & 0xFFU];
+
+	return ~crc;
+}
+#endif
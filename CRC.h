@@ -25,8 +25,8 @@ class CCRC
 {
 public:
 #if defined(USE_DMR)
-	static bool checkFiveBit(bool* in, unsigned int tcrc);
-	static void encodeFiveBit(const bool* in, unsigned int& tcrc);
+	static bool checkFiveBit(const unsigned char* in, unsigned int tcrc);
+	static unsigned int encodeFiveBit(const unsigned char* in);
 #endif
 
 #if defined(USE_DSTAR)
@@ -48,6 +48,10 @@ public:
 #if defined(USE_DMR)
 	static unsigned char crc8(const unsigned char* in, unsigned int length);
 #endif
+
+#if defined(USE_DMR) || defined(USE_P25) || defined(USE_NXDN)
+	static unsigned int crc32(const unsigned char* in, unsigned int length);
+#endif
 };
 
 #endif
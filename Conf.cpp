@@ -27,6 +27,14 @@
 
 const int BUFFER_SIZE = 500;
 
+// The DMR gateway probes can't usefully run faster than one voice burst, and one late reply
+// mustn't be enough to fail over
+const unsigned int DMR_MIN_PING_INTERVAL = 60U;
+const unsigned int DMR_MIN_MISSED_PINGS  = 2U;
+
+// A DSCP is six bits
+const int DSCP_MAX = 63;
+
 enum class SECTION {
 	NONE,
 	GENERAL,
@@ -88,6 +96,18 @@ enum class SECTION {
 	REMOTE_CONTROL
 };
 
+// A DSCP outside the six bits is ignored, leaving the socket with its default marking
+static int readDSCP(const char* section, const char* key, const char* value)
+{
+	int dscp = ::atoi(value);
+	if (dscp < 0 || dscp > DSCP_MAX) {
+		LogWarning("The %s %s of %d is not between 0 and %d, ignoring it", section, key, dscp, DSCP_MAX);
+		return -1;
+	}
+
+	return dscp;
+}
+
 CConf::CConf(const std::string& file) :
 m_file(file),
 m_callsign(),
@@ -95,6 +115,7 @@ m_id(0U),
 m_timeout(120U),
 m_duplex(true),
 m_daemon(false),
+m_forceScalar(false),
 m_rxFrequency(0U),
 m_txFrequency(0U),
 m_power(0U),
@@ -215,6 +236,7 @@ m_p25Enabled(false),
 m_p25Id(0U),
 #if defined(USE_P25)
 m_p25NAC(0x293U),
+m_p25RXNACs(),
 m_p25SelfOnly(false),
 m_p25OverrideUID(false),
 m_p25RemoteGateway(false),
@@ -286,6 +308,11 @@ m_dstarLocalPort(0U),
 m_dstarNetworkModeHang(3U),
 #if defined(USE_DSTAR)
 m_dstarNetworkDebug(false),
+m_dstarNetworkRXBufferSize(0U),
+m_dstarNetworkTXBufferSize(0U),
+m_dstarNetworkDSCP(-1),
+m_dstarNetworkKeepAliveDSCP(-1),
+m_dstarNetworkPriority(-1),
 #endif
 #if defined(USE_DMR)
 m_dmrNetworkEnabled(false),
@@ -294,9 +321,17 @@ m_dmrNetworkGatewayPort(0U),
 m_dmrNetworkLocalAddress(),
 m_dmrNetworkLocalPort(0U),
 m_dmrNetworkDebug(false),
+m_dmrNetworkRXBufferSize(0U),
+m_dmrNetworkTXBufferSize(0U),
+m_dmrNetworkDSCP(-1),
+m_dmrNetworkKeepAliveDSCP(-1),
+m_dmrNetworkPriority(-1),
 m_dmrNetworkJitter(360U),
 m_dmrNetworkSlot1(true),
 m_dmrNetworkSlot2(true),
+m_dmrNetworkStandbyGateways(),
+m_dmrNetworkPingInterval(120U),
+m_dmrNetworkMissedPings(3U),
 #endif
 m_dmrNetworkModeHang(3U),
 #if defined(USE_YSF)
@@ -309,6 +344,11 @@ m_fusionNetworkGatewayPort(0U),
 m_fusionNetworkModeHang(3U),
 #if defined(USE_YSF)
 m_fusionNetworkDebug(false),
+m_fusionNetworkRXBufferSize(0U),
+m_fusionNetworkTXBufferSize(0U),
+m_fusionNetworkDSCP(-1),
+m_fusionNetworkKeepAliveDSCP(-1),
+m_fusionNetworkPriority(-1),
 #endif
 #if defined(USE_P25)
 m_p25NetworkEnabled(false),
@@ -320,6 +360,11 @@ m_p25LocalPort(0U),
 m_p25NetworkModeHang(3U),
 #if defined(USE_P25)
 m_p25NetworkDebug(false),
+m_p25NetworkRXBufferSize(0U),
+m_p25NetworkTXBufferSize(0U),
+m_p25NetworkDSCP(-1),
+m_p25NetworkKeepAliveDSCP(-1),
+m_p25NetworkPriority(-1),
 #endif
 #if defined(USE_NXDN)
 m_nxdnNetworkEnabled(false),
@@ -332,6 +377,12 @@ m_nxdnLocalPort(0U),
 m_nxdnNetworkModeHang(3U),
 #if defined(USE_NXDN)
 m_nxdnNetworkDebug(false),
+m_nxdnNetworkRXBufferSize(0U),
+m_nxdnNetworkTXBufferSize(0U),
+m_nxdnNetworkDSCP(-1),
+m_nxdnNetworkKeepAliveDSCP(-1),
+m_nxdnNetworkPriority(-1),
+m_nxdnNetworkReceiverReports(false),
 #endif
 #if defined(USE_POCSAG)
 m_pocsagNetworkEnabled(false),
@@ -352,10 +403,16 @@ m_fmPreEmphasis(true),
 m_fmDeEmphasis(true),
 m_fmTXAudioGain(1.0F),
 m_fmRXAudioGain(1.0F),
+m_fmNetworkEncoding("PCM"),
 #endif
 m_fmNetworkModeHang(3U),
 #if defined(USE_FM)
 m_fmNetworkDebug(false),
+m_fmNetworkRXBufferSize(0U),
+m_fmNetworkTXBufferSize(0U),
+m_fmNetworkDSCP(-1),
+m_fmNetworkKeepAliveDSCP(-1),
+m_fmNetworkPriority(-1),
 #endif
 m_lockFileEnabled(false),
 m_lockFileName(),
@@ -517,6 +574,8 @@ bool CConf::read()
 				m_dstarNetworkModeHang = m_dmrNetworkModeHang = m_fusionNetworkModeHang = m_p25NetworkModeHang = m_nxdnNetworkModeHang = m_fmNetworkModeHang = (unsigned int)::atoi(value);
 			else if (::strcmp(key, "Daemon") == 0)
 				m_daemon = ::atoi(value) == 1;
+			else if (::strcmp(key, "ForceScalar") == 0)
+				m_forceScalar = ::atoi(value) == 1;
 		} else if (section == SECTION::INFO) {
 			if (::strcmp(key, "TXFrequency") == 0)
 				m_pocsagFrequency = m_txFrequency = (unsigned int)::atoi(value);
@@ -836,7 +895,15 @@ bool CConf::read()
 				m_p25Id = (unsigned int)::atoi(value);
 			else if (::strcmp(key, "NAC") == 0)
 				m_p25NAC = (unsigned int)::strtoul(value, nullptr, 16);
-			else if (::strcmp(key, "OverrideUIDCheck") == 0)
+			else if (::strcmp(key, "RXNACs") == 0) {
+				char* p = ::strtok(value, ",\r\n");
+				while (p != nullptr) {
+					unsigned int nac = (unsigned int)::strtoul(p, nullptr, 16);
+					if (nac <= 0xFFFU)
+						m_p25RXNACs.push_back(nac);
+					p = ::strtok(nullptr, ",\r\n");
+				}
+			} else if (::strcmp(key, "OverrideUIDCheck") == 0)
 				m_p25OverrideUID = ::atoi(value) == 1;
 			else if (::strcmp(key, "SelfOnly") == 0)
 				m_p25SelfOnly = ::atoi(value) == 1;
@@ -975,6 +1042,16 @@ bool CConf::read()
 				m_dstarNetworkModeHang = (unsigned int)::atoi(value);
 			else if (::strcmp(key, "Debug") == 0)
 				m_dstarNetworkDebug = ::atoi(value) == 1;
+			else if (::strcmp(key, "RXBufferSize") == 0)
+				m_dstarNetworkRXBufferSize = (unsigned int)::atoi(value);
+			else if (::strcmp(key, "TXBufferSize") == 0)
+				m_dstarNetworkTXBufferSize = (unsigned int)::atoi(value);
+			else if (::strcmp(key, "DSCP") == 0)
+				m_dstarNetworkDSCP = readDSCP("D-Star Network", key, value);
+			else if (::strcmp(key, "KeepAliveDSCP") == 0)
+				m_dstarNetworkKeepAliveDSCP = readDSCP("D-Star Network", key, value);
+			else if (::strcmp(key, "Priority") == 0)
+				m_dstarNetworkPriority = ::atoi(value);
 #endif
 #if defined(USE_DMR)
 		} else if (section == SECTION::DMR_NETWORK) {
@@ -990,6 +1067,16 @@ bool CConf::read()
 				m_dmrNetworkLocalPort = (unsigned short)::atoi(value);
 			else if (::strcmp(key, "Debug") == 0)
 				m_dmrNetworkDebug = ::atoi(value) == 1;
+			else if (::strcmp(key, "RXBufferSize") == 0)
+				m_dmrNetworkRXBufferSize = (unsigned int)::atoi(value);
+			else if (::strcmp(key, "TXBufferSize") == 0)
+				m_dmrNetworkTXBufferSize = (unsigned int)::atoi(value);
+			else if (::strcmp(key, "DSCP") == 0)
+				m_dmrNetworkDSCP = readDSCP("DMR Network", key, value);
+			else if (::strcmp(key, "KeepAliveDSCP") == 0)
+				m_dmrNetworkKeepAliveDSCP = readDSCP("DMR Network", key, value);
+			else if (::strcmp(key, "Priority") == 0)
+				m_dmrNetworkPriority = ::atoi(value);
 			else if (::strcmp(key, "Jitter") == 0)
 				m_dmrNetworkJitter = (unsigned int)::atoi(value);
 			else if (::strcmp(key, "Slot1") == 0)
@@ -998,6 +1085,29 @@ bool CConf::read()
 				m_dmrNetworkSlot2 = ::atoi(value) == 1;
 			else if (::strcmp(key, "ModeHang") == 0)
 				m_dmrNetworkModeHang = (unsigned int)::atoi(value);
+			else if (::strcmp(key, "StandbyGateway") == 0) {
+				char* p1 = ::strtok(value, ",\r\n");
+				char* p2 = ::strtok(nullptr, ",\r\n");
+				if (p1 != nullptr && p2 != nullptr) {
+					unsigned short port = (unsigned short)::atoi(p2);
+					if (port > 0U)
+						m_dmrNetworkStandbyGateways.push_back(std::make_pair(std::string(p1), port));
+				}
+			} else if (::strcmp(key, "PingInterval") == 0) {
+				int interval = ::atoi(value);
+				if (interval < int(DMR_MIN_PING_INTERVAL)) {
+					LogWarning("The DMR Network PingInterval of %d is too short, using %u", interval, DMR_MIN_PING_INTERVAL);
+					interval = int(DMR_MIN_PING_INTERVAL);
+				}
+				m_dmrNetworkPingInterval = (unsigned int)interval;
+			} else if (::strcmp(key, "MissedPings") == 0) {
+				int missed = ::atoi(value);
+				if (missed < int(DMR_MIN_MISSED_PINGS)) {
+					LogWarning("The DMR Network MissedPings of %d is too low, using %u", missed, DMR_MIN_MISSED_PINGS);
+					missed = int(DMR_MIN_MISSED_PINGS);
+				}
+				m_dmrNetworkMissedPings = (unsigned int)missed;
+			}
 #endif
 #if defined(USE_YSF)
 		} else if (section == SECTION::FUSION_NETWORK) {
@@ -1015,6 +1125,16 @@ bool CConf::read()
 				m_fusionNetworkModeHang = (unsigned int)::atoi(value);
 			else if (::strcmp(key, "Debug") == 0)
 				m_fusionNetworkDebug = ::atoi(value) == 1;
+			else if (::strcmp(key, "RXBufferSize") == 0)
+				m_fusionNetworkRXBufferSize = (unsigned int)::atoi(value);
+			else if (::strcmp(key, "TXBufferSize") == 0)
+				m_fusionNetworkTXBufferSize = (unsigned int)::atoi(value);
+			else if (::strcmp(key, "DSCP") == 0)
+				m_fusionNetworkDSCP = readDSCP("System Fusion Network", key, value);
+			else if (::strcmp(key, "KeepAliveDSCP") == 0)
+				m_fusionNetworkKeepAliveDSCP = readDSCP("System Fusion Network", key, value);
+			else if (::strcmp(key, "Priority") == 0)
+				m_fusionNetworkPriority = ::atoi(value);
 #endif
 #if defined(USE_P25)
 		} else if (section == SECTION::P25_NETWORK) {
@@ -1032,6 +1152,16 @@ bool CConf::read()
 				m_p25NetworkModeHang = (unsigned int)::atoi(value);
 			else if (::strcmp(key, "Debug") == 0)
 				m_p25NetworkDebug = ::atoi(value) == 1;
+			else if (::strcmp(key, "RXBufferSize") == 0)
+				m_p25NetworkRXBufferSize = (unsigned int)::atoi(value);
+			else if (::strcmp(key, "TXBufferSize") == 0)
+				m_p25NetworkTXBufferSize = (unsigned int)::atoi(value);
+			else if (::strcmp(key, "DSCP") == 0)
+				m_p25NetworkDSCP = readDSCP("P25 Network", key, value);
+			else if (::strcmp(key, "KeepAliveDSCP") == 0)
+				m_p25NetworkKeepAliveDSCP = readDSCP("P25 Network", key, value);
+			else if (::strcmp(key, "Priority") == 0)
+				m_p25NetworkPriority = ::atoi(value);
 #endif
 #if defined(USE_NXDN)
 		} else if (section == SECTION::NXDN_NETWORK) {
@@ -1051,6 +1181,18 @@ bool CConf::read()
 				m_nxdnNetworkModeHang = (unsigned int)::atoi(value);
 			else if (::strcmp(key, "Debug") == 0)
 				m_nxdnNetworkDebug = ::atoi(value) == 1;
+			else if (::strcmp(key, "RXBufferSize") == 0)
+				m_nxdnNetworkRXBufferSize = (unsigned int)::atoi(value);
+			else if (::strcmp(key, "TXBufferSize") == 0)
+				m_nxdnNetworkTXBufferSize = (unsigned int)::atoi(value);
+			else if (::strcmp(key, "DSCP") == 0)
+				m_nxdnNetworkDSCP = readDSCP("NXDN Network", key, value);
+			else if (::strcmp(key, "KeepAliveDSCP") == 0)
+				m_nxdnNetworkKeepAliveDSCP = readDSCP("NXDN Network", key, value);
+			else if (::strcmp(key, "Priority") == 0)
+				m_nxdnNetworkPriority = ::atoi(value);
+			else if (::strcmp(key, "ReceiverReports") == 0)
+				m_nxdnNetworkReceiverReports = ::atoi(value) == 1;
 #endif
 #if defined(USE_POCSAG)
 		} else if (section == SECTION::POCSAG_NETWORK) {
@@ -1089,10 +1231,22 @@ bool CConf::read()
 				m_fmTXAudioGain = float(::atof(value));
 			else if (::strcmp(key, "RXAudioGain") == 0)
 				m_fmRXAudioGain = float(::atof(value));
+			else if (::strcmp(key, "Encoding") == 0)
+				m_fmNetworkEncoding = value;
 			else if (::strcmp(key, "ModeHang") == 0)
 				m_fmNetworkModeHang = (unsigned int)::atoi(value);
 			else if (::strcmp(key, "Debug") == 0)
 				m_fmNetworkDebug = ::atoi(value) == 1;
+			else if (::strcmp(key, "RXBufferSize") == 0)
+				m_fmNetworkRXBufferSize = (unsigned int)::atoi(value);
+			else if (::strcmp(key, "TXBufferSize") == 0)
+				m_fmNetworkTXBufferSize = (unsigned int)::atoi(value);
+			else if (::strcmp(key, "DSCP") == 0)
+				m_fmNetworkDSCP = readDSCP("FM Network", key, value);
+			else if (::strcmp(key, "KeepAliveDSCP") == 0)
+				m_fmNetworkKeepAliveDSCP = readDSCP("FM Network", key, value);
+			else if (::strcmp(key, "Priority") == 0)
+				m_fmNetworkPriority = ::atoi(value);
 #endif
 		} else if (section == SECTION::LOCK_FILE) {
 			if (::strcmp(key, "Enable") == 0)
@@ -1135,6 +1289,11 @@ bool CConf::getDaemon() const
 	return m_daemon;
 }
 
+bool CConf::getForceScalar() const
+{
+	return m_forceScalar;
+}
+
 unsigned int CConf::getRXFrequency() const
 {
 	return m_rxFrequency;
@@ -1667,6 +1826,11 @@ unsigned int CConf::getP25NAC() const
 	return m_p25NAC;
 }
 
+std::vector<unsigned int> CConf::getP25RXNACs() const
+{
+	return m_p25RXNACs;
+}
+
 bool CConf::getP25OverrideUID() const
 {
 	return m_p25OverrideUID;
@@ -1959,6 +2123,31 @@ bool CConf::getDStarNetworkDebug() const
 {
 	return m_dstarNetworkDebug;
 }
+
+unsigned int CConf::getDStarNetworkRXBufferSize() const
+{
+	return m_dstarNetworkRXBufferSize;
+}
+
+unsigned int CConf::getDStarNetworkTXBufferSize() const
+{
+	return m_dstarNetworkTXBufferSize;
+}
+
+int CConf::getDStarNetworkDSCP() const
+{
+	return m_dstarNetworkDSCP;
+}
+
+int CConf::getDStarNetworkKeepAliveDSCP() const
+{
+	return m_dstarNetworkKeepAliveDSCP;
+}
+
+int CConf::getDStarNetworkPriority() const
+{
+	return m_dstarNetworkPriority;
+}
 #endif
 
 #if defined(USE_DMR)
@@ -1997,6 +2186,31 @@ bool CConf::getDMRNetworkDebug() const
 	return m_dmrNetworkDebug;
 }
 
+unsigned int CConf::getDMRNetworkRXBufferSize() const
+{
+	return m_dmrNetworkRXBufferSize;
+}
+
+unsigned int CConf::getDMRNetworkTXBufferSize() const
+{
+	return m_dmrNetworkTXBufferSize;
+}
+
+int CConf::getDMRNetworkDSCP() const
+{
+	return m_dmrNetworkDSCP;
+}
+
+int CConf::getDMRNetworkKeepAliveDSCP() const
+{
+	return m_dmrNetworkKeepAliveDSCP;
+}
+
+int CConf::getDMRNetworkPriority() const
+{
+	return m_dmrNetworkPriority;
+}
+
 unsigned int CConf::getDMRNetworkJitter() const
 {
 	return m_dmrNetworkJitter;
@@ -2011,6 +2225,21 @@ bool CConf::getDMRNetworkSlot2() const
 {
 	return m_dmrNetworkSlot2;
 }
+
+std::vector<std::pair<std::string, unsigned short>> CConf::getDMRNetworkStandbyGateways() const
+{
+	return m_dmrNetworkStandbyGateways;
+}
+
+unsigned int CConf::getDMRNetworkPingInterval() const
+{
+	return m_dmrNetworkPingInterval;
+}
+
+unsigned int CConf::getDMRNetworkMissedPings() const
+{
+	return m_dmrNetworkMissedPings;
+}
 #endif
 
 #if defined(USE_YSF)
@@ -2048,6 +2277,31 @@ bool CConf::getFusionNetworkDebug() const
 {
 	return m_fusionNetworkDebug;
 }
+
+unsigned int CConf::getFusionNetworkRXBufferSize() const
+{
+	return m_fusionNetworkRXBufferSize;
+}
+
+unsigned int CConf::getFusionNetworkTXBufferSize() const
+{
+	return m_fusionNetworkTXBufferSize;
+}
+
+int CConf::getFusionNetworkDSCP() const
+{
+	return m_fusionNetworkDSCP;
+}
+
+int CConf::getFusionNetworkKeepAliveDSCP() const
+{
+	return m_fusionNetworkKeepAliveDSCP;
+}
+
+int CConf::getFusionNetworkPriority() const
+{
+	return m_fusionNetworkPriority;
+}
 #endif
 
 #if defined(USE_P25)
@@ -2085,6 +2339,31 @@ bool CConf::getP25NetworkDebug() const
 {
 	return m_p25NetworkDebug;
 }
+
+unsigned int CConf::getP25NetworkRXBufferSize() const
+{
+	return m_p25NetworkRXBufferSize;
+}
+
+unsigned int CConf::getP25NetworkTXBufferSize() const
+{
+	return m_p25NetworkTXBufferSize;
+}
+
+int CConf::getP25NetworkDSCP() const
+{
+	return m_p25NetworkDSCP;
+}
+
+int CConf::getP25NetworkKeepAliveDSCP() const
+{
+	return m_p25NetworkKeepAliveDSCP;
+}
+
+int CConf::getP25NetworkPriority() const
+{
+	return m_p25NetworkPriority;
+}
 #endif
 
 #if defined(USE_NXDN)
@@ -2127,6 +2406,36 @@ bool CConf::getNXDNNetworkDebug() const
 {
 	return m_nxdnNetworkDebug;
 }
+
+unsigned int CConf::getNXDNNetworkRXBufferSize() const
+{
+	return m_nxdnNetworkRXBufferSize;
+}
+
+unsigned int CConf::getNXDNNetworkTXBufferSize() const
+{
+	return m_nxdnNetworkTXBufferSize;
+}
+
+int CConf::getNXDNNetworkDSCP() const
+{
+	return m_nxdnNetworkDSCP;
+}
+
+int CConf::getNXDNNetworkKeepAliveDSCP() const
+{
+	return m_nxdnNetworkKeepAliveDSCP;
+}
+
+int CConf::getNXDNNetworkPriority() const
+{
+	return m_nxdnNetworkPriority;
+}
+
+bool CConf::getNXDNNetworkReceiverReports() const
+{
+	return m_nxdnNetworkReceiverReports;
+}
 #endif
 
 #if defined(USE_POCSAG)
@@ -2212,6 +2521,11 @@ float CConf::getFMRXAudioGain() const
 	return m_fmRXAudioGain;
 }
 
+std::string CConf::getFMNetworkEncoding() const
+{
+	return m_fmNetworkEncoding;
+}
+
 unsigned int CConf::getFMNetworkModeHang() const
 {
 	return m_fmNetworkModeHang;
@@ -2221,6 +2535,31 @@ bool CConf::getFMNetworkDebug() const
 {
 	return m_fmNetworkDebug;
 }
+
+unsigned int CConf::getFMNetworkRXBufferSize() const
+{
+	return m_fmNetworkRXBufferSize;
+}
+
+unsigned int CConf::getFMNetworkTXBufferSize() const
+{
+	return m_fmNetworkTXBufferSize;
+}
+
+int CConf::getFMNetworkDSCP() const
+{
+	return m_fmNetworkDSCP;
+}
+
+int CConf::getFMNetworkKeepAliveDSCP() const
+{
+	return m_fmNetworkKeepAliveDSCP;
+}
+
+int CConf::getFMNetworkPriority() const
+{
+	return m_fmNetworkPriority;
+}
 #endif
 
 bool CConf::getLockFileEnabled() const
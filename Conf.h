@@ -21,6 +21,7 @@
 
 #include <string>
 #include <vector>
+#include <utility>
 
 #include <cstdint>
 
@@ -38,6 +39,7 @@ public:
 	unsigned int getTimeout() const;
 	bool         getDuplex() const;
 	bool         getDaemon() const;
+	bool         getForceScalar() const;
 
 	// The Info section
 	unsigned int getRXFrequency() const;
@@ -190,6 +192,7 @@ public:
 	bool         getP25Enabled() const;
 	unsigned int getP25Id() const;
 	unsigned int getP25NAC() const;
+	std::vector<unsigned int> getP25RXNACs() const;
 	bool         getP25SelfOnly() const;
 	bool         getP25OverrideUID() const;
 	bool         getP25RemoteGateway() const;
@@ -263,6 +266,11 @@ public:
 	unsigned short getDStarLocalPort() const;
 	unsigned int getDStarNetworkModeHang() const;
 	bool         getDStarNetworkDebug() const;
+	unsigned int getDStarNetworkRXBufferSize() const;
+	unsigned int getDStarNetworkTXBufferSize() const;
+	int          getDStarNetworkDSCP() const;
+	int          getDStarNetworkKeepAliveDSCP() const;
+	int          getDStarNetworkPriority() const;
 #endif
 
 #if defined(USE_DMR)
@@ -273,10 +281,18 @@ public:
 	std::string  getDMRNetworkLocalAddress() const;
 	unsigned short getDMRNetworkLocalPort() const;
 	bool         getDMRNetworkDebug() const;
+	unsigned int getDMRNetworkRXBufferSize() const;
+	unsigned int getDMRNetworkTXBufferSize() const;
+	int          getDMRNetworkDSCP() const;
+	int          getDMRNetworkKeepAliveDSCP() const;
+	int          getDMRNetworkPriority() const;
 	unsigned int getDMRNetworkJitter() const;
 	bool         getDMRNetworkSlot1() const;
 	bool         getDMRNetworkSlot2() const;
 	unsigned int getDMRNetworkModeHang() const;
+	std::vector<std::pair<std::string, unsigned short>> getDMRNetworkStandbyGateways() const;
+	unsigned int getDMRNetworkPingInterval() const;
+	unsigned int getDMRNetworkMissedPings() const;
 #endif
 
 #if defined(USE_YSF)
@@ -288,6 +304,11 @@ public:
 	unsigned short getFusionNetworkGatewayPort() const;
 	unsigned int getFusionNetworkModeHang() const;
 	bool         getFusionNetworkDebug() const;
+	unsigned int getFusionNetworkRXBufferSize() const;
+	unsigned int getFusionNetworkTXBufferSize() const;
+	int          getFusionNetworkDSCP() const;
+	int          getFusionNetworkKeepAliveDSCP() const;
+	int          getFusionNetworkPriority() const;
 #endif
 
 #if defined(USE_P25)
@@ -299,6 +320,11 @@ public:
 	unsigned short getP25LocalPort() const;
 	unsigned int getP25NetworkModeHang() const;
 	bool         getP25NetworkDebug() const;
+	unsigned int getP25NetworkRXBufferSize() const;
+	unsigned int getP25NetworkTXBufferSize() const;
+	int          getP25NetworkDSCP() const;
+	int          getP25NetworkKeepAliveDSCP() const;
+	int          getP25NetworkPriority() const;
 #endif
 
 #if defined(USE_NXDN)
@@ -311,6 +337,12 @@ public:
 	unsigned short getNXDNLocalPort() const;
 	unsigned int getNXDNNetworkModeHang() const;
 	bool         getNXDNNetworkDebug() const;
+	unsigned int getNXDNNetworkRXBufferSize() const;
+	unsigned int getNXDNNetworkTXBufferSize() const;
+	int          getNXDNNetworkDSCP() const;
+	int          getNXDNNetworkKeepAliveDSCP() const;
+	int          getNXDNNetworkPriority() const;
+	bool         getNXDNNetworkReceiverReports() const;
 #endif
 
 #if defined(USE_POCSAG)
@@ -335,8 +367,14 @@ public:
 	bool         getFMDeEmphasis() const;
 	float        getFMTXAudioGain() const;
 	float        getFMRXAudioGain() const;
+	std::string  getFMNetworkEncoding() const;
 	unsigned int getFMNetworkModeHang() const;
 	bool         getFMNetworkDebug() const;
+	unsigned int getFMNetworkRXBufferSize() const;
+	unsigned int getFMNetworkTXBufferSize() const;
+	int          getFMNetworkDSCP() const;
+	int          getFMNetworkKeepAliveDSCP() const;
+	int          getFMNetworkPriority() const;
 #endif
 
 	// The Lock File section
@@ -353,6 +391,7 @@ private:
 	unsigned int m_timeout;
 	bool         m_duplex;
 	bool         m_daemon;
+	bool         m_forceScalar;
 
 	unsigned int m_rxFrequency;
 	unsigned int m_txFrequency;
@@ -485,6 +524,7 @@ private:
 	unsigned int m_p25Id;
 #if defined(USE_P25)
 	unsigned int m_p25NAC;
+	std::vector<unsigned int> m_p25RXNACs;
 	bool         m_p25SelfOnly;
 	bool         m_p25OverrideUID;
 	bool         m_p25RemoteGateway;
@@ -560,6 +600,11 @@ private:
 	unsigned int m_dstarNetworkModeHang;
 #if defined(USE_DSTAR)
 	bool         m_dstarNetworkDebug;
+	unsigned int m_dstarNetworkRXBufferSize;
+	unsigned int m_dstarNetworkTXBufferSize;
+	int          m_dstarNetworkDSCP;
+	int          m_dstarNetworkKeepAliveDSCP;
+	int          m_dstarNetworkPriority;
 #endif
 
 #if defined(USE_DMR)
@@ -569,9 +614,17 @@ private:
 	std::string  m_dmrNetworkLocalAddress;
 	unsigned short m_dmrNetworkLocalPort;
 	bool         m_dmrNetworkDebug;
+	unsigned int m_dmrNetworkRXBufferSize;
+	unsigned int m_dmrNetworkTXBufferSize;
+	int          m_dmrNetworkDSCP;
+	int          m_dmrNetworkKeepAliveDSCP;
+	int          m_dmrNetworkPriority;
 	unsigned int m_dmrNetworkJitter;
 	bool         m_dmrNetworkSlot1;
 	bool         m_dmrNetworkSlot2;
+	std::vector<std::pair<std::string, unsigned short>> m_dmrNetworkStandbyGateways;
+	unsigned int m_dmrNetworkPingInterval;
+	unsigned int m_dmrNetworkMissedPings;
 #endif
 	unsigned int m_dmrNetworkModeHang;
 
@@ -585,6 +638,11 @@ private:
 	unsigned int m_fusionNetworkModeHang;
 #if defined(USE_YSF)
 	bool         m_fusionNetworkDebug;
+	unsigned int m_fusionNetworkRXBufferSize;
+	unsigned int m_fusionNetworkTXBufferSize;
+	int          m_fusionNetworkDSCP;
+	int          m_fusionNetworkKeepAliveDSCP;
+	int          m_fusionNetworkPriority;
 #endif
 
 #if defined(USE_P25)
@@ -597,6 +655,11 @@ private:
 	unsigned int m_p25NetworkModeHang;
 #if defined(USE_P25)
 	bool         m_p25NetworkDebug;
+	unsigned int m_p25NetworkRXBufferSize;
+	unsigned int m_p25NetworkTXBufferSize;
+	int          m_p25NetworkDSCP;
+	int          m_p25NetworkKeepAliveDSCP;
+	int          m_p25NetworkPriority;
 #endif
 
 #if defined(USE_NXDN)
@@ -610,6 +673,12 @@ private:
 	unsigned int m_nxdnNetworkModeHang;
 #if defined(USE_NXDN)
 	bool         m_nxdnNetworkDebug;
+	unsigned int m_nxdnNetworkRXBufferSize;
+	unsigned int m_nxdnNetworkTXBufferSize;
+	int          m_nxdnNetworkDSCP;
+	int          m_nxdnNetworkKeepAliveDSCP;
+	int          m_nxdnNetworkPriority;
+	bool         m_nxdnNetworkReceiverReports;
 #endif
 
 #if defined(USE_POCSAG)
@@ -632,10 +701,16 @@ private:
 	bool         m_fmDeEmphasis;
 	float        m_fmTXAudioGain;
 	float        m_fmRXAudioGain;
+	std::string  m_fmNetworkEncoding;
 #endif
 	unsigned int m_fmNetworkModeHang;
 #if defined(USE_FM)
 	bool         m_fmNetworkDebug;
+	unsigned int m_fmNetworkRXBufferSize;
+	unsigned int m_fmNetworkTXBufferSize;
+	int          m_fmNetworkDSCP;
+	int          m_fmNetworkKeepAliveDSCP;
+	int          m_fmNetworkPriority;
 #endif
 
 	bool         m_lockFileEnabled;
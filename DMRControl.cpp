@@ -63,15 +63,15 @@ bool CDMRControl::processWakeup(const unsigned char* data)
 		return false;
 
 	unsigned int srcId = csbk.getSrcId();
-	std::string src = m_lookup->find(srcId);
+	CUserDBView src = m_lookup->find(srcId);
 
 	bool ret = CDMRAccessControl::validateSrcId(srcId);
 	if (!ret) {
-		LogMessage("Invalid Downlink Activate received from %s", src.c_str());
+		LogMessage("Invalid Downlink Activate received from %s", src.getCallsign().data());
 		return false;
 	}
 
-	LogMessage("Downlink Activate received from %s", src.c_str());
+	LogMessage("Downlink Activate received from %s", src.getCallsign().data());
 
 	return true;
 }
@@ -18,7 +18,6 @@
 
 #include "DMREmbeddedData.h"
 #include "Hamming.h"
-#include "Utils.h"
 #include "CRC.h"
 
 #if defined(USE_DMR)
@@ -27,21 +26,21 @@
 #include <cassert>
 #include <cstring>
 
+/*
+ * The 128 bits of the embedded LC are sent down the columns of an eight row by sixteen
+ * column matrix, so each byte of m_raw is one column with row 0 in the top bit.
+ */
 CDMREmbeddedData::CDMREmbeddedData() :
-m_raw(nullptr),
+m_raw(),
 m_state(LC_STATE::NONE),
-m_data(nullptr),
+m_data(),
 m_FLCO(FLCO::GROUP),
 m_valid(false)
 {
-	m_raw  = new bool[128U];
-	m_data = new bool[72U];
 }
 
 CDMREmbeddedData::~CDMREmbeddedData()
 {
-	delete[] m_raw;
-	delete[] m_data;
 }
 
 // Add LC data (which may consist of 4 blocks) to the data store
@@ -49,17 +48,14 @@ bool CDMREmbeddedData::addData(const unsigned char* data, unsigned char lcss)
 {
 	assert(data != nullptr);
 
-	bool rawData[40U];
-	CUtils::byteToBitsBE(data[14U], rawData + 0U);
-	CUtils::byteToBitsBE(data[15U], rawData + 8U);
-	CUtils::byteToBitsBE(data[16U], rawData + 16U);
-	CUtils::byteToBitsBE(data[17U], rawData + 24U);
-	CUtils::byteToBitsBE(data[18U], rawData + 32U);
+	// The 32 bits of the block sit between the two halves of the EMB
+	unsigned char rawData[4U];
+	for (unsigned int i = 0U; i < 4U; i++)
+		rawData[i] = (data[14U + i] << 4) | (data[15U + i] >> 4);
 
 	// Is this the first block of a 4 block embedded LC ?
 	if (lcss == 1U) {
-		for (unsigned int a = 0U; a < 32U; a++)
-			m_raw[a] = rawData[a + 4U];
+		::memcpy(m_raw + 0U, rawData, 4U);
 
 		// Show we are ready for the next LC block
 		m_state = LC_STATE::FIRST;
@@ -70,8 +66,7 @@ bool CDMREmbeddedData::addData(const unsigned char* data, unsigned char lcss)
 
 	// Is this the 2nd block of a 4 block embedded LC ?
 	if ((lcss == 3U) && (m_state == LC_STATE::FIRST)) {
-		for (unsigned int a = 0U; a < 32U; a++)
-			m_raw[a + 32U] = rawData[a + 4U];
+		::memcpy(m_raw + 4U, rawData, 4U);
 
 		// Show we are ready for the next LC block
 		m_state = LC_STATE::SECOND;
@@ -81,8 +76,7 @@ bool CDMREmbeddedData::addData(const unsigned char* data, unsigned char lcss)
 
 	// Is this the 3rd block of a 4 block embedded LC ?
 	if ((lcss == 3U) && (m_state == LC_STATE::SECOND)) {
-		for (unsigned int a = 0U; a < 32U; a++)
-			m_raw[a + 64U] = rawData[a + 4U];
+		::memcpy(m_raw + 8U, rawData, 4U);
 
 		// Show we are ready for the final LC block
 		m_state = LC_STATE::THIRD;
@@ -92,8 +86,7 @@ bool CDMREmbeddedData::addData(const unsigned char* data, unsigned char lcss)
 
 	// Is this the final block of a 4 block embedded LC ?
 	if ((lcss == 2U) && (m_state == LC_STATE::THIRD))	{
-		for (unsigned int a = 0U; a < 32U; a++)
-			m_raw[a + 96U] = rawData[a + 4U];
+		::memcpy(m_raw + 12U, rawData, 4U);
 
 		// Show that we're not ready for any more data
 		m_state = LC_STATE::NONE;
@@ -121,49 +114,35 @@ void CDMREmbeddedData::setLC(const CDMRLC& lc)
 
 void CDMREmbeddedData::encodeEmbeddedData()
 {
-	unsigned int crc;
-	CCRC::encodeFiveBit(m_data, crc);
-
-	bool data[128U];
-	::memset(data, 0x00U, 128U * sizeof(bool));
+	unsigned int crc = CCRC::encodeFiveBit(m_data);
 
-	data[106U] = (crc & 0x01U) == 0x01U;
-	data[90U]  = (crc & 0x02U) == 0x02U;
-	data[74U]  = (crc & 0x04U) == 0x04U;
-	data[58U]  = (crc & 0x08U) == 0x08U;
-	data[42U]  = (crc & 0x10U) == 0x10U;
+	// The first two rows carry eleven bits of data, the next five carry ten and a bit of the CRC
+	unsigned int rows[8U];
 
 	unsigned int b = 0U;
-	for (unsigned int a = 0U; a < 11U; a++, b++)
-		data[a] = m_data[b];
-	for (unsigned int a = 16U; a < 27U; a++, b++)
-		data[a] = m_data[b];
-	for (unsigned int a = 32U; a < 42U; a++, b++)
-		data[a] = m_data[b];
-	for (unsigned int a = 48U; a < 58U; a++, b++)
-		data[a] = m_data[b];
-	for (unsigned int a = 64U; a < 74U; a++, b++)
-		data[a] = m_data[b];
-	for (unsigned int a = 80U; a < 90U; a++, b++)
-		data[a] = m_data[b];
-	for (unsigned int a = 96U; a < 106U; a++, b++)
-		data[a] = m_data[b];
+	for (unsigned int r = 0U; r < 7U; r++) {
+		unsigned int n = (r < 2U) ? 11U : 10U;
 
-	// Hamming (16,11,4) check each row except the last one
-	for (unsigned int a = 0U; a < 112U; a += 16U)
-		CHamming::encode16114(data + a);
+		unsigned int row = 0U;
+		for (unsigned int c = 0U; c < n; c++, b++)
+			row = (row << 1) | ((m_data[b >> 3] >> (7U - (b & 7U))) & 0x01U);
+
+		if (r >= 2U)
+			row = (row << 1) | ((crc >> (6U - r)) & 0x01U);
+
+		// Hamming (16,11,4) check each row except the last one
+		rows[r] = CHamming::encode16114(row);
+	}
 
 	// Add the parity bits for each column
-	for (unsigned int a = 0U; a < 16U; a++)
-		data[a + 112U] = data[a + 0U] ^ data[a + 16U] ^ data[a + 32U] ^ data[a + 48U] ^ data[a + 64U] ^ data[a + 80U] ^ data[a + 96U];
+	rows[7U] = rows[0U] ^ rows[1U] ^ rows[2U] ^ rows[3U] ^ rows[4U] ^ rows[5U] ^ rows[6U];
 
 	// The data is packed downwards in columns
-	b = 0U;
-	for (unsigned int a = 0U; a < 128U; a++) {
-		m_raw[a] = data[b];
-		b += 16U;
-		if (b > 127U)
-			b -= 127U;
+	for (unsigned int c = 0U; c < 16U; c++) {
+		unsigned int col = 0U;
+		for (unsigned int r = 0U; r < 8U; r++)
+			col = (col << 1) | ((rows[r] >> (15U - c)) & 0x01U);
+		m_raw[c] = col;
 	}
 }
 
@@ -174,22 +153,13 @@ unsigned char CDMREmbeddedData::getData(unsigned char* data, unsigned char n) co
 	if (n >= 1U && n < 5U) {
 		n--;
 
-		bool bits[40U];
-		::memset(bits, 0x00U, 40U * sizeof(bool));
-		::memcpy(bits + 4U, m_raw + n * 32U, 32U * sizeof(bool));
+		const unsigned char* bytes = m_raw + n * 4U;
 
-		unsigned char bytes[5U];
-		CUtils::bitsToByteBE(bits + 0U,  bytes[0U]);
-		CUtils::bitsToByteBE(bits + 8U,  bytes[1U]);
-		CUtils::bitsToByteBE(bits + 16U, bytes[2U]);
-		CUtils::bitsToByteBE(bits + 24U, bytes[3U]);
-		CUtils::bitsToByteBE(bits + 32U, bytes[4U]);
-
-		data[14U] = (data[14U] & 0xF0U) | (bytes[0U] & 0x0FU);
-		data[15U] = bytes[1U];
-		data[16U] = bytes[2U];
-		data[17U] = bytes[3U];
-		data[18U] = (data[18U] & 0x0FU) | (bytes[4U] & 0xF0U);
+		data[14U] = (data[14U] & 0xF0U) | (bytes[0U] >> 4);
+		data[15U] = (bytes[0U] << 4) | (bytes[1U] >> 4);
+		data[16U] = (bytes[1U] << 4) | (bytes[2U] >> 4);
+		data[17U] = (bytes[2U] << 4) | (bytes[3U] >> 4);
+		data[18U] = (data[18U] & 0x0FU) | (bytes[3U] << 4);
 
 		switch (n) {
 		case 0U:
@@ -214,54 +184,37 @@ unsigned char CDMREmbeddedData::getData(unsigned char* data, unsigned char n) co
 void CDMREmbeddedData::decodeEmbeddedData()
 {
 	// The data is unpacked downwards in columns
-	bool data[128U];
-	::memset(data, 0x00U, 128U * sizeof(bool));
-
-	unsigned int b = 0U;
-	for (unsigned int a = 0U; a < 128U; a++) {
-		data[b] = m_raw[a];
-		b += 16U;
-		if (b > 127U)
-			b -= 127U;
+	unsigned int rows[8U] = {0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U};
+	for (unsigned int c = 0U; c < 16U; c++) {
+		for (unsigned int r = 0U; r < 8U; r++)
+			rows[r] |= ((m_raw[c] >> (7U - r)) & 0x01U) << (15U - c);
 	}
 
 	// Hamming (16,11,4) check each row except the last one
-	for (unsigned int a = 0U; a < 112U; a += 16U) {
-		if (!CHamming::decode16114(data + a))
+	for (unsigned int r = 0U; r < 7U; r++) {
+		if (!CHamming::decode16114(rows[r]))
 			return;
 	}
 
 	// Check the parity bits
-	for (unsigned int a = 0U; a < 16U; a++) {
-		bool parity = data[a + 0U] ^ data[a + 16U] ^ data[a + 32U] ^ data[a + 48U] ^ data[a + 64U] ^ data[a + 80U] ^ data[a + 96U] ^ data[a + 112U];
-		if (parity)
-			return;
-	}
+	if ((rows[0U] ^ rows[1U] ^ rows[2U] ^ rows[3U] ^ rows[4U] ^ rows[5U] ^ rows[6U] ^ rows[7U]) != 0U)
+		return;
+
+	// We have passed the Hamming check so extract the actual payload and the 5 bit CRC
+	::memset(m_data, 0x00U, 9U);
 
-	// We have passed the Hamming check so extract the actual payload
-	b = 0U;
-	for (unsigned int a = 0U; a < 11U; a++, b++)
-		m_data[b] = data[a];
-	for (unsigned int a = 16U; a < 27U; a++, b++)
-		m_data[b] = data[a];
-	for (unsigned int a = 32U; a < 42U; a++, b++)
-		m_data[b] = data[a];
-	for (unsigned int a = 48U; a < 58U; a++, b++)
-		m_data[b] = data[a];
-	for (unsigned int a = 64U; a < 74U; a++, b++)
-		m_data[b] = data[a];
-	for (unsigned int a = 80U; a < 90U; a++, b++)
-		m_data[b] = data[a];
-	for (unsigned int a = 96U; a < 106U; a++, b++)
-		m_data[b] = data[a];
-
-	// Extract the 5 bit CRC
 	unsigned int crc = 0U;
-	if (data[42])  crc += 16U;
-	if (data[58])  crc += 8U;
-	if (data[74])  crc += 4U;
-	if (data[90])  crc += 2U;
-	if (data[106]) crc += 1U;
+	unsigned int b = 0U;
+	for (unsigned int r = 0U; r < 7U; r++) {
+		unsigned int n = (r < 2U) ? 11U : 10U;
+		for (unsigned int c = 0U; c < n; c++, b++) {
+			if ((rows[r] & (0x8000U >> c)) != 0U)
+				m_data[b >> 3] |= 0x80U >> (b & 7U);
+		}
+
+		if (r >= 2U)
+			crc = (crc << 1) | ((rows[r] >> 5) & 0x01U);
+	}
 
 	// Now CRC check this
 	if (!CCRC::checkFiveBit(m_data, crc))
@@ -270,9 +223,7 @@ void CDMREmbeddedData::decodeEmbeddedData()
 	m_valid = true;
 
 	// Extract the FLCO
-	unsigned char flco;
-	CUtils::bitsToByteBE(m_data + 0U, flco);
-	m_FLCO = FLCO(flco & 0x3FU);
+	m_FLCO = FLCO(m_data[0U] & 0x3FU);
 }
 
 CDMRLC* CDMREmbeddedData::getLC() const
@@ -309,15 +260,7 @@ bool CDMREmbeddedData::getRawData(unsigned char* data) const
 	if (!m_valid)
 		return false;
 
-	CUtils::bitsToByteBE(m_data + 0U,  data[0U]);
-	CUtils::bitsToByteBE(m_data + 8U,  data[1U]);
-	CUtils::bitsToByteBE(m_data + 16U, data[2U]);
-	CUtils::bitsToByteBE(m_data + 24U, data[3U]);
-	CUtils::bitsToByteBE(m_data + 32U, data[4U]);
-	CUtils::bitsToByteBE(m_data + 40U, data[5U]);
-	CUtils::bitsToByteBE(m_data + 48U, data[6U]);
-	CUtils::bitsToByteBE(m_data + 56U, data[7U]);
-	CUtils::bitsToByteBE(m_data + 64U, data[8U]);
+	::memcpy(data, m_data, 9U);
 
 	return true;
 }
@@ -53,11 +53,11 @@ public:
 	void reset();
 
 private:
-	bool*        m_raw;
-	LC_STATE     m_state;
-	bool*        m_data;
-	FLCO         m_FLCO;
-	bool         m_valid;
+	unsigned char m_raw[16U];
+	LC_STATE      m_state;
+	unsigned char m_data[9U];
+	FLCO          m_FLCO;
+	bool          m_valid;
 
 	void decodeEmbeddedData();
 	void encodeEmbeddedData();
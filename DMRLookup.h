@@ -38,8 +38,7 @@ public:
 
 	virtual void entry();
 
-	std::string find(unsigned int id);
-	void findWithName(unsigned int id, class CUserDBentry *entry);
+	CUserDBView find(unsigned int id);
 
 	bool exists(unsigned int id);
 
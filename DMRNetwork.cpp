@@ -33,10 +33,8 @@ const unsigned int HOMEBREW_DATA_PACKET_LENGTH = 55U;
 
 
 CDMRNetwork::CDMRNetwork(const std::string& address, unsigned short port, const std::string& localAddress, unsigned short localPort, unsigned int id, bool duplex, const char* version, bool slot1, bool slot2, HW_TYPE hwType, bool debug) :
-m_addressStr(address),
-m_addr(),
-m_addrLen(0U),
-m_port(port),
+m_gateways(),
+m_active(0U),
 m_id(nullptr),
 m_duplex(duplex),
 m_version(version),
@@ -48,6 +46,8 @@ m_slot2(slot2),
 m_hwType(hwType),
 m_buffer(nullptr),
 m_streamId(nullptr),
+m_header(nullptr),
+m_streamActive(nullptr),
 m_rxData(1000U, "DMR Network"),
 m_beacon(false),
 m_random(),
@@ -56,18 +56,34 @@ m_rxFrequency(0U),
 m_txFrequency(0U),
 m_power(0U),
 m_colorCode(0U),
-m_pingTimer(1000U, 10U)
+m_pingTimer(1000U, 10U),
+m_probeTimer(1000U),
+m_missedPings(0U)
 {
 	assert(!address.empty());
 	assert(port > 0U);
 	assert(id > 1000U);
 
-	if (CUDPSocket::lookup(m_addressStr, m_port, m_addr, m_addrLen) != 0)
-		m_addrLen = 0U;
+	DMRGateway gateway;
+	gateway.m_addressStr = address;
+	gateway.m_port       = port;
+	gateway.m_heard      = false;
+	gateway.m_missed     = 0U;
+	gateway.m_replies    = 0U;
 
-	m_buffer   = new unsigned char[BUFFER_LENGTH];
-	m_id       = new uint8_t[4U];
-	m_streamId = new uint32_t[2U];
+	if (CUDPSocket::lookup(gateway.m_addressStr, gateway.m_port, gateway.m_addr, gateway.m_addrLen) != 0)
+		gateway.m_addrLen = 0U;
+
+	m_gateways.push_back(gateway);
+
+	m_buffer       = new unsigned char[BUFFER_LENGTH];
+	m_id           = new uint8_t[4U];
+	m_streamId     = new uint32_t[2U];
+	m_header       = new unsigned char[2U * HOMEBREW_DATA_PACKET_LENGTH];
+	m_streamActive = new bool[2U];
+
+	m_streamActive[0U] = false;
+	m_streamActive[1U] = false;
 
 	m_id[0U] = id >> 24;
 	m_id[1U] = id >> 16;
@@ -87,6 +103,8 @@ CDMRNetwork::~CDMRNetwork()
 {
 	delete[] m_buffer;
 	delete[] m_streamId;
+	delete[] m_header;
+	delete[] m_streamActive;
 	delete[] m_id;
 }
 
@@ -99,19 +117,64 @@ void CDMRNetwork::setConfig(const std::string & callsign, unsigned int rxFrequen
 	m_colorCode   = colorCode;
 }
 
+void CDMRNetwork::addStandby(const std::string& address, unsigned short port)
+{
+	assert(!address.empty());
+	assert(port > 0U);
+
+	DMRGateway gateway;
+	gateway.m_addressStr = address;
+	gateway.m_port       = port;
+	gateway.m_heard      = false;
+	gateway.m_missed     = 0U;
+	gateway.m_replies    = 0U;
+
+	if (CUDPSocket::lookup(gateway.m_addressStr, gateway.m_port, gateway.m_addr, gateway.m_addrLen) != 0) {
+		LogWarning("DMR, unable to resolve the address of the standby gateway %s:%hu", address.c_str(), port);
+		return;
+	}
+
+	// All of the gateways share the one socket
+	if (m_gateways[0U].m_addrLen > 0U && gateway.m_addr.ss_family != m_gateways[0U].m_addr.ss_family) {
+		LogWarning("DMR, the standby gateway %s:%hu uses a different address family to the primary gateway", address.c_str(), port);
+		return;
+	}
+
+	m_gateways.push_back(gateway);
+}
+
+void CDMRNetwork::setFailover(unsigned int pingInterval, unsigned int missedPings)
+{
+	assert(pingInterval > 0U);
+	assert(missedPings > 0U);
+
+	m_probeTimer.setTimeout(0U, pingInterval);
+	m_missedPings = missedPings;
+}
+
+void CDMRNetwork::setSocketOptions(unsigned int rxBufferSize, unsigned int txBufferSize, int dscp, int keepAliveDSCP, int priority)
+{
+	m_socket.setOptions(rxBufferSize, txBufferSize, dscp, keepAliveDSCP, priority);
+}
+
 bool CDMRNetwork::open()
 {
-	if (m_addrLen == 0U) {
+	if (m_gateways[0U].m_addrLen == 0U) {
 		LogError("Unable to resolve the address of the DMR Network");
 		return false;
 	}
 
 	LogMessage("DMR, Opening DMR Network");
 
-	bool ret = m_socket.open(m_addr);
-	if (ret)
+	bool ret = m_socket.open(m_gateways[0U].m_addr);
+	if (ret) {
 		m_pingTimer.start();
 
+		// Only probe for liveness when there is somewhere to fail over to
+		if (m_gateways.size() > 1U && m_missedPings > 0U)
+			m_probeTimer.start();
+	}
+
 	return ret;
 }
 
@@ -247,6 +310,14 @@ bool CDMRNetwork::write(const CDMRData& data)
 
 	buffer[54U] = data.getRSSI();
 
+	// Remember the header of the current voice stream so that it can be re-homed on a failover
+	if (dataType == DT_VOICE_LC_HEADER) {
+		::memcpy(m_header + slotIndex * HOMEBREW_DATA_PACKET_LENGTH, buffer, HOMEBREW_DATA_PACKET_LENGTH);
+		m_streamActive[slotIndex] = true;
+	} else if (dataType == DT_TERMINATOR_WITH_LC || dataType == DT_CSBK || dataType == DT_DATA_HEADER) {
+		m_streamActive[slotIndex] = false;
+	}
+
 	write(buffer, HOMEBREW_DATA_PACKET_LENGTH);
 
 	return true;
@@ -286,7 +357,16 @@ bool CDMRNetwork::writeTalkerAlias(unsigned int id, unsigned char type, const un
 
 bool CDMRNetwork::isConnected() const
 {
-	return (m_addrLen != 0);
+	const DMRGateway& gateway = m_gateways[m_active];
+
+	if (gateway.m_addrLen == 0U)
+		return false;
+
+	// Without any standby gateways there is no liveness probing
+	if (m_gateways.size() == 1U || m_missedPings == 0U)
+		return true;
+
+	return gateway.m_missed < m_missedPings;
 }
 
 void CDMRNetwork::close(bool sayGoodbye)
@@ -298,42 +378,122 @@ void CDMRNetwork::close(bool sayGoodbye)
 
 void CDMRNetwork::clock(unsigned int ms)
 {
+	// Every gateway is kept registered so that it is ready to take over
 	m_pingTimer.clock(ms);
 	if (m_pingTimer.isRunning() && m_pingTimer.hasExpired()) {
-		writeConfig();
+		for (std::vector<DMRGateway>::const_iterator it = m_gateways.cbegin(); it != m_gateways.cend(); ++it)
+			writeConfig(*it);
 		m_pingTimer.start();
 	}
 
-	sockaddr_storage address;
-	unsigned int addrLen;
-	int length = m_socket.read(m_buffer, BUFFER_LENGTH, address, addrLen);
-	if (length <= 0)
-		return;
+	m_probeTimer.clock(ms);
+	if (m_probeTimer.isRunning() && m_probeTimer.hasExpired()) {
+		probe();
+		m_probeTimer.start();
+	}
 
-	if (!CUDPSocket::match(m_addr, address)) {
-		LogMessage("DMR, packet received from an invalid source");
-		return;
+	// Drain the socket, the probe replies from the standby gateways mustn't hold up the voice
+	for (;;) {
+		sockaddr_storage address;
+		unsigned int addrLen;
+		int length = m_socket.read(m_buffer, BUFFER_LENGTH, address, addrLen);
+		if (length <= 0)
+			return;
+
+		unsigned int index = 0U;
+		while (index < m_gateways.size() && !CUDPSocket::match(m_gateways[index].m_addr, address))
+			index++;
+
+		if (index == m_gateways.size()) {
+			LogMessage("DMR, packet received from an invalid source");
+			continue;
+		}
+
+		m_gateways[index].m_heard = true;
+
+		// The standby gateways are only listened to for liveness
+		if (index != m_active)
+			continue;
+
+		if (m_debug)
+			CUtils::dump(1U, "DMR Network Received", m_buffer, length);
+
+		if (::memcmp(m_buffer, "DMRD", 4U) == 0) {
+			if (m_enabled) {
+				unsigned char len = length;
+				m_rxData.addData(&len, 1U);
+				m_rxData.addData(m_buffer, len);
+			}
+		} else if (::memcmp(m_buffer, "DMRP", 4U) == 0) {
+			;
+		} else if (::memcmp(m_buffer, "DMRB", 4U) == 0) {
+			m_beacon = true;
+		} else {
+			CUtils::dump("DMR, unknown packet from the DMR Network", m_buffer, length);
+		}
 	}
+}
 
-	if (m_debug)
-		CUtils::dump(1U, "DMR Network Received", m_buffer, length);
+void CDMRNetwork::probe()
+{
+	for (std::vector<DMRGateway>::iterator it = m_gateways.begin(); it != m_gateways.end(); ++it) {
+		if ((*it).m_heard) {
+			(*it).m_missed = 0U;
+			(*it).m_replies++;
+		} else {
+			(*it).m_missed++;
+			(*it).m_replies = 0U;
+		}
+
+		(*it).m_heard = false;
+	}
 
-	if (::memcmp(m_buffer, "DMRD", 4U) == 0) {
-		if (m_enabled) {
-			unsigned char len = length;
-			m_rxData.addData(&len, 1U);
-			m_rxData.addData(m_buffer, len);
+	// Fail over to the first healthy gateway if the active one has gone quiet
+	if (m_gateways[m_active].m_missed >= m_missedPings) {
+		for (unsigned int i = 0U; i < m_gateways.size(); i++) {
+			if (i != m_active && m_gateways[i].m_replies > 0U) {
+				failover(i);
+				break;
+			}
+		}
+	}
+
+	// Return to a higher priority gateway once it has been stable for a while
+	for (unsigned int i = 0U; i < m_active; i++) {
+		if (m_gateways[i].m_replies >= m_missedPings) {
+			failover(i);
+			break;
 		}
-	} else if (::memcmp(m_buffer, "DMRP", 4U) == 0) {
-		;
-	} else if (::memcmp(m_buffer, "DMRB", 4U) == 0) {
-		m_beacon = true;
-	} else {
-		CUtils::dump("DMR, unknown packet from the DMR Network", m_buffer, length);
 	}
+
+	for (std::vector<DMRGateway>::const_iterator it = m_gateways.cbegin(); it != m_gateways.cend(); ++it)
+		writePing(*it);
 }
 
-bool CDMRNetwork::writeConfig()
+void CDMRNetwork::failover(unsigned int index)
+{
+	assert(index < m_gateways.size());
+
+	const DMRGateway& from = m_gateways[m_active];
+	const DMRGateway& to   = m_gateways[index];
+
+	LogWarning("DMR, switching from gateway %s:%hu to %s:%hu", from.m_addressStr.c_str(), from.m_port, to.m_addressStr.c_str(), to.m_port);
+
+	m_active = index;
+
+	writeConfig(to);
+	m_pingTimer.start();
+
+	// Re-open any active streams on the new gateway using their existing stream ids
+	for (unsigned int i = 0U; i < 2U; i++) {
+		if (m_streamActive[i]) {
+			LogMessage("DMR, re-homing the stream on slot %u", i + 1U);
+			write(m_header + i * HOMEBREW_DATA_PACKET_LENGTH, HOMEBREW_DATA_PACKET_LENGTH);
+		}
+	}
+}
+
+bool CDMRNetwork::writeConfig(const DMRGateway& gateway)
 {
 	const char* software;
 	char slots = '0';
@@ -417,7 +577,35 @@ bool CDMRNetwork::writeConfig()
 		m_callsign.c_str(), m_rxFrequency, m_txFrequency, power, m_colorCode, slots, m_version,
 		software);
 
-	return write((unsigned char*)buffer, 119U);
+	if (m_debug)
+		CUtils::dump(1U, "DMR Network Transmitted", (unsigned char*)buffer, 119U);
+
+	bool ret = m_socket.writeKeepAlive((unsigned char*)buffer, 119U, gateway.m_addr, gateway.m_addrLen);
+	if (!ret) {
+		LogError("DMR, socket error when writing to the DMR Network");
+		return false;
+	}
+
+	return true;
+}
+
+bool CDMRNetwork::writePing(const DMRGateway& gateway)
+{
+	unsigned char buffer[8U];
+
+	::memcpy(buffer + 0U, "DMRP", 4U);
+	::memcpy(buffer + 4U, m_id, 4U);
+
+	if (m_debug)
+		CUtils::dump(1U, "DMR Network Transmitted", buffer, 8U);
+
+	bool ret = m_socket.writeKeepAlive(buffer, 8U, gateway.m_addr, gateway.m_addrLen);
+	if (!ret) {
+		LogError("DMR, socket error when writing to the DMR Network");
+		return false;
+	}
+
+	return true;
 }
 
 bool CDMRNetwork::wantsBeacon()
@@ -430,6 +618,11 @@ bool CDMRNetwork::wantsBeacon()
 }
 
 bool CDMRNetwork::write(const unsigned char* data, unsigned int length)
+{
+	return write(data, length, m_gateways[m_active]);
+}
+
+bool CDMRNetwork::write(const unsigned char* data, unsigned int length, const DMRGateway& gateway)
 {
 	assert(data != nullptr);
 	assert(length > 0U);
@@ -437,7 +630,7 @@ bool CDMRNetwork::write(const unsigned char* data, unsigned int length)
 	if (m_debug)
 		CUtils::dump(1U, "DMR Network Transmitted", data, length);
 
-	bool ret = m_socket.write(data, length, m_addr, m_addrLen);
+	bool ret = m_socket.write(data, length, gateway.m_addr, gateway.m_addrLen);
 	if (!ret) {
 		LogError("DMR, socket error when writing to the DMR Network");
 		return false;
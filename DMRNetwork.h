@@ -28,9 +28,20 @@
 #if defined(USE_DMR)
 
 #include <string>
+#include <vector>
 #include <cstdint>
 #include <random>
 
+struct DMRGateway {
+	std::string      m_addressStr;
+	unsigned short   m_port;
+	sockaddr_storage m_addr;
+	unsigned int     m_addrLen;
+	bool             m_heard;
+	unsigned int     m_missed;
+	unsigned int     m_replies;
+};
+
 class CDMRNetwork
 {
 public:
@@ -39,6 +50,12 @@ public:
 
 	void setConfig(const std::string& callsign, unsigned int rxFrequency, unsigned int txFrequency, unsigned int power, unsigned int colorCode);
 
+	void addStandby(const std::string& address, unsigned short port);
+
+	void setFailover(unsigned int pingInterval, unsigned int missedPings);
+
+	void setSocketOptions(unsigned int rxBufferSize, unsigned int txBufferSize, int dscp, int keepAliveDSCP, int priority);
+
 	bool open();
 
 	void enable(bool enabled);
@@ -60,10 +77,8 @@ public:
 	void close(bool sayGoodbye);
 
 private: 
-	std::string      m_addressStr;
-	sockaddr_storage m_addr;
-	unsigned int     m_addrLen;
-	unsigned short   m_port;
+	std::vector<DMRGateway> m_gateways;
+	unsigned int     m_active;
 	uint8_t*         m_id;
 	bool             m_duplex;
 	const char*      m_version;
@@ -75,6 +90,8 @@ private:
 	HW_TYPE          m_hwType;
 	unsigned char*   m_buffer;
 	uint32_t*        m_streamId;
+	unsigned char*   m_header;
+	bool*            m_streamActive;
 	CRingBuffer<unsigned char> m_rxData;
 	bool             m_beacon;
 	std::mt19937     m_random;
@@ -84,10 +101,17 @@ private:
 	unsigned int     m_power;
 	unsigned int     m_colorCode;
 	CTimer           m_pingTimer;
+	CTimer           m_probeTimer;
+	unsigned int     m_missedPings;
 
-	bool writeConfig();
+	bool writeConfig(const DMRGateway& gateway);
+	bool writePing(const DMRGateway& gateway);
 
 	bool write(const unsigned char* data, unsigned int length);
+	bool write(const unsigned char* data, unsigned int length, const DMRGateway& gateway);
+
+	void probe();
+	void failover(unsigned int index);
 };
 
 #endif
@@ -18,7 +18,6 @@
 
 #include "DMRShortLC.h"
 #include "Hamming.h"
-#include "Utils.h"
 
 #if defined(USE_DMR)
 
@@ -26,18 +25,18 @@
 #include <cassert>
 #include <cstring>
 
+/*
+ * The de-interleaved block is held as three rows of 17 bits followed by a row of column
+ * parity, column 0 in bit 16. Bit a of the block is sent as bit (a * 4) % 67, so the
+ * transmitted bit i came from (i * 17) % 67, except for the last one which isn't moved.
+ */
 CDMRShortLC::CDMRShortLC() :
-m_rawData(nullptr),
-m_deInterData(nullptr)
+m_rows()
 {
-	m_rawData     = new bool[72U];
-	m_deInterData = new bool[68U];
 }
 
 CDMRShortLC::~CDMRShortLC()
 {
-	delete[] m_rawData;
-	delete[] m_deInterData;
 }
 
 // The main decode function
@@ -46,11 +45,8 @@ bool CDMRShortLC::decode(const unsigned char* in, unsigned char* out)
 	assert(in != nullptr);
 	assert(out != nullptr);
 
-	//  Get the raw binary
-	decodeExtractBinary(in);
-
-	// Deinterleave
-	decodeDeInterleave();
+	//  Get the raw binary and deinterleave it
+	decodeDeInterleave(in);
 
 	// Error check
 	bool ret = decodeErrorCheck();
@@ -75,157 +71,100 @@ void CDMRShortLC::encode(const unsigned char* in, unsigned char* out)
 	// Error check
 	encodeErrorCheck();
 
-	// Deinterleave
-	encodeInterleave();
-
-	//  Get the raw binary
-	encodeExtractBinary(out);
+	// Interleave and write the raw binary
+	encodeInterleave(out);
 }
 
-void CDMRShortLC::decodeExtractBinary(const unsigned char* in)
+// Deinterleave the raw data
+void CDMRShortLC::decodeDeInterleave(const unsigned char* in)
 {
 	assert(in != nullptr);
 
-	CUtils::byteToBitsBE(in[0U], m_rawData + 0U);
-	CUtils::byteToBitsBE(in[1U], m_rawData + 8U);
-	CUtils::byteToBitsBE(in[2U], m_rawData + 16U);
-	CUtils::byteToBitsBE(in[3U], m_rawData + 24U);
-	CUtils::byteToBitsBE(in[4U], m_rawData + 32U);
-	CUtils::byteToBitsBE(in[5U], m_rawData + 40U);
-	CUtils::byteToBitsBE(in[6U], m_rawData + 48U);
-	CUtils::byteToBitsBE(in[7U], m_rawData + 56U);
-	CUtils::byteToBitsBE(in[8U], m_rawData + 64U);
-}
+	unsigned int rows[4U] = {0U, 0U, 0U, 0U};
 
-// Deinterleave the raw data
-void CDMRShortLC::decodeDeInterleave()
-{
-	for (unsigned int i = 0U; i < 68U; i++)
-		m_deInterData[i] = false;
-
-	for (unsigned int a = 0U; a < 67U; a++)	{
-		// Calculate the interleave sequence
-		unsigned int interleaveSequence = (a * 4U) % 67U;
-		// Shuffle the data
-		m_deInterData[a] = m_rawData[interleaveSequence];
+	unsigned int a = 0U;
+	for (unsigned int i = 0U; i < 68U; i++) {
+		unsigned int pos = (i < 67U) ? a : 67U;
+		if ((in[i >> 3] & (0x80U >> (i & 0x07U))) != 0U)
+			rows[pos / 17U] |= 0x10000U >> (pos % 17U);
+
+		a += 17U;
+		if (a >= 67U)
+			a -= 67U;
 	}
 
-	m_deInterData[67U] = m_rawData[67U];
+	for (unsigned int r = 0U; r < 4U; r++)
+		m_rows[r] = rows[r];
 }
-	
+
 // Check each row with a Hamming (17,12,3) code and each column with a parity bit
 bool CDMRShortLC::decodeErrorCheck()
 {
 	// Run through each of the 3 rows containing data
-	CHamming::decode17123(m_deInterData + 0U);
-	CHamming::decode17123(m_deInterData + 17U);
-	CHamming::decode17123(m_deInterData + 34U);
-
-	// Run through each of the 17 columns
-	for (unsigned int c = 0U; c < 17U; c++) {
-		bool bit = m_deInterData[c + 0U] ^ m_deInterData[c + 17U] ^ m_deInterData[c + 34U];
-		if (bit != m_deInterData[c + 51U])
-			return false;
-	}
+	CHamming::decode17123(m_rows[0U]);
+	CHamming::decode17123(m_rows[1U]);
+	CHamming::decode17123(m_rows[2U]);
 
-	return true;
+	// All 17 columns at once
+	return (m_rows[0U] ^ m_rows[1U] ^ m_rows[2U]) == m_rows[3U];
 }
 
-// Extract the 36 bits of payload
+// Extract the 36 bits of payload, twelve from each row
 void CDMRShortLC::decodeExtractData(unsigned char* data) const
 {
 	assert(data != nullptr);
 
-	bool bData[40U];
-
-	for (unsigned int i = 0U; i < 40U; i++)
-		bData[i] = false;
+	unsigned int d0 = m_rows[0U] >> 5;
+	unsigned int d1 = m_rows[1U] >> 5;
+	unsigned int d2 = m_rows[2U] >> 5;
 
-	unsigned int pos = 4U;
-	for (unsigned int a = 0U; a < 12U; a++, pos++)
-		bData[pos] = m_deInterData[a];
-
-	for (unsigned int a = 17U; a < 29U; a++, pos++)
-		bData[pos] = m_deInterData[a];
-
-	for (unsigned int a = 34U; a < 46U; a++, pos++)
-		bData[pos] = m_deInterData[a];
-
-	CUtils::bitsToByteBE(bData + 0U,  data[0U]);
-	CUtils::bitsToByteBE(bData + 8U,  data[1U]);
-	CUtils::bitsToByteBE(bData + 16U, data[2U]);
-	CUtils::bitsToByteBE(bData + 24U, data[3U]);
-	CUtils::bitsToByteBE(bData + 32U, data[4U]);
+	data[0U] = d0 >> 8;
+	data[1U] = d0 & 0xFFU;
+	data[2U] = d1 >> 4;
+	data[3U] = ((d1 << 4) & 0xF0U) | (d2 >> 8);
+	data[4U] = d2 & 0xFFU;
 }
 
-// Extract the 36 bits of payload
-void CDMRShortLC::encodeExtractData(const unsigned char* in) const
+// Insert the 36 bits of payload
+void CDMRShortLC::encodeExtractData(const unsigned char* in)
 {
 	assert(in != nullptr);
 
-	bool bData[40U];
-	CUtils::byteToBitsBE(in[0U], bData + 0U);
-	CUtils::byteToBitsBE(in[1U], bData + 8U);
-	CUtils::byteToBitsBE(in[2U], bData + 16U);
-	CUtils::byteToBitsBE(in[3U], bData + 24U);
-	CUtils::byteToBitsBE(in[4U], bData + 32U);
-
-	for (unsigned int i = 0U; i < 68U; i++)
-		m_deInterData[i] = false;
-
-	unsigned int pos = 4U;
-	for (unsigned int a = 0U; a < 12U; a++, pos++)
-		m_deInterData[a] = bData[pos];
-
-	for (unsigned int a = 17U; a < 29U; a++, pos++)
-		m_deInterData[a] = bData[pos];
-
-	for (unsigned int a = 34U; a < 46U; a++, pos++)
-		m_deInterData[a] = bData[pos];
+	m_rows[0U] = ((in[0U] & 0x0FU) << 8) | in[1U];
+	m_rows[1U] = (in[2U] << 4) | (in[3U] >> 4);
+	m_rows[2U] = ((in[3U] & 0x0FU) << 8) | in[4U];
+	m_rows[3U] = 0U;
 }
 
 // Check each row with a Hamming (17,12,3) code and each column with a parity bit
 void CDMRShortLC::encodeErrorCheck()
 {
 	// Run through each of the 3 rows containing data
-	CHamming::encode17123(m_deInterData + 0U);
-	CHamming::encode17123(m_deInterData + 17U);
-	CHamming::encode17123(m_deInterData + 34U);
+	m_rows[0U] = CHamming::encode17123(m_rows[0U]);
+	m_rows[1U] = CHamming::encode17123(m_rows[1U]);
+	m_rows[2U] = CHamming::encode17123(m_rows[2U]);
 
-	// Run through each of the 17 columns
-	for (unsigned int c = 0U; c < 17U; c++)
-		m_deInterData[c + 51U] = m_deInterData[c + 0U] ^ m_deInterData[c + 17U] ^ m_deInterData[c + 34U];
+	// All 17 columns at once
+	m_rows[3U] = m_rows[0U] ^ m_rows[1U] ^ m_rows[2U];
 }
 
-// Interleave the raw data
-void CDMRShortLC::encodeInterleave()
+// Interleave the data and write the raw binary
+void CDMRShortLC::encodeInterleave(unsigned char* data) const
 {
-	for (unsigned int i = 0U; i < 72U; i++)
-		m_rawData[i] = false;
-
-	for (unsigned int a = 0U; a < 67U; a++)	{
-		// Calculate the interleave sequence
-		unsigned int interleaveSequence = (a * 4U) % 67U;
-		// Unshuffle the data
-		m_rawData[interleaveSequence] = m_deInterData[a];
-	}
+	assert(data != nullptr);
 
-	m_rawData[67U] = m_deInterData[67U];
-}
+	::memset(data, 0x00U, 9U);
 
-void CDMRShortLC::encodeExtractBinary(unsigned char* data)
-{
-	assert(data != nullptr);
+	unsigned int a = 0U;
+	for (unsigned int i = 0U; i < 68U; i++) {
+		unsigned int pos = (i < 67U) ? a : 67U;
+		if ((m_rows[pos / 17U] & (0x10000U >> (pos % 17U))) != 0U)
+			data[i >> 3] |= 0x80U >> (i & 0x07U);
 
-	CUtils::bitsToByteBE(m_rawData + 0U,  data[0U]);
-	CUtils::bitsToByteBE(m_rawData + 8U,  data[1U]);
-	CUtils::bitsToByteBE(m_rawData + 16U, data[2U]);
-	CUtils::bitsToByteBE(m_rawData + 24U, data[3U]);
-	CUtils::bitsToByteBE(m_rawData + 32U, data[4U]);
-	CUtils::bitsToByteBE(m_rawData + 40U, data[5U]);
-	CUtils::bitsToByteBE(m_rawData + 48U, data[6U]);
-	CUtils::bitsToByteBE(m_rawData + 56U, data[7U]);
-	CUtils::bitsToByteBE(m_rawData + 64U, data[8U]);
+		a += 17U;
+		if (a >= 67U)
+			a -= 67U;
+	}
 }
 
 #endif
@@ -151,15 +151,15 @@ bool CDMRSlot::writeModem(unsigned char *data, unsigned int len)
 	if ((data[0U] == TAG_LOST) && (m_rfState == RPT_RF_STATE::AUDIO)) {
 		unsigned int srcId = m_rfLC->getSrcId();
 		unsigned int dstId = m_rfLC->getDstId();
-		std::string src = m_lookup->find(srcId);
-		std::string dst = m_lookup->find(dstId);
+		CUserDBView src = m_lookup->find(srcId);
+		CUserDBView dst = m_lookup->find(dstId);
 		FLCO flco       = m_rfLC->getFLCO();
 
 		if (m_rssi != 0) {
-			LogMessage("DMR Slot %u, RF voice transmission lost from %s to %s%s, %.1f seconds, BER: %.1f%%, RSSI: %d/%d/%d dBm", m_slotNo, src.c_str(), flco == FLCO::GROUP ? "TG " : "", dst.c_str(), float(m_rfFrames) / 16.667F, float(m_rfErrs * 100U) / float(m_rfBits), m_minRSSI, m_maxRSSI, m_aveRSSI / m_rssiCountTotal);
+			LogMessage("DMR Slot %u, RF voice transmission lost from %s to %s%s, %.1f seconds, BER: %.1f%%, RSSI: %d/%d/%d dBm", m_slotNo, src.getCallsign().data(), flco == FLCO::GROUP ? "TG " : "", dst.getCallsign().data(), float(m_rfFrames) / 16.667F, float(m_rfErrs * 100U) / float(m_rfBits), m_minRSSI, m_maxRSSI, m_aveRSSI / m_rssiCountTotal);
 			writeJSONRF("lost", float(m_rfFrames) / 16.667F, float(m_rfErrs * 100U) / float(m_rfBits), m_minRSSI, m_maxRSSI, m_aveRSSI / int(m_rssiCountTotal));
 		} else {
-			LogMessage("DMR Slot %u, RF voice transmission lost from %s to %s%s, %.1f seconds, BER: %.1f%%", m_slotNo, src.c_str(), flco == FLCO::GROUP ? "TG " : "", dst.c_str(), float(m_rfFrames) / 16.667F, float(m_rfErrs * 100U) / float(m_rfBits));
+			LogMessage("DMR Slot %u, RF voice transmission lost from %s to %s%s, %.1f seconds, BER: %.1f%%", m_slotNo, src.getCallsign().data(), flco == FLCO::GROUP ? "TG " : "", dst.getCallsign().data(), float(m_rfFrames) / 16.667F, float(m_rfErrs * 100U) / float(m_rfBits));
 			writeJSONRF("lost", float(m_rfFrames) / 16.667F, float(m_rfErrs * 100U) / float(m_rfBits));
 		}
 
@@ -175,11 +175,11 @@ bool CDMRSlot::writeModem(unsigned char *data, unsigned int len)
 	if ((data[0U] == TAG_LOST) && (m_rfState == RPT_RF_STATE::DATA)) {
 		unsigned int srcId = m_rfLC->getSrcId();
 		unsigned int dstId = m_rfLC->getDstId();
-		std::string src = m_lookup->find(srcId);
-		std::string dst = m_lookup->find(dstId);
+		CUserDBView src = m_lookup->find(srcId);
+		CUserDBView dst = m_lookup->find(dstId);
 		FLCO flco       = m_rfLC->getFLCO();
 
-		LogMessage("DMR Slot %u, RF data transmission lost from %s to %s%s", m_slotNo, src.c_str(), flco == FLCO::GROUP ? "TG " : "", dst.c_str());
+		LogMessage("DMR Slot %u, RF data transmission lost from %s to %s%s", m_slotNo, src.getCallsign().data(), flco == FLCO::GROUP ? "TG " : "", dst.getCallsign().data());
 		writeJSONRF("lost");
 		writeEndRF();
 		return false;
@@ -235,8 +235,8 @@ bool CDMRSlot::writeModem(unsigned char *data, unsigned int len)
 
 			unsigned int srcId = lc->getSrcId();
 			unsigned int dstId = lc->getDstId();
-			std::string src = m_lookup->find(srcId);
-			std::string dst = m_lookup->find(dstId);
+			CUserDBView src = m_lookup->find(srcId);
+			CUserDBView dst = m_lookup->find(dstId);
 			FLCO flco       = lc->getFLCO();
 
 			if (!m_protect) {
@@ -250,7 +250,7 @@ bool CDMRSlot::writeModem(unsigned char *data, unsigned int len)
 
 			if (!CDMRAccessControl::validateSrcId(srcId)) {
 				LogMessage("DMR Slot %u, RF user %u rejected", m_slotNo, srcId);
-				writeJSONRF("rejected", srcId, src, flco == FLCO::GROUP, dstId);
+				writeJSONRF("rejected", srcId, src.getCallsign(), flco == FLCO::GROUP, dstId);
 				delete lc;
 				m_rfState = RPT_RF_STATE::LISTENING;
 				return false;
@@ -258,7 +258,7 @@ bool CDMRSlot::writeModem(unsigned char *data, unsigned int len)
 
 			if (!CDMRAccessControl::validateTGId(m_slotNo, flco == FLCO::GROUP, dstId)) {
 				LogMessage("DMR Slot %u, RF user %u rejected for using TG %u", m_slotNo, srcId, dstId);
-				writeJSONRF("rejected", srcId, src, flco == FLCO::GROUP, dstId);
+				writeJSONRF("rejected", srcId, src.getCallsign(), flco == FLCO::GROUP, dstId);
 				delete lc;
 				m_rfState = RPT_RF_STATE::LISTENING;
 				return false;
@@ -329,8 +329,8 @@ bool CDMRSlot::writeModem(unsigned char *data, unsigned int len)
 				writeJSONBER();
 			}
 
-			LogMessage("DMR Slot %u, received RF voice header from %s to %s%s", m_slotNo, src.c_str(), flco == FLCO::GROUP ? "TG " : "", dst.c_str());
-			writeJSONRF("start", srcId, src, flco == FLCO::GROUP, dstId);
+			LogMessage("DMR Slot %u, received RF voice header from %s to %s%s", m_slotNo, src.getCallsign().data(), flco == FLCO::GROUP ? "TG " : "", dst.getCallsign().data());
+			writeJSONRF("start", srcId, src.getCallsign(), flco == FLCO::GROUP, dstId);
 
 			return true;
 		} else if (dataType == DT_VOICE_PI_HEADER) {
@@ -388,15 +388,15 @@ bool CDMRSlot::writeModem(unsigned char *data, unsigned int len)
 
 			unsigned int srcId = m_rfLC->getSrcId();
 			unsigned int dstId = m_rfLC->getDstId();
-			std::string src = m_lookup->find(srcId);
-			std::string dst = m_lookup->find(dstId);
+			CUserDBView src = m_lookup->find(srcId);
+			CUserDBView dst = m_lookup->find(dstId);
 			FLCO flco       = m_rfLC->getFLCO();
 
 			if (m_rssi != 0) {
-				LogMessage("DMR Slot %u, received RF end of voice transmission from %s to %s%s, %.1f seconds, BER: %.1f%%, RSSI: %d/%d/%d dBm", m_slotNo, src.c_str(), flco == FLCO::GROUP ? "TG " : "", dst.c_str(), float(m_rfFrames) / 16.667F, float(m_rfErrs * 100U) / float(m_rfBits), m_minRSSI, m_maxRSSI, m_aveRSSI / int(m_rssiCountTotal));
+				LogMessage("DMR Slot %u, received RF end of voice transmission from %s to %s%s, %.1f seconds, BER: %.1f%%, RSSI: %d/%d/%d dBm", m_slotNo, src.getCallsign().data(), flco == FLCO::GROUP ? "TG " : "", dst.getCallsign().data(), float(m_rfFrames) / 16.667F, float(m_rfErrs * 100U) / float(m_rfBits), m_minRSSI, m_maxRSSI, m_aveRSSI / int(m_rssiCountTotal));
 				writeJSONRF("end", float(m_rfFrames) / 16.667F, float(m_rfErrs * 100U) / float(m_rfBits), m_minRSSI, m_maxRSSI, m_aveRSSI / int(m_rssiCountTotal));
 			} else {
-				LogMessage("DMR Slot %u, received RF end of voice transmission from %s to %s%s, %.1f seconds, BER: %.1f%%", m_slotNo, src.c_str(), flco == FLCO::GROUP ? "TG " : "", dst.c_str(), float(m_rfFrames) / 16.667F, float(m_rfErrs * 100U) / float(m_rfBits));
+				LogMessage("DMR Slot %u, received RF end of voice transmission from %s to %s%s, %.1f seconds, BER: %.1f%%", m_slotNo, src.getCallsign().data(), flco == FLCO::GROUP ? "TG " : "", dst.getCallsign().data(), float(m_rfFrames) / 16.667F, float(m_rfErrs * 100U) / float(m_rfBits));
 				writeJSONRF("end", float(m_rfFrames) / 16.667F, float(m_rfErrs * 100U) / float(m_rfBits));
 			}
 
@@ -419,19 +419,19 @@ bool CDMRSlot::writeModem(unsigned char *data, unsigned int len)
 			bool gi = dataHeader.getGI();
 			unsigned int srcId = dataHeader.getSrcId();
 			unsigned int dstId = dataHeader.getDstId();
-			std::string src = m_lookup->find(srcId);
-			std::string dst = m_lookup->find(dstId);
+			CUserDBView src = m_lookup->find(srcId);
+			CUserDBView dst = m_lookup->find(dstId);
 
 			if (!CDMRAccessControl::validateSrcId(srcId)) {
 				LogMessage("DMR Slot %u, RF user %u rejected", m_slotNo, srcId);
-				writeJSONRF("rejected", srcId, src, gi, dstId);
+				writeJSONRF("rejected", srcId, src.getCallsign(), gi, dstId);
 				m_rfState = RPT_RF_STATE::LISTENING;
 				return false;
 			}
 
 			if (!CDMRAccessControl::validateTGId(m_slotNo, gi, dstId)) {
 				LogMessage("DMR Slot %u, RF user %u rejected for using TG %u", m_slotNo, srcId, dstId);
-				writeJSONRF("rejected", srcId, src, gi, dstId);
+				writeJSONRF("rejected", srcId, src.getCallsign(), gi, dstId);
 				m_rfState = RPT_RF_STATE::LISTENING;
 				return false;
 			}
@@ -464,11 +464,11 @@ bool CDMRSlot::writeModem(unsigned char *data, unsigned int len)
 				writeJSONRSSI();
 			}
 
-			LogMessage("DMR Slot %u, received RF data header from %s to %s%s, %u blocks", m_slotNo, src.c_str(), gi ? "TG ": "", dst.c_str(), m_rfFrames);
-			writeJSONRF("start", srcId, src, gi, dstId, m_rfFrames);
+			LogMessage("DMR Slot %u, received RF data header from %s to %s%s, %u blocks", m_slotNo, src.getCallsign().data(), gi ? "TG ": "", dst.getCallsign().data(), m_rfFrames);
+			writeJSONRF("start", srcId, src.getCallsign(), gi, dstId, m_rfFrames);
 
 			if (m_rfFrames == 0U) {
-				LogMessage("DMR Slot %u, ended RF data transmission from %s to %s%s", m_slotNo, src.c_str(), gi ? "TG " : "", dst.c_str());
+				LogMessage("DMR Slot %u, ended RF data transmission from %s to %s%s", m_slotNo, src.getCallsign().data(), gi ? "TG " : "", dst.getCallsign().data());
 				writeJSONRF("end");
 				writeEndRF();
 			}
@@ -493,20 +493,20 @@ bool CDMRSlot::writeModem(unsigned char *data, unsigned int len)
 			bool gi = csbk.getGI();
 			unsigned int srcId = csbk.getSrcId();
 			unsigned int dstId = csbk.getDstId();
-			std::string src = m_lookup->find(srcId);
-			std::string dst = m_lookup->find(dstId);
+			CUserDBView src = m_lookup->find(srcId);
+			CUserDBView dst = m_lookup->find(dstId);
 
 			if (srcId != 0U || dstId != 0U) {
 				if (!CDMRAccessControl::validateSrcId(srcId)) {
 					LogMessage("DMR Slot %u, RF user %u rejected", m_slotNo, srcId);
-					writeJSONRF("rejected", srcId, src, gi, dstId);
+					writeJSONRF("rejected", srcId, src.getCallsign(), gi, dstId);
 					m_rfState = RPT_RF_STATE::LISTENING;
 					return false;
 				}
 
 				if (!CDMRAccessControl::validateTGId(m_slotNo, gi, dstId)) {
 					LogMessage("DMR Slot %u, RF user %u rejected for using TG %u", m_slotNo, srcId, dstId);
-					writeJSONRF("rejected", srcId, src, gi, dstId);
+					writeJSONRF("rejected", srcId, src.getCallsign(), gi, dstId);
 					m_rfState = RPT_RF_STATE::LISTENING;
 					return false;
 				}
@@ -531,36 +531,36 @@ bool CDMRSlot::writeModem(unsigned char *data, unsigned int len)
 
 			switch (csbko) {
 			case CSBKO::UUVREQ:
-				LogMessage("DMR Slot %u, received RF Unit to Unit Voice Service Request CSBK from %s to %s%s", m_slotNo, src.c_str(), gi ? "TG ": "", dst.c_str());
-				writeJSONRF("csbk", "Unit to Unit Voice Service Request", srcId, src, gi, dstId);
+				LogMessage("DMR Slot %u, received RF Unit to Unit Voice Service Request CSBK from %s to %s%s", m_slotNo, src.getCallsign().data(), gi ? "TG ": "", dst.getCallsign().data());
+				writeJSONRF("csbk", "Unit to Unit Voice Service Request", srcId, src.getCallsign(), gi, dstId);
 				break;
 			case CSBKO::UUANSRSP:
-				LogMessage("DMR Slot %u, received RF Unit to Unit Voice Service Answer Response CSBK from %s to %s%s", m_slotNo, src.c_str(), gi ? "TG ": "", dst.c_str());
-				writeJSONRF("csbk", "Unit to Unit Voice Answer Response", srcId, src, gi, dstId);
+				LogMessage("DMR Slot %u, received RF Unit to Unit Voice Service Answer Response CSBK from %s to %s%s", m_slotNo, src.getCallsign().data(), gi ? "TG ": "", dst.getCallsign().data());
+				writeJSONRF("csbk", "Unit to Unit Voice Answer Response", srcId, src.getCallsign(), gi, dstId);
 				break;
 			case CSBKO::NACKRSP:
-				LogMessage("DMR Slot %u, received RF Negative Acknowledgment Response CSBK from %s to %s%s", m_slotNo, src.c_str(), gi ? "TG ": "", dst.c_str());
-				writeJSONRF("csbk", "Negative Acknowledgment Response", srcId, src, gi, dstId);
+				LogMessage("DMR Slot %u, received RF Negative Acknowledgment Response CSBK from %s to %s%s", m_slotNo, src.getCallsign().data(), gi ? "TG ": "", dst.getCallsign().data());
+				writeJSONRF("csbk", "Negative Acknowledgment Response", srcId, src.getCallsign(), gi, dstId);
 				break;
 			case CSBKO::PRECCSBK:
-				LogMessage("DMR Slot %u, received RF %s Preamble CSBK (%u to follow) from %s to %s%s", m_slotNo, csbk.getDataContent() ? "Data" : "CSBK", csbk.getCBF(), src.c_str(), gi ? "TG ": "", dst.c_str());
-				writeJSONRF("csbk", "Preamble", srcId, src, gi, dstId);
+				LogMessage("DMR Slot %u, received RF %s Preamble CSBK (%u to follow) from %s to %s%s", m_slotNo, csbk.getDataContent() ? "Data" : "CSBK", csbk.getCBF(), src.getCallsign().data(), gi ? "TG ": "", dst.getCallsign().data());
+				writeJSONRF("csbk", "Preamble", srcId, src.getCallsign(), gi, dstId);
 				break;
 			case CSBKO::CALL_ALERT:
-				LogMessage("DMR Slot %u, received RF Call Alert CSBK from %s to %s%s", m_slotNo, src.c_str(), gi ? "TG " : "", dst.c_str());
-				writeJSONRF("csbk", "Call Alert", srcId, src, gi, dstId);
+				LogMessage("DMR Slot %u, received RF Call Alert CSBK from %s to %s%s", m_slotNo, src.getCallsign().data(), gi ? "TG " : "", dst.getCallsign().data());
+				writeJSONRF("csbk", "Call Alert", srcId, src.getCallsign(), gi, dstId);
 				break;
 			case CSBKO::CALL_ALERT_ACK:
-				LogMessage("DMR Slot %u, received RF Call Alert Ack CSBK from %s to %s%s", m_slotNo, src.c_str(), gi ? "TG " : "", dst.c_str());
-				writeJSONRF("csbk", "Call Alert Ack", srcId, src, gi, dstId);
+				LogMessage("DMR Slot %u, received RF Call Alert Ack CSBK from %s to %s%s", m_slotNo, src.getCallsign().data(), gi ? "TG " : "", dst.getCallsign().data());
+				writeJSONRF("csbk", "Call Alert Ack", srcId, src.getCallsign(), gi, dstId);
 				break;
 			case CSBKO::RADIO_CHECK:
-				LogMessage("DMR Slot %u, received RF Radio Check %s CSBK from %s to %s%s", m_slotNo, /* TBD */ 1 ? "Req" : "Ack", src.c_str(), gi ? "TG " : "", dst.c_str());
-				writeJSONRF("csbk", "Radio Check", srcId, src, gi, dstId);
+				LogMessage("DMR Slot %u, received RF Radio Check %s CSBK from %s to %s%s", m_slotNo, /* TBD */ 1 ? "Req" : "Ack", src.getCallsign().data(), gi ? "TG " : "", dst.getCallsign().data());
+				writeJSONRF("csbk", "Radio Check", srcId, src.getCallsign(), gi, dstId);
 				break;
 			case CSBKO::CALL_EMERGENCY:
-				LogMessage("DMR Slot %u, received RF Call Emergency CSBK from %s to %s%s", m_slotNo, src.c_str(), gi ? "TG " : "", dst.c_str());
-				writeJSONRF("csbk", "Call Emergency", srcId, src, gi, dstId);
+				LogMessage("DMR Slot %u, received RF Call Emergency CSBK from %s to %s%s", m_slotNo, src.getCallsign().data(), gi ? "TG " : "", dst.getCallsign().data());
+				writeJSONRF("csbk", "Call Emergency", srcId, src.getCallsign(), gi, dstId);
 				break;
 			default:
 				LogWarning("DMR Slot %u, unhandled RF CSBK type - 0x%02X", m_slotNo, csbko);
@@ -870,8 +870,8 @@ bool CDMRSlot::writeModem(unsigned char *data, unsigned int len)
 			if (lc != nullptr) {
 				unsigned int srcId = lc->getSrcId();
 				unsigned int dstId = lc->getDstId();
-				std::string src = m_lookup->find(srcId);
-				std::string dst = m_lookup->find(dstId);
+				CUserDBView src = m_lookup->find(srcId);
+				CUserDBView dst = m_lookup->find(dstId);
 				FLCO flco       = lc->getFLCO();
 
 				if (!m_protect) {
@@ -885,7 +885,7 @@ bool CDMRSlot::writeModem(unsigned char *data, unsigned int len)
 
 				if (!CDMRAccessControl::validateSrcId(srcId)) {
 					LogMessage("DMR Slot %u, RF user %u rejected", m_slotNo, srcId);
-					writeJSONRF("rejected", srcId, src, flco == FLCO::GROUP, dstId);
+					writeJSONRF("rejected", srcId, src.getCallsign(), flco == FLCO::GROUP, dstId);
 					delete lc;
 					m_rfState = RPT_RF_STATE::LISTENING;
 					return false;
@@ -893,7 +893,7 @@ bool CDMRSlot::writeModem(unsigned char *data, unsigned int len)
 
 				if (!CDMRAccessControl::validateTGId(m_slotNo, flco == FLCO::GROUP, dstId)) {
 					LogMessage("DMR Slot %u, RF user %u rejected for using TG %u", m_slotNo, srcId, dstId);
-					writeJSONRF("rejected", srcId, src, flco == FLCO::GROUP, dstId);
+					writeJSONRF("rejected", srcId, src.getCallsign(), flco == FLCO::GROUP, dstId);
 					delete lc;
 					m_rfState = RPT_RF_STATE::LISTENING;
 					return false;
@@ -1000,8 +1000,8 @@ bool CDMRSlot::writeModem(unsigned char *data, unsigned int len)
 					writeJSONBER();
 				}
 
-				LogMessage("DMR Slot %u, received RF late entry from %s to %s%s", m_slotNo, src.c_str(), flco == FLCO::GROUP ? "TG " : "", dst.c_str());
-				writeJSONRF("late_entry", srcId, src, flco == FLCO::GROUP, dstId);
+				LogMessage("DMR Slot %u, received RF late entry from %s to %s%s", m_slotNo, src.getCallsign().data(), flco == FLCO::GROUP ? "TG " : "", dst.getCallsign().data());
+				writeJSONRF("late_entry", srcId, src.getCallsign(), flco == FLCO::GROUP, dstId);
 
 				return true;
 			}
@@ -1219,13 +1219,11 @@ void CDMRSlot::writeNetwork(const CDMRData& dmrData)
 		m_netState = RPT_NET_STATE::AUDIO;
 
 		setShortLC(m_slotNo, dstId, flco, ACTIVITY_TYPE::VOICE);
-		std::string src = m_lookup->find(srcId);
-		std::string dst = m_lookup->find(dstId);
-		class CUserDBentry cn;
-		m_lookup->findWithName(srcId, &cn);
+		CUserDBView src = m_lookup->find(srcId);
+		CUserDBView dst = m_lookup->find(dstId);
 
-		LogMessage("DMR Slot %u, received network voice header from %s to %s%s", m_slotNo, src.c_str(), flco == FLCO::GROUP ? "TG " : "", dst.c_str());
-		writeJSONNet("start", srcId, src, flco == FLCO::GROUP, dstId);
+		LogMessage("DMR Slot %u, received network voice header from %s to %s%s", m_slotNo, src.getCallsign().data(), flco == FLCO::GROUP ? "TG " : "", dst.getCallsign().data());
+		writeJSONNet("start", srcId, src.getCallsign(), flco == FLCO::GROUP, dstId);
 	} else if (dataType == DT_VOICE_PI_HEADER) {
 		if (m_netState != RPT_NET_STATE::AUDIO) {
 			CDMRLC* lc = new CDMRLC(dmrData.getFLCO(), dmrData.getSrcId(), dmrData.getDstId());
@@ -1285,13 +1283,11 @@ void CDMRSlot::writeNetwork(const CDMRData& dmrData)
 			m_netState = RPT_NET_STATE::AUDIO;
 
 			setShortLC(m_slotNo, dstId, m_netLC->getFLCO(), ACTIVITY_TYPE::VOICE);
-			std::string src = m_lookup->find(srcId);
-			std::string dst = m_lookup->find(dstId);
-			class CUserDBentry cn;
-			m_lookup->findWithName(srcId, &cn);
+			CUserDBView src = m_lookup->find(srcId);
+			CUserDBView dst = m_lookup->find(dstId);
 
-			LogMessage("DMR Slot %u, received network late entry from %s to %s%s", m_slotNo, src.c_str(), m_netLC->getFLCO() == FLCO::GROUP ? "TG " : "", dst.c_str());
-			writeJSONNet("late_entry", srcId, src, m_netLC->getFLCO() == FLCO::GROUP, dstId);
+			LogMessage("DMR Slot %u, received network late entry from %s to %s%s", m_slotNo, src.getCallsign().data(), m_netLC->getFLCO() == FLCO::GROUP ? "TG " : "", dst.getCallsign().data());
+			writeJSONNet("late_entry", srcId, src.getCallsign(), m_netLC->getFLCO() == FLCO::GROUP, dstId);
 		}
 
 		// Regenerate the Slot Type
@@ -1345,13 +1341,13 @@ void CDMRSlot::writeNetwork(const CDMRData& dmrData)
 
 		unsigned int srcId = m_netLC->getSrcId();
 		unsigned int dstId = m_netLC->getDstId();
-		std::string src = m_lookup->find(srcId);
-		std::string dst = m_lookup->find(dstId);
+		CUserDBView src = m_lookup->find(srcId);
+		CUserDBView dst = m_lookup->find(dstId);
 		FLCO flco       = m_netLC->getFLCO();
 
 		// We've received the voice header and terminator haven't we?
 		m_netFrames += 2U;
-		LogMessage("DMR Slot %u, received network end of voice transmission from %s to %s%s, %.1f seconds, %u%% packet loss, BER: %.1f%%", m_slotNo, src.c_str(), flco == FLCO::GROUP ? "TG " : "", dst.c_str(), float(m_netFrames) / 16.667F, (m_netLost * 100U) / m_netFrames, float(m_netErrs * 100U) / float(m_netBits));
+		LogMessage("DMR Slot %u, received network end of voice transmission from %s to %s%s, %.1f seconds, %u%% packet loss, BER: %.1f%%", m_slotNo, src.getCallsign().data(), flco == FLCO::GROUP ? "TG " : "", dst.getCallsign().data(), float(m_netFrames) / 16.667F, (m_netLost * 100U) / m_netFrames, float(m_netErrs * 100U) / float(m_netBits));
 		writeJSONNet("end", float(m_netFrames) / 16.667F, float(m_netLost * 100U) / float(m_netFrames), float(m_netErrs * 100U) / float(m_netBits));
 		writeEndNet();
 	} else if (dataType == DT_DATA_HEADER) {
@@ -1396,14 +1392,14 @@ void CDMRSlot::writeNetwork(const CDMRData& dmrData)
 
 		setShortLC(m_slotNo, dstId, gi ? FLCO::GROUP : FLCO::USER_USER, ACTIVITY_TYPE::DATA);
 
-		std::string src = m_lookup->find(srcId);
-		std::string dst = m_lookup->find(dstId);
+		CUserDBView src = m_lookup->find(srcId);
+		CUserDBView dst = m_lookup->find(dstId);
 
-		LogMessage("DMR Slot %u, received network data header from %s to %s%s, %u blocks", m_slotNo, src.c_str(), gi ? "TG ": "", dst.c_str(), m_netFrames);
-		writeJSONNet("start", srcId, src, gi, dstId, m_netFrames);
+		LogMessage("DMR Slot %u, received network data header from %s to %s%s, %u blocks", m_slotNo, src.getCallsign().data(), gi ? "TG ": "", dst.getCallsign().data(), m_netFrames);
+		writeJSONNet("start", srcId, src.getCallsign(), gi, dstId, m_netFrames);
 
 		if (m_netFrames == 0U) {
-			LogMessage("DMR Slot %u, ended network data transmission from %s to %s%s", m_slotNo, src.c_str(), gi ? "TG " : "", dst.c_str());
+			LogMessage("DMR Slot %u, ended network data transmission from %s to %s%s", m_slotNo, src.getCallsign().data(), gi ? "TG " : "", dst.getCallsign().data());
 			writeJSONNet("end");
 			writeEndNet();
 		}
@@ -1476,13 +1472,11 @@ void CDMRSlot::writeNetwork(const CDMRData& dmrData)
 
 			setShortLC(m_slotNo, dstId, m_netLC->getFLCO(), ACTIVITY_TYPE::VOICE);
 	
-			std::string src = m_lookup->find(srcId);
-			std::string dst = m_lookup->find(dstId);
-			class CUserDBentry cn;
-			m_lookup->findWithName(srcId, &cn);
+			CUserDBView src = m_lookup->find(srcId);
+			CUserDBView dst = m_lookup->find(dstId);
 
-			LogMessage("DMR Slot %u, received network late entry from %s to %s%s", m_slotNo, src.c_str(), m_netLC->getFLCO() == FLCO::GROUP ? "TG " : "", dst.c_str());
-			writeJSONNet("late_entry", srcId, src, m_netLC->getFLCO() == FLCO::GROUP, dstId);
+			LogMessage("DMR Slot %u, received network late entry from %s to %s%s", m_slotNo, src.getCallsign().data(), m_netLC->getFLCO() == FLCO::GROUP ? "TG " : "", dst.getCallsign().data());
+			writeJSONNet("late_entry", srcId, src.getCallsign(), m_netLC->getFLCO() == FLCO::GROUP, dstId);
 		}
 
 		if (m_netState == RPT_NET_STATE::AUDIO) {
@@ -1733,37 +1727,37 @@ void CDMRSlot::writeNetwork(const CDMRData& dmrData)
 		} else
 			writeQueueNet(data);
 
-		std::string src = m_lookup->find(srcId);
-		std::string dst = m_lookup->find(dstId);
+		CUserDBView src = m_lookup->find(srcId);
+		CUserDBView dst = m_lookup->find(dstId);
 
 		switch (csbko) {
 		case CSBKO::UUVREQ:
-			LogMessage("DMR Slot %u, received network Unit to Unit Voice Service Request CSBK from %s to %s%s", m_slotNo, src.c_str(), gi ? "TG ": "", dst.c_str());
-			writeJSONNet("csbk", "Unit to Unit Voice Service Request", srcId, src, gi, dstId);
+			LogMessage("DMR Slot %u, received network Unit to Unit Voice Service Request CSBK from %s to %s%s", m_slotNo, src.getCallsign().data(), gi ? "TG ": "", dst.getCallsign().data());
+			writeJSONNet("csbk", "Unit to Unit Voice Service Request", srcId, src.getCallsign(), gi, dstId);
 			break;
 		case CSBKO::UUANSRSP:
-			LogMessage("DMR Slot %u, received network Unit to Unit Voice Service Answer Response CSBK from %s to %s%s", m_slotNo, src.c_str(), gi ? "TG ": "", dst.c_str());
-			writeJSONNet("csbk", "Unit to Unit Voice Service Answer Response", srcId, src, gi, dstId);
+			LogMessage("DMR Slot %u, received network Unit to Unit Voice Service Answer Response CSBK from %s to %s%s", m_slotNo, src.getCallsign().data(), gi ? "TG ": "", dst.getCallsign().data());
+			writeJSONNet("csbk", "Unit to Unit Voice Service Answer Response", srcId, src.getCallsign(), gi, dstId);
 			break;
 		case CSBKO::NACKRSP:
-			LogMessage("DMR Slot %u, received network Negative Acknowledgment Response CSBK from %s to %s%s", m_slotNo, src.c_str(), gi ? "TG ": "", dst.c_str());
-			writeJSONNet("csbk", "UNegative Acknowledgment Response", srcId, src, gi, dstId);
+			LogMessage("DMR Slot %u, received network Negative Acknowledgment Response CSBK from %s to %s%s", m_slotNo, src.getCallsign().data(), gi ? "TG ": "", dst.getCallsign().data());
+			writeJSONNet("csbk", "UNegative Acknowledgment Response", srcId, src.getCallsign(), gi, dstId);
 			break;
 		case CSBKO::PRECCSBK:
-			LogMessage("DMR Slot %u, received network %s Preamble CSBK (%u to follow) from %s to %s%s", m_slotNo, csbk.getDataContent() ? "Data" : "CSBK", csbk.getCBF(), src.c_str(), gi ? "TG " : "", dst.c_str());
-			writeJSONNet("csbk", "Preamble", srcId, src, gi, dstId);
+			LogMessage("DMR Slot %u, received network %s Preamble CSBK (%u to follow) from %s to %s%s", m_slotNo, csbk.getDataContent() ? "Data" : "CSBK", csbk.getCBF(), src.getCallsign().data(), gi ? "TG " : "", dst.getCallsign().data());
+			writeJSONNet("csbk", "Preamble", srcId, src.getCallsign(), gi, dstId);
 			break;
 		case CSBKO::CALL_ALERT:
-			LogMessage("DMR Slot %u, received network Call Alert CSBK from %s to %s%s", m_slotNo, src.c_str(), gi ? "TG " : "", dst.c_str());
-			writeJSONNet("csbk", "Call Alert", srcId, src, gi, dstId);
+			LogMessage("DMR Slot %u, received network Call Alert CSBK from %s to %s%s", m_slotNo, src.getCallsign().data(), gi ? "TG " : "", dst.getCallsign().data());
+			writeJSONNet("csbk", "Call Alert", srcId, src.getCallsign(), gi, dstId);
 			break;
 		case CSBKO::CALL_ALERT_ACK:
-			LogMessage("DMR Slot %u, received network Call Alert Ack CSBK from %s to %s%s", m_slotNo, src.c_str(), gi ? "TG " : "", dst.c_str());
-			writeJSONNet("csbk", "Call Alert Ack", srcId, src, gi, dstId);
+			LogMessage("DMR Slot %u, received network Call Alert Ack CSBK from %s to %s%s", m_slotNo, src.getCallsign().data(), gi ? "TG " : "", dst.getCallsign().data());
+			writeJSONNet("csbk", "Call Alert Ack", srcId, src.getCallsign(), gi, dstId);
 			break;
 		case CSBKO::RADIO_CHECK:
-			LogMessage("DMR Slot %u, received network Radio Check %s CSBK from %s to %s%s", m_slotNo, /* TBD */ 1 ? "Req" : "Ack", src.c_str(), gi ? "TG " : "", dst.c_str());
-			writeJSONNet("csbk", "Radio Check", srcId, src, gi, dstId);
+			LogMessage("DMR Slot %u, received network Radio Check %s CSBK from %s to %s%s", m_slotNo, /* TBD */ 1 ? "Req" : "Ack", src.getCallsign().data(), gi ? "TG " : "", dst.getCallsign().data());
+			writeJSONNet("csbk", "Radio Check", srcId, src.getCallsign(), gi, dstId);
 			break;
 		default:
 			LogWarning("DMR Slot %u, unhandled network CSBK type - 0x%02X", m_slotNo, csbko);
@@ -2360,7 +2354,7 @@ void CDMRSlot::writeJSONRF(const char* action)
 	WriteJSON("DMR", json);
 }
 
-void CDMRSlot::writeJSONRF(const char* action, unsigned int srcId, const std::string& srcInfo, bool grp, unsigned int dstId)
+void CDMRSlot::writeJSONRF(const char* action, unsigned int srcId, std::string_view srcInfo, bool grp, unsigned int dstId)
 {
 	assert(action != nullptr);
 
@@ -2371,7 +2365,7 @@ void CDMRSlot::writeJSONRF(const char* action, unsigned int srcId, const std::st
 	WriteJSON("DMR", json);
 }
 
-void CDMRSlot::writeJSONRF(const char* action, const char* desc, unsigned int srcId, const std::string& srcInfo, bool grp, unsigned int dstId)
+void CDMRSlot::writeJSONRF(const char* action, const char* desc, unsigned int srcId, std::string_view srcInfo, bool grp, unsigned int dstId)
 {
 	assert(action != nullptr);
 	assert(desc != nullptr);
@@ -2385,7 +2379,7 @@ void CDMRSlot::writeJSONRF(const char* action, const char* desc, unsigned int sr
 	WriteJSON("DMR", json);
 }
 
-void CDMRSlot::writeJSONRF(const char* action, unsigned int srcId, const std::string& srcInfo, bool grp, unsigned int dstId, unsigned int frames)
+void CDMRSlot::writeJSONRF(const char* action, unsigned int srcId, std::string_view srcInfo, bool grp, unsigned int dstId, unsigned int frames)
 {
 	assert(action != nullptr);
 
@@ -2444,7 +2438,7 @@ void CDMRSlot::writeJSONNet(const char* action)
 	WriteJSON("DMR", json);
 }
 
-void CDMRSlot::writeJSONNet(const char* action, unsigned int srcId, const std::string& srcInfo, bool grp, unsigned int dstId)
+void CDMRSlot::writeJSONNet(const char* action, unsigned int srcId, std::string_view srcInfo, bool grp, unsigned int dstId)
 {
 	assert(action != nullptr);
 
@@ -2455,7 +2449,7 @@ void CDMRSlot::writeJSONNet(const char* action, unsigned int srcId, const std::s
 	WriteJSON("DMR", json);
 }
 
-void CDMRSlot::writeJSONNet(const char* action, const char* desc, unsigned int srcId, const std::string& srcInfo, bool grp, unsigned int dstId)
+void CDMRSlot::writeJSONNet(const char* action, const char* desc, unsigned int srcId, std::string_view srcInfo, bool grp, unsigned int dstId)
 {
 	assert(action != nullptr);
 	assert(desc != nullptr);
@@ -2469,7 +2463,7 @@ void CDMRSlot::writeJSONNet(const char* action, const char* desc, unsigned int s
 	WriteJSON("DMR", json);
 }
 
-void CDMRSlot::writeJSONNet(const char* action, unsigned int srcId, const std::string& srcInfo, bool grp, unsigned int dstId, unsigned int frames)
+void CDMRSlot::writeJSONNet(const char* action, unsigned int srcId, std::string_view srcInfo, bool grp, unsigned int dstId, unsigned int frames)
 {
 	assert(action != nullptr);
 
@@ -2506,7 +2500,7 @@ void CDMRSlot::writeJSON(nlohmann::json& json, const char* action)
 	json["slot"]      = int(m_slotNo);
 }
 
-void CDMRSlot::writeJSON(nlohmann::json& json, const char* source, const char* action, unsigned int srcId, const std::string& srcInfo, bool grp, unsigned int dstId)
+void CDMRSlot::writeJSON(nlohmann::json& json, const char* source, const char* action, unsigned int srcId, std::string_view srcInfo, bool grp, unsigned int dstId)
 {
 	assert(source != nullptr);
 	assert(action != nullptr);
@@ -36,6 +36,7 @@
 
 #if defined(USE_DMR)
 
+#include <string_view>
 #include <vector>
 
 #include <nlohmann/json.hpp>
@@ -166,20 +167,20 @@ private:
 	void writeJSONText(const unsigned char* text);
 
 	void writeJSONRF(const char* action);
-	void writeJSONRF(const char* action, unsigned int srcId, const std::string& srcInfo, bool grp, unsigned int dstId);
-	void writeJSONRF(const char* action, unsigned int srcId, const std::string& srcInfo, bool grp, unsigned int dstId, unsigned int frames);
-	void writeJSONRF(const char* action, const char* desc, unsigned int srcId, const std::string& srcInfo, bool grp, unsigned int dstId);
+	void writeJSONRF(const char* action, unsigned int srcId, std::string_view srcInfo, bool grp, unsigned int dstId);
+	void writeJSONRF(const char* action, unsigned int srcId, std::string_view srcInfo, bool grp, unsigned int dstId, unsigned int frames);
+	void writeJSONRF(const char* action, const char* desc, unsigned int srcId, std::string_view srcInfo, bool grp, unsigned int dstId);
 	void writeJSONRF(const char* action, float duration, float ber);
 	void writeJSONRF(const char* action, float duration, float ber, int minRSSI, int maxRSSI, int aveRSSI);
 
 	void writeJSONNet(const char* action);
-	void writeJSONNet(const char* action, unsigned int srcId, const std::string& srcInfo, bool grp, unsigned int dstId);
-	void writeJSONNet(const char* action, unsigned int srcId, const std::string& srcInfo, bool grp, unsigned int dstId, unsigned int frames);
+	void writeJSONNet(const char* action, unsigned int srcId, std::string_view srcInfo, bool grp, unsigned int dstId);
+	void writeJSONNet(const char* action, unsigned int srcId, std::string_view srcInfo, bool grp, unsigned int dstId, unsigned int frames);
 	void writeJSONNet(const char* action, float duration, float loss, float ber);
-	void writeJSONNet(const char* action, const char* desc, unsigned int srcId, const std::string& srcInfo, bool grp, unsigned int dstId);
+	void writeJSONNet(const char* action, const char* desc, unsigned int srcId, std::string_view srcInfo, bool grp, unsigned int dstId);
 
 	void writeJSON(nlohmann::json& json, const char* action);
-	void writeJSON(nlohmann::json& json, const char* source, const char* action, unsigned int srcId, const std::string& srcInfo, bool grp, unsigned int dstId);
+	void writeJSON(nlohmann::json& json, const char* source, const char* action, unsigned int srcId, std::string_view srcInfo, bool grp, unsigned int dstId);
 };
 
 #endif
@@ -39,7 +39,8 @@ const unsigned char BIT_MASK_TABLE[] = {0x80U, 0x40U, 0x20U, 0x10U, 0x08U, 0x04U
 #define WRITE_BIT(p,i,b) p[(i)>>3] = (b) ? (p[(i)>>3] | BIT_MASK_TABLE[(i)&7]) : (p[(i)>>3] & ~BIT_MASK_TABLE[(i)&7])
 #define READ_BIT(p,i)    (p[(i)>>3] & BIT_MASK_TABLE[(i)&7])
 
-CDMRTrellis::CDMRTrellis()
+CDMRTrellis::CDMRTrellis() :
+m_trellis(ENCODE_TABLE, 8U)
 {
 }
 
@@ -58,27 +59,14 @@ bool CDMRTrellis::decode(const unsigned char* data, unsigned char* payload)
 	unsigned char points[49U];
 	dibitsToPoints(dibits, points);
 
-	// Check the original code
 	unsigned char tribits[49U];
-	unsigned int failPos = checkCode(points, tribits);
-	if (failPos == 999U) {
-		tribitsToBits(tribits, payload);
-		return true;
-	}
-
-	unsigned char savePoints[49U];
-	for (unsigned int i = 0U; i < 49U; i++)
-		savePoints[i] = points[i];
-
-	bool ret = fixCode(points, failPos, payload);
-	if (ret)
-		return true;
-
-	if (failPos == 0U)
+	unsigned int distance = m_trellis.decode(points, tribits);
+	if (distance > DMR_TRELLIS_MAX_DISTANCE)
 		return false;
 
-	// Backtrack one place for a last go
-	return fixCode(savePoints, failPos - 1U, payload);
+	tribitsToBits(tribits, payload);
+
+	return true;
 }
 
 void CDMRTrellis::encode(const unsigned char* payload, unsigned char* data)
@@ -90,15 +78,7 @@ void CDMRTrellis::encode(const unsigned char* payload, unsigned char* data)
 	bitsToTribits(payload, tribits);
 
 	unsigned char points[49U];
-	unsigned char state = 0U;
-
-	for (unsigned int i = 0U; i < 49U; i++) {
-		unsigned char tribit = tribits[i];
-
-		points[i] = ENCODE_TABLE[state * 8U + tribit];
-
-		state = tribit;
-	}
+	m_trellis.encode(tribits, points);
 
 	signed char dibits[98U];
 	pointsToDibits(points, dibits);
@@ -317,58 +297,3 @@ void CDMRTrellis::tribitsToBits(const unsigned char* tribits, unsigned char* pay
 		WRITE_BIT(payload, n, b3);
 	}
 }
-
-bool CDMRTrellis::fixCode(unsigned char* points, unsigned int failPos, unsigned char* payload) const
-{
-	for (unsigned j = 0U; j < 20U; j++) {
-		unsigned int bestPos = 0U;
-		unsigned int bestVal = 0U;
-
-		for (unsigned int i = 0U; i < 16U; i++) {
-			points[failPos] = i;
-
-			unsigned char tribits[49U];
-			unsigned int pos = checkCode(points, tribits);
-			if (pos == 999U) {
-				tribitsToBits(tribits, payload);
-				return true;
-			}
-
-			if (pos > bestPos) {
-				bestPos = pos;
-				bestVal = i;
-			}
-		}
-
-		points[failPos] = bestVal;
-		failPos = bestPos;
-	}
-
-	return false;
-}
-
-unsigned int CDMRTrellis::checkCode(const unsigned char* points, unsigned char* tribits) const
-{
-	unsigned char state = 0U;
-
-	for (unsigned int i = 0U; i < 49U; i++) {
-		tribits[i] = 9U;
-
-		for (unsigned int j = 0U; j < 8U; j++) {
-			if (points[i] == ENCODE_TABLE[state * 8U + j]) {
-				tribits[i] = j;
-				break;
-			}
-		}
-
-		if (tribits[i] == 9U)
-			return i;
-
-		state = tribits[i];
-	}
-
-	if (tribits[48U] != 0U)
-		return 48U;
-
-	return 999U;
-}
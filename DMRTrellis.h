@@ -14,6 +14,11 @@
 #ifndef	DMRTrellis_H
 #define	DMRTrellis_H
 
+#include "Trellis.h"
+
+// The most bit errors that a block may have from the closest codeword and still be accepted
+const unsigned int DMR_TRELLIS_MAX_DISTANCE = 8U;
+
 class CDMRTrellis {
 public:
 	CDMRTrellis();
@@ -23,14 +28,14 @@ public:
 	void encode(const unsigned char* payload, unsigned char* data);
 
 private:
+	CTrellis m_trellis;
+
 	void deinterleave(const unsigned char* in, signed char* dibits) const;
 	void interleave(const signed char* dibits, unsigned char* out) const;
 	void dibitsToPoints(const signed char* dibits, unsigned char* points) const;
 	void pointsToDibits(const unsigned char* points, signed char* dibits) const;
 	void bitsToTribits(const unsigned char* payload, unsigned char* tribits) const;
 	void tribitsToBits(const unsigned char* tribits, unsigned char* payload) const;
-	bool fixCode(unsigned char* points, unsigned int failPos, unsigned char* payload) const;
-	unsigned int checkCode(const unsigned char* points, unsigned char* tribits) const;
 };
 
 #endif
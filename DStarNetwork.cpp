@@ -65,6 +65,11 @@ CDStarNetwork::~CDStarNetwork()
 	delete[] m_linkReflector;
 }
 
+void CDStarNetwork::setSocketOptions(unsigned int rxBufferSize, unsigned int txBufferSize, int dscp, int keepAliveDSCP, int priority)
+{
+	m_socket.setOptions(rxBufferSize, txBufferSize, dscp, keepAliveDSCP, priority);
+}
+
 bool CDStarNetwork::open()
 {
 	if (m_addrLen == 0U) {
@@ -176,7 +181,7 @@ bool CDStarNetwork::writePoll(const char* text)
 	// if (m_debug)
 	//	CUtils::dump(1U, "D-Star Network Poll Sent", buffer, 6U + length);
 
-	return m_socket.write(buffer, 6U + length, m_addr, m_addrLen);
+	return m_socket.writeKeepAlive(buffer, 6U + length, m_addr, m_addrLen);
 }
 
 void CDStarNetwork::clock(unsigned int ms)
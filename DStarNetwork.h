@@ -36,6 +36,8 @@ public:
 	CDStarNetwork(const std::string& gatewayAddress, unsigned short gatewayPort, const std::string& localAddress, unsigned short localPort, bool duplex, const char* version, bool debug);
 	~CDStarNetwork();
 
+	void setSocketOptions(unsigned int rxBufferSize, unsigned int txBufferSize, int dscp, int keepAliveDSCP, int priority);
+
 	bool open();
 
 	void enable(bool enabled);
@@ -103,4 +103,10 @@ enum class DSTAR_ACK {
 	SMETER
 };
 
+enum class FM_ENCODING {
+	PCM,
+	ULAW,
+	ADPCM
+};
+
 #endif
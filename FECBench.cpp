@@ -0,0 +1,532 @@
+/*
+ *   Copyright (C) 2025 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/*
+ * A standalone benchmark for the FEC codecs, built with "make bench". Every codec is given a
+ * set of random frames which are encoded, hit with random bit errors at each of the requested
+ * bit error rates, and then decoded. The results are written to stdout as JSON, one object per
+ * codec and bit error rate. The -S option forces the portable code, as the ForceScalar setting
+ * does in MMDVMHost, so that it can be compared with the code chosen for this CPU.
+ *
+ * Usage: FECBench [-f frames] [-s seed] [-S] [ber ...]
+ */
+
+#include "NXDNConvolution.h"
+#include "ViterbiACS.h"
+#include "YSFConvolution.h"
+#include "DMRTrellis.h"
+#include "P25Trellis.h"
+#include "Golay24128.h"
+#include "Golay2087.h"
+#include "CPUFeatures.h"
+#include "BPTC19696.h"
+#include "RS634717.h"
+#include "AMBEFEC.h"
+#include "Hamming.h"
+#include "QR1676.h"
+#include "Defines.h"
+#include "BCH.h"
+#include "CRC.h"
+#include "Log.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+// Every frame is held in a fixed size slot, large enough for a whole DMR burst
+const unsigned int FRAME_STRIDE = 64U;
+
+// The decoders are run over all of the frames until at least this much time has passed
+const double MIN_RUN_TIME = 0.05;
+
+const unsigned int DEFAULT_FRAMES = 20000U;
+
+struct CBitRange {
+	unsigned int m_start;
+	unsigned int m_end;
+};
+
+// The coded bits of a DMR burst either side of the sync or EMB
+const CBitRange DMR_BURST[] = { {0U, 98U}, {166U, 264U} };
+
+// The AMBE bits of a DMR voice burst either side of the sync or EMB
+const CBitRange DMR_AMBE[] = { {0U, 108U}, {156U, 264U} };
+
+// Whole frames of the given number of bits
+const CBitRange BITS_16[] = { {0U, 16U} };
+const CBitRange BITS_20[] = { {0U, 20U} };
+const CBitRange BITS_23[] = { {0U, 23U} };
+const CBitRange BITS_24[] = { {0U, 24U} };
+const CBitRange BITS_63[] = { {0U, 63U} };
+const CBitRange BITS_72[] = { {0U, 72U} };
+const CBitRange BITS_80[] = { {0U, 80U} };
+const CBitRange BITS_96[] = { {0U, 96U} };
+const CBitRange BITS_144[] = { {0U, 144U} };
+const CBitRange BITS_192[] = { {0U, 192U} };
+const CBitRange BITS_196[] = { {0U, 196U} };
+const CBitRange BITS_216[] = { {0U, 216U} };
+const CBitRange BITS_288[] = { {0U, 288U} };
+const CBitRange BITS_328[] = { {0U, 328U} };
+const CBitRange BITS_360[] = { {0U, 360U} };
+
+static std::mt19937 rng;
+static std::vector<double> bers;
+static unsigned int frames = DEFAULT_FRAMES;
+static bool first = true;
+
+static unsigned int getBits(const unsigned char* in, unsigned int n)
+{
+	unsigned int v = (in[0U] << 24) | (in[1U] << 16) | (in[2U] << 8) | (in[3U] << 0);
+
+	return v >> (32U - n);
+}
+
+static void putBits(unsigned char* out, unsigned int v, unsigned int n)
+{
+	v <<= 32U - n;
+
+	out[0U] = v >> 24;
+	out[1U] = v >> 16;
+	out[2U] = v >> 8;
+	out[3U] = v >> 0;
+}
+
+// Run the function over every frame until enough time has passed, returning the time per frame in ns
+template <typename FUNCTION>
+static double timeFrames(const std::vector<unsigned char>& in, std::vector<unsigned char>& out, FUNCTION function)
+{
+	unsigned long long ops = 0ULL;
+	double time = 0.0;
+
+	auto start = std::chrono::steady_clock::now();
+	do {
+		for (unsigned int i = 0U; i < frames; i++)
+			function(&in[i * FRAME_STRIDE], &out[i * FRAME_STRIDE]);
+		ops += frames;
+
+		time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	} while (time < MIN_RUN_TIME);
+
+	return time * 1.0E9 / double(ops);
+}
+
+// Random data of the given length, MSB first, with any bits beyond the end left as zero
+static void randomData(unsigned char* data, unsigned int bits)
+{
+	::memset(data, 0x00U, FRAME_STRIDE);
+
+	for (unsigned int i = 0U; i < (bits + 7U) / 8U; i++)
+		data[i] = rng();
+
+	if ((bits % 8U) != 0U)
+		data[bits / 8U] &= 0xFFU << (8U - bits % 8U);
+}
+
+static unsigned int addErrors(unsigned char* code, const CBitRange* ranges, unsigned int nRanges, double ber)
+{
+	if (ber <= 0.0)
+		return 0U;
+
+	std::bernoulli_distribution flip(ber);
+
+	unsigned int errors = 0U;
+	for (unsigned int r = 0U; r < nRanges; r++) {
+		for (unsigned int i = ranges[r].m_start; i < ranges[r].m_end; i++) {
+			if (flip(rng)) {
+				code[i / 8U] ^= 0x80U >> (i % 8U);
+				errors++;
+			}
+		}
+	}
+
+	return errors;
+}
+
+static void report(const char* name, double ber, unsigned int dataBits, unsigned int codeBits, unsigned int errors, double encodeNs, double decodeNs, unsigned int corrected, unsigned int uncorrected, unsigned int flagged)
+{
+	::printf("%s\n", first ? "" : ",");
+	first = false;
+
+	::printf("  {\"codec\": \"%s\", \"ber\": %g, \"frames\": %u, \"data_bits\": %u, \"code_bits\": %u, \"bit_errors\": %u, ", name, ber, frames, dataBits, codeBits, errors);
+	::printf("\"encode_ns\": %.1f, \"decode_ns\": %.1f, \"decode_mbps\": %.3f, ", encodeNs, decodeNs, double(dataBits) * 1000.0 / decodeNs);
+
+	::printf("\"corrected\": %u, \"uncorrected\": %u, \"flagged\": %u}", corrected, uncorrected, flagged);
+}
+
+// Do the two frames match in every bit of the mask, or every bit when there is no mask
+static bool matches(const unsigned char* a, const unsigned char* b, const unsigned char* mask, unsigned int bytes)
+{
+	if (mask == nullptr)
+		return ::memcmp(a, b, bytes) == 0;
+
+	for (unsigned int i = 0U; i < bytes; i++) {
+		if (((a[i] ^ b[i]) & mask[i]) != 0U)
+			return false;
+	}
+
+	return true;
+}
+
+/*
+ * Encode the frames with the codec, then for every bit error rate corrupt the coded bits
+ * and decode them. A frame is corrected when it decodes to the same data as the error free
+ * frame, only comparing the bits in the mask if there is one, and flagged when the decoder
+ * reports it as bad.
+ */
+template <typename ENCODE, typename DECODE>
+static void bench(const char* name, unsigned int dataBits, const CBitRange* ranges, unsigned int nRanges, const std::vector<unsigned char>& data, ENCODE encode, DECODE decode, const unsigned char* mask)
+{
+	unsigned int codeBits = 0U;
+	for (unsigned int r = 0U; r < nRanges; r++)
+		codeBits += ranges[r].m_end - ranges[r].m_start;
+
+	const unsigned int dataBytes = (dataBits + 7U) / 8U;
+
+	std::vector<unsigned char> clean(frames * FRAME_STRIDE, 0x00U);
+	std::vector<unsigned char> noisy(frames * FRAME_STRIDE);
+	std::vector<unsigned char> reference(frames * FRAME_STRIDE, 0x00U);
+	std::vector<unsigned char> output(frames * FRAME_STRIDE, 0x00U);
+
+	double encodeNs = timeFrames(data, clean, encode);
+
+	for (unsigned int i = 0U; i < frames; i++)
+		decode(&clean[i * FRAME_STRIDE], &reference[i * FRAME_STRIDE]);
+
+	for (double ber : bers) {
+		noisy = clean;
+
+		unsigned int errors = 0U;
+		for (unsigned int i = 0U; i < frames; i++)
+			errors += addErrors(&noisy[i * FRAME_STRIDE], ranges, nRanges, ber);
+
+		unsigned int flagged = 0U;
+		for (unsigned int i = 0U; i < frames; i++) {
+			if (!decode(&noisy[i * FRAME_STRIDE], &output[i * FRAME_STRIDE]))
+				flagged++;
+		}
+
+		unsigned int corrected = 0U;
+		for (unsigned int i = 0U; i < frames; i++) {
+			if (matches(&output[i * FRAME_STRIDE], &reference[i * FRAME_STRIDE], mask, dataBytes))
+				corrected++;
+		}
+
+		double decodeNs = timeFrames(noisy, output, decode);
+
+		report(name, ber, dataBits, codeBits, errors, encodeNs, decodeNs, corrected, frames - corrected, flagged);
+	}
+}
+
+// As above with random data
+template <typename ENCODE, typename DECODE>
+static void bench(const char* name, unsigned int dataBits, const CBitRange* ranges, unsigned int nRanges, ENCODE encode, DECODE decode)
+{
+	std::vector<unsigned char> data(frames * FRAME_STRIDE);
+	for (unsigned int i = 0U; i < frames; i++)
+		randomData(&data[i * FRAME_STRIDE], dataBits);
+
+	bench(name, dataBits, ranges, nRanges, data, encode, decode, nullptr);
+}
+
+/*
+ * For FEC that is regenerated in place, which corrects some bits of a frame and passes the
+ * rest straight through. Random data only regenerates into a valid frame when there are few
+ * errors in it, otherwise into one that is silenced, so each of the parts of a frame is drawn
+ * again until it regenerates a second time without errors. A frame counts as corrected when
+ * the bits that the FEC protects come back, found by flipping each bit of a valid frame in
+ * turn.
+ */
+template <typename REGENERATE>
+static void benchRegenerate(const char* name, unsigned int bits, const CBitRange* ranges, unsigned int nRanges, unsigned int parts, REGENERATE regenerate)
+{
+	const unsigned int bytes = (bits + 7U) / 8U;
+	const unsigned int partBytes = bytes / parts;
+
+	std::vector<unsigned char> data(frames * FRAME_STRIDE);
+	for (unsigned int i = 0U; i < frames; i++) {
+		unsigned char* frame = &data[i * FRAME_STRIDE];
+		randomData(frame, bits);
+
+		unsigned int errors[FRAME_STRIDE];
+		for (;;) {
+			regenerate(frame, errors);
+			if (regenerate(frame, errors) == 0U)
+				break;
+
+			for (unsigned int p = 0U; p < parts; p++) {
+				if (errors[p] != 0U) {
+					for (unsigned int j = 0U; j < partBytes; j++)
+						frame[p * partBytes + j] = rng();
+				}
+			}
+		}
+	}
+
+	std::vector<unsigned char> mask(bytes, 0x00U);
+	for (unsigned int i = 0U; i < bits; i++) {
+		unsigned char frame[FRAME_STRIDE];
+		::memcpy(frame, &data[0U], FRAME_STRIDE);
+		frame[i / 8U] ^= 0x80U >> (i % 8U);
+
+		unsigned int errors[FRAME_STRIDE];
+		regenerate(frame, errors);
+		if (::memcmp(frame, &data[0U], bytes) == 0)
+			mask[i / 8U] |= 0x80U >> (i % 8U);
+	}
+
+	auto copy = [&](const unsigned char* in, unsigned char* out) { unsigned int errors[FRAME_STRIDE]; ::memcpy(out, in, bytes); regenerate(out, errors); };
+
+	bench(name, bits, ranges, nRanges, data, copy, [&](const unsigned char* in, unsigned char* out) { copy(in, out); return true; }, mask.data());
+}
+
+struct CHammingCodec {
+	const char*  m_name;
+	unsigned int m_n;
+	unsigned int m_k;
+	unsigned int (*m_encode)(unsigned int data);
+	bool         (*m_decode)(unsigned int& code);
+};
+
+static void benchBlock()
+{
+	bench("golay23127", 12U, BITS_23, 1U,
+		[](const unsigned char* in, unsigned char* out) { putBits(out, CGolay24128::encode23127(getBits(in, 12U)) >> 1, 23U); },
+		[](const unsigned char* in, unsigned char* out) { putBits(out, CGolay24128::decode23127(getBits(in, 23U)), 12U); return true; });
+
+	bench("golay24128", 12U, BITS_24, 1U,
+		[](const unsigned char* in, unsigned char* out) { putBits(out, CGolay24128::encode24128(getBits(in, 12U)), 24U); },
+		[](const unsigned char* in, unsigned char* out) {
+			unsigned int data;
+			bool valid = CGolay24128::decode24128(getBits(in, 24U), data);
+			putBits(out, data, 12U);
+			return valid;
+		});
+
+#if defined(USE_DMR)
+	bench("golay2087", 8U, BITS_20, 1U,
+		[](const unsigned char* in, unsigned char* out) { out[0U] = in[0U]; CGolay2087::encode(out); },
+		[](const unsigned char* in, unsigned char* out) { out[0U] = CGolay2087::decode(in); return true; });
+
+	bench("qr1676", 7U, BITS_16, 1U,
+		[](const unsigned char* in, unsigned char* out) { out[0U] = in[0U]; CQR1676::encode(out); },
+		[](const unsigned char* in, unsigned char* out) { out[0U] = CQR1676::decode(in) << 1; return true; });
+#endif
+
+	const CHammingCodec HAMMING[] = {
+		{"hamming15113_1", 15U, 11U, &CHamming::encode15113_1, &CHamming::decode15113_1},
+		{"hamming15113_2", 15U, 11U, &CHamming::encode15113_2, &CHamming::decode15113_2},
+		{"hamming1393",    13U,  9U, &CHamming::encode1393,    &CHamming::decode1393},
+		{"hamming1063",    10U,  6U, &CHamming::encode1063,    &CHamming::decode1063},
+		{"hamming16114",   16U, 11U, &CHamming::encode16114,   &CHamming::decode16114},
+		{"hamming17123",   17U, 12U, &CHamming::encode17123,   &CHamming::decode17123}};
+
+	for (const CHammingCodec& codec : HAMMING) {
+		const CBitRange bits[] = { {0U, codec.m_n} };
+		bench(codec.m_name, codec.m_k, bits, 1U,
+			[&codec](const unsigned char* in, unsigned char* out) { putBits(out, codec.m_encode(getBits(in, codec.m_k)), codec.m_n); },
+			[&codec](const unsigned char* in, unsigned char* out) {
+				unsigned int code = getBits(in, codec.m_n);
+				codec.m_decode(code);
+				putBits(out, code >> (codec.m_n - codec.m_k), codec.m_k);
+				return true;
+			});
+	}
+}
+
+static void benchDMR()
+{
+#if defined(USE_DMR)
+	bench("bptc19696", 96U, DMR_BURST, 2U,
+		[](const unsigned char* in, unsigned char* out) { CBPTC19696 bptc; bptc.encode(in, out); },
+		[](const unsigned char* in, unsigned char* out) { CBPTC19696 bptc; bptc.decode(in, out); return true; });
+
+	bench("dmrtrellis", 144U, DMR_BURST, 2U,
+		[](const unsigned char* in, unsigned char* out) { CDMRTrellis trellis; trellis.encode(in, out); },
+		[](const unsigned char* in, unsigned char* out) { CDMRTrellis trellis; return trellis.decode(in, out); });
+
+	bench("crc8", 72U, BITS_80, 1U,
+		[](const unsigned char* in, unsigned char* out) { ::memcpy(out, in, 9U); out[9U] = CCRC::crc8(out, 9U); },
+		[](const unsigned char* in, unsigned char* out) { ::memcpy(out, in, 9U); return CCRC::crc8(in, 9U) == in[9U]; });
+#endif
+
+#if defined(USE_DMR) || defined(USE_YSF) || defined(USE_P25)
+	bench("ccitt162", 80U, BITS_96, 1U,
+		[](const unsigned char* in, unsigned char* out) { ::memcpy(out, in, 10U); CCRC::addCCITT162(out, 12U); },
+		[](const unsigned char* in, unsigned char* out) { ::memcpy(out, in, 10U); return CCRC::checkCCITT162(in, 12U); });
+#endif
+
+#if defined(USE_DSTAR)
+	bench("ccitt161", 312U, BITS_328, 1U,
+		[](const unsigned char* in, unsigned char* out) { ::memcpy(out, in, 39U); CCRC::addCCITT161(out, 41U); },
+		[](const unsigned char* in, unsigned char* out) { ::memcpy(out, in, 39U); return CCRC::checkCCITT161(in, 41U); });
+#endif
+}
+
+static void benchConvolution()
+{
+#if defined(USE_P25)
+	bench("p25trellis34", 144U, BITS_196, 1U,
+		[](const unsigned char* in, unsigned char* out) { CP25Trellis trellis; trellis.encode34(in, out); },
+		[](const unsigned char* in, unsigned char* out) { CP25Trellis trellis; return trellis.decode34(in, out); });
+
+	bench("p25trellis12", 96U, BITS_196, 1U,
+		[](const unsigned char* in, unsigned char* out) { CP25Trellis trellis; trellis.encode12(in, out); },
+		[](const unsigned char* in, unsigned char* out) { CP25Trellis trellis; return trellis.decode12(in, out); });
+#endif
+
+#if defined(USE_YSF)
+	// 176 data bits and four tail bits at rate 1/2
+	bench("ysfconvolution", 176U, BITS_360, 1U,
+		[](const unsigned char* in, unsigned char* out) { CYSFConvolution conv; conv.encode(in, out, 180U); },
+		[](const unsigned char* in, unsigned char* out) {
+			uint8_t symbols[360U];
+			for (unsigned int i = 0U; i < 360U; i++)
+				symbols[i] = (in[i / 8U] & (0x80U >> (i % 8U))) != 0U ? 1U : 0U;
+
+			CYSFConvolution conv;
+			conv.start();
+			conv.decode(symbols, 180U);
+			conv.chainback(out, 176U);
+			return true;
+		});
+#endif
+
+#if defined(USE_NXDN)
+	// 92 data bits and four tail bits at rate 1/2, unpunctured
+	bench("nxdnconvolution", 92U, BITS_192, 1U,
+		[](const unsigned char* in, unsigned char* out) { CNXDNConvolution conv; conv.encode(in, out, 96U); },
+		[](const unsigned char* in, unsigned char* out) {
+			uint8_t symbols[200U];
+			for (unsigned int i = 0U; i < 192U; i++)
+				symbols[i] = (in[i / 8U] & (0x80U >> (i % 8U))) != 0U ? 2U : 0U;
+			for (unsigned int i = 192U; i < 200U; i++)
+				symbols[i] = 0U;
+
+			CNXDNConvolution conv;
+			conv.start();
+			conv.decode(symbols, 100U);
+			conv.chainback(out, 96U);
+			return true;
+		});
+#endif
+}
+
+static void benchRS()
+{
+#if defined(USE_P25)
+	bench("rs241213", 72U, BITS_144, 1U,
+		[](const unsigned char* in, unsigned char* out) { CRS634717 rs; ::memcpy(out, in, 9U); rs.encode241213(out); },
+		[](const unsigned char* in, unsigned char* out) { CRS634717 rs; ::memcpy(out, in, 18U); return rs.decode241213(out); });
+
+	bench("rs24169", 96U, BITS_144, 1U,
+		[](const unsigned char* in, unsigned char* out) { CRS634717 rs; ::memcpy(out, in, 12U); rs.encode24169(out); },
+		[](const unsigned char* in, unsigned char* out) { CRS634717 rs; ::memcpy(out, in, 18U); return rs.decode24169(out); });
+
+	bench("rs362017", 120U, BITS_216, 1U,
+		[](const unsigned char* in, unsigned char* out) { CRS634717 rs; ::memcpy(out, in, 15U); rs.encode362017(out); },
+		[](const unsigned char* in, unsigned char* out) { CRS634717 rs; ::memcpy(out, in, 27U); return rs.decode362017(out); });
+
+	bench("bch6316", 16U, BITS_63, 1U,
+		[](const unsigned char* in, unsigned char* out) { CBCH bch; ::memcpy(out, in, 2U); bch.encode(out); },
+		[](const unsigned char* in, unsigned char* out) { CBCH bch; unsigned int errors; ::memcpy(out, in, 8U); return bch.decode(out, errors); });
+#endif
+}
+
+static void benchAMBE()
+{
+#if defined(USE_DMR) || defined(USE_YSF) || defined(USE_NXDN)
+	benchRegenerate("ambefec_dmr", 264U, DMR_AMBE, 2U, 1U,
+		[](unsigned char* bytes, unsigned int* errors) { CAMBEFEC fec; return fec.regenerateDMR(bytes, 1U, 33U, errors); });
+#endif
+
+#if defined(USE_YSF) || defined(USE_NXDN)
+	benchRegenerate("ambefec_ysfdn", 72U, BITS_72, 1U, 1U,
+		[](unsigned char* bytes, unsigned int* errors) { CAMBEFEC fec; return fec.regenerateYSFDN(bytes, 1U, 9U, errors); });
+
+	// The four frames of an NXDN voice frame, decoded together
+	benchRegenerate("ambefec_ysfdn_x4", 288U, BITS_288, 1U, 4U,
+		[](unsigned char* bytes, unsigned int* errors) { CAMBEFEC fec; return fec.regenerateYSFDN(bytes, 4U, 9U, errors); });
+#endif
+
+#if defined(USE_DSTAR)
+	benchRegenerate("ambefec_dstar", 72U, BITS_72, 1U, 1U,
+		[](unsigned char* bytes, unsigned int* errors) { CAMBEFEC fec; return errors[0U] = fec.regenerateDStar(bytes); });
+#endif
+
+#if defined(USE_YSF) || defined(USE_P25)
+	benchRegenerate("ambefec_imbe", 144U, BITS_144, 1U, 1U,
+		[](unsigned char* bytes, unsigned int* errors) { CAMBEFEC fec; return errors[0U] = fec.regenerateIMBE(bytes); });
+#endif
+}
+
+int main(int argc, char** argv)
+{
+	unsigned int seed = 1U;
+	bool forceScalar = false;
+
+	for (int i = 1; i < argc; i++) {
+		if (::strcmp(argv[i], "-f") == 0 && (i + 1) < argc) {
+			frames = (unsigned int)::atoi(argv[++i]);
+		} else if (::strcmp(argv[i], "-s") == 0 && (i + 1) < argc) {
+			seed = (unsigned int)::atoi(argv[++i]);
+		} else if (::strcmp(argv[i], "-S") == 0) {
+			forceScalar = true;
+		} else if (argv[i][0U] != '-') {
+			bers.push_back(::atof(argv[i]));
+		} else {
+			::fprintf(stderr, "Usage: FECBench [-f frames] [-s seed] [-S] [ber ...]\n");
+			return 1;
+		}
+	}
+
+	if (frames == 0U)
+		frames = DEFAULT_FRAMES;
+
+	if (bers.empty())
+		bers = {0.0, 0.001, 0.01, 0.05};
+
+	rng.seed(seed);
+
+	// Keep the log off stdout, which only holds the JSON
+	LogInitialise(0U, 0U);
+
+	CCPUFeatures::init(forceScalar);
+#if defined(USE_DMR) || defined(USE_DSTAR) || defined(USE_YSF) || defined(USE_NXDN)
+	CAMBEFEC::init();
+#endif
+#if defined(USE_YSF) || defined(USE_NXDN)
+	CViterbiACS::init();
+#endif
+
+	unsigned int features = forceScalar ? 0U : CCPUFeatures::getDetected();
+
+	::printf("{\"frames\": %u, \"seed\": %u, \"features\": \"%s\", \"results\": [", frames, seed, CCPUFeatures::toString(features).c_str());
+
+	benchBlock();
+	benchDMR();
+	benchConvolution();
+	benchRS();
+	benchAMBE();
+
+	::printf("\n]}\n");
+
+	return 0;
+}
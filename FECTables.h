@@ -0,0 +1,413 @@
+/*
+ *   Copyright (C) 2025 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(FECTables_H)
+#define	FECTables_H
+
+#include <cassert>
+#include <cstdint>
+
+/*
+ * Lookup tables for the block codes and interleavers, built at compile time from their
+ * generator polynomials, parity checks or bit orders. Each table object should be declared constexpr next to its code and
+ * checked with static_asserts, so a wrong polynomial stops the build rather than corrupting
+ * data. The tables are aligned to cache lines as they are read on every frame.
+ */
+constexpr unsigned int FEC_TABLE_ALIGNMENT = 64U;
+
+constexpr unsigned int fecCountBits(unsigned int v)
+{
+	unsigned int count = 0U;
+	for (; v != 0U; v &= v - 1U)
+		count++;
+
+	return count;
+}
+
+constexpr unsigned int fecParity(unsigned int v)
+{
+	return fecCountBits(v) & 0x01U;
+}
+
+// The remainder of pattern(x) divided by genpol(x), which has the given degree
+constexpr unsigned int fecRemainder(unsigned int pattern, unsigned int genpol, unsigned int degree)
+{
+	for (unsigned int bit = 31U; bit >= degree; bit--) {
+		if ((pattern & (1U << bit)) != 0U)
+			pattern ^= genpol << (bit - degree);
+	}
+
+	return pattern;
+}
+
+// Step to the next set of w bit positions out of n in lexicographic order, false after the last
+constexpr bool fecNextPattern(unsigned int* pos, unsigned int w, unsigned int n)
+{
+	unsigned int i = w;
+	while (i > 0U && pos[i - 1U] == (n - w + i - 1U))
+		i--;
+
+	if (i == 0U)
+		return false;
+
+	pos[i - 1U]++;
+	for (unsigned int j = i; j < w; j++)
+		pos[j] = pos[j - 1U] + 1U;
+
+	return true;
+}
+
+/*
+ * A systematic (N,K) cyclic code. The codeword holds the data in the top K bits and the
+ * remainder in the bottom N - K. The syndrome of a pattern is found from two tables that
+ * cover the upper and lower halves of the data bits. The decoding table holds the lightest
+ * error pattern of at most W bits for every syndrome, taking the first in lexicographic order
+ * of bit positions when there is a choice, or zero when there is none.
+ */
+template <unsigned int N, unsigned int K, unsigned int W>
+class CCyclicTables {
+public:
+	static const unsigned int P     = N - K;
+	static const unsigned int SPLIT = (K + 1U) / 2U;
+
+	constexpr CCyclicTables(unsigned int genpol) :
+	m_genpol(genpol),
+	m_encode(),
+	m_decode(),
+	m_syndromeLo(),
+	m_syndromeHi()
+	{
+		for (unsigned int d = 0U; d < (1U << K); d++)
+			m_encode[d] = (d << P) | fecRemainder(d << P, genpol, P);
+
+		for (unsigned int q = 0U; q < (1U << SPLIT); q++)
+			m_syndromeLo[q] = fecRemainder(q << P, genpol, P);
+
+		for (unsigned int q = 0U; q < (1U << (K - SPLIT)); q++)
+			m_syndromeHi[q] = fecRemainder(q << (P + SPLIT), genpol, P);
+
+		bool found[1U << P] = {};
+		found[0U] = true;
+
+		for (unsigned int w = 1U; w <= W; w++) {
+			unsigned int pos[W] = {};
+			for (unsigned int i = 0U; i < w; i++)
+				pos[i] = i;
+
+			do {
+				unsigned int pattern = 0U;
+				for (unsigned int i = 0U; i < w; i++)
+					pattern |= 1U << pos[i];
+
+				unsigned int s = syndrome(pattern);
+				if (!found[s]) {
+					m_decode[s] = pattern;
+					found[s]    = true;
+				}
+			} while (fecNextPattern(pos, w, N));
+		}
+	}
+
+	constexpr unsigned int syndrome(unsigned int pattern) const
+	{
+		return (pattern & ((1U << P) - 1U)) ^ m_syndromeLo[(pattern >> P) & ((1U << SPLIT) - 1U)] ^ m_syndromeHi[(pattern >> (P + SPLIT)) & ((1U << (K - SPLIT)) - 1U)];
+	}
+
+	// Every codeword has a zero syndrome, and every error pattern has the syndrome it is
+	// stored under, found both by the tables and by long division
+	constexpr bool verify() const
+	{
+		for (unsigned int d = 0U; d < (1U << K); d++) {
+			if (syndrome(m_encode[d]) != 0U || fecRemainder(m_encode[d], m_genpol, P) != 0U)
+				return false;
+		}
+
+		for (unsigned int s = 0U; s < (1U << P); s++) {
+			if (syndrome(m_decode[s]) != ((m_decode[s] == 0U) ? 0U : s))
+				return false;
+			if (fecRemainder(m_decode[s], m_genpol, P) != syndrome(m_decode[s]))
+				return false;
+			if (fecCountBits(m_decode[s]) > W || m_decode[s] >= (1U << N))
+				return false;
+		}
+
+		return true;
+	}
+
+	// Every error pattern of up to t bits, in any position, is found from its syndrome. As the
+	// code is linear this covers every codeword with every such error, so it is an exhaustive
+	// check of the decoder up to the correction radius of the code
+	constexpr bool corrects(unsigned int t) const
+	{
+		for (unsigned int w = 1U; w <= t; w++) {
+			unsigned int pos[W] = {};
+			for (unsigned int i = 0U; i < w; i++)
+				pos[i] = i;
+
+			do {
+				unsigned int pattern = 0U;
+				for (unsigned int i = 0U; i < w; i++)
+					pattern |= 1U << pos[i];
+
+				if (m_decode[syndrome(pattern)] != pattern)
+					return false;
+			} while (fecNextPattern(pos, w, N));
+		}
+
+		return true;
+	}
+
+	// Every syndrome has an error pattern, as with a perfect code
+	constexpr bool complete() const
+	{
+		for (unsigned int s = 1U; s < (1U << P); s++) {
+			if (m_decode[s] == 0U)
+				return false;
+		}
+
+		return true;
+	}
+
+	unsigned int m_genpol;
+	alignas(FEC_TABLE_ALIGNMENT) unsigned int m_encode[1U << K];
+	alignas(FEC_TABLE_ALIGNMENT) unsigned int m_decode[1U << P];
+	alignas(FEC_TABLE_ALIGNMENT) unsigned int m_syndromeLo[1U << SPLIT];
+	alignas(FEC_TABLE_ALIGNMENT) unsigned int m_syndromeHi[1U << (K - SPLIT)];
+};
+
+/*
+ * A Hamming code given by the data bits that each parity bit covers. The first table is the
+ * parity for every possible data word, the second gives the bit to flip in the codeword for
+ * every syndrome, or HAMMING_NO_FIX when the syndrome isn't that of a single bit error.
+ */
+constexpr unsigned int HAMMING_NO_FIX = 0xFFFFFFFFU;
+
+template <unsigned int N, unsigned int K>
+class CHammingTables {
+public:
+	static const unsigned int P = N - K;
+
+	constexpr CHammingTables(const unsigned int (&checks)[N - K]) :
+	m_parity(),
+	m_error()
+	{
+		for (unsigned int d = 0U; d < (1U << K); d++) {
+			unsigned int p = 0U;
+			for (unsigned int i = 0U; i < P; i++)
+				p = (p << 1) | fecParity(d & checks[i]);
+			m_parity[d] = p;
+		}
+
+		for (unsigned int s = 1U; s < (1U << P); s++)
+			m_error[s] = HAMMING_NO_FIX;
+
+		for (unsigned int i = 0U; i < P; i++)
+			m_error[1U << i] = 1U << i;
+
+		for (unsigned int i = 0U; i < K; i++)
+			m_error[m_parity[1U << i]] = 1U << (i + P);
+	}
+
+	constexpr unsigned int encode(unsigned int data) const
+	{
+		assert(data < (1U << K));
+
+		return (data << P) | m_parity[data];
+	}
+
+	constexpr unsigned int error(unsigned int code) const
+	{
+		assert(code < (1U << N));
+
+		return m_error[m_parity[code >> P] ^ (code & ((1U << P) - 1U))];
+	}
+
+	// Every single bit error in every codeword is found, which needs distinct non-zero
+	// syndromes for all N bit positions
+	constexpr bool verify() const
+	{
+		for (unsigned int d = 0U; d < (1U << K); d++) {
+			unsigned int code = encode(d);
+			if (error(code) != 0U)
+				return false;
+
+			for (unsigned int i = 0U; i < N; i++) {
+				if (error(code ^ (1U << i)) != (1U << i))
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+private:
+	alignas(FEC_TABLE_ALIGNMENT) unsigned char m_parity[1U << K];
+	alignas(FEC_TABLE_ALIGNMENT) unsigned int  m_error[1U << P];
+};
+
+/*
+ * Log and antilog tables for GF(2^M) with the given primitive polynomial. The antilog table
+ * is doubled so that the sum of two logs can be looked up without a modulo.
+ */
+template <unsigned int M>
+class CGaloisTables {
+public:
+	static const unsigned int SIZE = (1U << M) - 1U;
+
+	constexpr CGaloisTables(unsigned int poly) :
+	m_exp(),
+	m_log()
+	{
+		unsigned int a = 0x01U;
+		for (unsigned int i = 0U; i < SIZE; i++) {
+			m_exp[i]        = (unsigned char)a;
+			m_exp[i + SIZE] = (unsigned char)a;
+			m_log[a]        = (unsigned char)i;
+
+			a <<= 1;
+			if ((a & (1U << M)) != 0U)
+				a ^= poly;
+		}
+
+		m_log[0U] = 0U;
+	}
+
+	// The polynomial is primitive when alpha runs through every non-zero element
+	constexpr bool verify() const
+	{
+		for (unsigned int a = 1U; a <= SIZE; a++) {
+			if (m_exp[m_log[a]] != a)
+				return false;
+		}
+
+		return true;
+	}
+
+	alignas(FEC_TABLE_ALIGNMENT) unsigned char m_exp[2U * SIZE];
+	alignas(FEC_TABLE_ALIGNMENT) unsigned char m_log[SIZE + 1U];
+};
+
+/*
+ * An interleaver given by the place that each of the N bits sent takes in the de-interleaved
+ * frame, found from a function of the bit number. The places are held in whatever form the
+ * code that uses them wants, which is why they are only checked to be distinct and in range.
+ */
+template <typename T, unsigned int N>
+class CInterleaveTables {
+public:
+	template <typename PLACE>
+	constexpr CInterleaveTables(PLACE place) :
+	m_place()
+	{
+		for (unsigned int n = 0U; n < N; n++)
+			m_place[n] = T(place(n));
+	}
+
+	// No two bits sent share a place, and every place is below the limit
+	constexpr bool verify(unsigned int limit) const
+	{
+		for (unsigned int i = 0U; i < N; i++) {
+			if (m_place[i] >= limit)
+				return false;
+
+			for (unsigned int j = i + 1U; j < N; j++) {
+				if (m_place[i] == m_place[j])
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+	alignas(FEC_TABLE_ALIGNMENT) T m_place[N];
+};
+
+/*
+ * A frame interleaved W ways, where bit n belongs to phase n % W, is split into its phases a
+ * group of G bytes at a time, each holding BITS = G * 8 / W bits of every phase. The gather
+ * table gives, for each byte of a group and each value of it, the bits of every phase that it
+ * holds in fields F bits wide, phase 0 highest and the first bit of a phase the highest of its
+ * field. The scatter table gives the bits of the group for each phase and value of its bits,
+ * so that a group is put back together by or-ing one entry for each phase.
+ */
+template <unsigned int W, unsigned int G, unsigned int F>
+class CPhaseTables {
+public:
+	static const unsigned int BITS = G * 8U / W;
+
+	static_assert((G * 8U) % W == 0U, "A group must hold the same number of bits of each phase");
+	static_assert(BITS <= F && (W * F) <= 64U, "The fields must hold the bits of a group and fit in 64 bits");
+
+	constexpr CPhaseTables() :
+	m_gather(),
+	m_scatter()
+	{
+		for (unsigned int g = 0U; g < G; g++) {
+			for (unsigned int v = 0U; v < 256U; v++) {
+				uint64_t fields = 0U;
+				for (unsigned int j = 0U; j < 8U; j++) {
+					unsigned int n = g * 8U + j;
+					if ((v & (0x80U >> j)) != 0U)
+						fields |= uint64_t(1U) << ((W - 1U - n % W) * F + (BITS - 1U - n / W));
+				}
+
+				m_gather[g][v] = fields;
+			}
+		}
+
+		for (unsigned int p = 0U; p < W; p++) {
+			for (unsigned int v = 0U; v < (1U << BITS); v++) {
+				unsigned int group = 0U;
+				for (unsigned int b = 0U; b < BITS; b++) {
+					unsigned int n = b * W + p;
+					if ((v & (1U << (BITS - 1U - b))) != 0U)
+						group |= 1U << (G * 8U - 1U - n);
+				}
+
+				m_scatter[p][v] = group;
+			}
+		}
+	}
+
+	// Scattering the phases gathered from any byte gives back that byte in its place
+	constexpr bool verify() const
+	{
+		for (unsigned int g = 0U; g < G; g++) {
+			for (unsigned int v = 0U; v < 256U; v++) {
+				unsigned int group = 0U;
+				for (unsigned int p = 0U; p < W; p++) {
+					uint64_t field = (m_gather[g][v] >> ((W - 1U - p) * F)) & ((uint64_t(1U) << F) - 1U);
+					if (field >= (1U << BITS))
+						return false;
+
+					group |= m_scatter[p][field];
+				}
+
+				if (group != (v << ((G - 1U - g) * 8U)))
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+	alignas(FEC_TABLE_ALIGNMENT) uint64_t     m_gather[G][256U];
+	alignas(FEC_TABLE_ALIGNMENT) unsigned int m_scatter[W][1U << BITS];
+};
+
+#endif
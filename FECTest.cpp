@@ -0,0 +1,1095 @@
+/*
+ *   Copyright (C) 2025 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/*
+ * A differential test of the FEC codecs, built and run with "make test". Each codec is compared
+ * with the code it replaced, which is kept unchanged in the Baseline directory inside the
+ * Baseline namespace. The Golay codes are swept over every message with every error pattern of
+ * up to three bits, and the QR and Hamming codes over every possible codeword. BPTC, the CRCs,
+ * the YSF and NXDN convolutional codes, the AMBE FEC and the trellis and Reed-Solomon codes are
+ * given random data and errors from a fixed seed. Any difference in the encoding, the decoded
+ * data, the validity or the number of errors fails the test. The codecs that choose their code
+ * from the CPU features are run both with the features found and with the portable code.
+ *
+ * The trellis and Reed-Solomon decoders now correct more frames than the code they replaced,
+ * so they are checked as a superset instead: every frame that the old decoder got right must
+ * be got right by the new one, and the counts for both are reported. The trellis decoders are
+ * partly exempt from this, as described at testSuperset().
+ *
+ * Usage: FECTest [-f frames] [-s seed]
+ */
+
+#include "Baseline/NXDNConvolution.h"
+#include "Baseline/YSFConvolution.h"
+#include "Baseline/Golay24128.h"
+#include "Baseline/Golay2087.h"
+#include "Baseline/BPTC19696.h"
+#include "Baseline/DMRTrellis.h"
+#include "Baseline/P25Trellis.h"
+#include "Baseline/RS634717.h"
+#include "Baseline/Hamming.h"
+#include "Baseline/P25NID.h"
+#include "Baseline/QR1676.h"
+#include "Baseline/AMBEFEC.h"
+#include "Baseline/CRC.h"
+#include "Baseline/BCH.h"
+
+#include "NXDNConvolution.h"
+#include "YSFConvolution.h"
+#include "CPUFeatures.h"
+#include "DMRTrellis.h"
+#include "P25Trellis.h"
+#include "P25Defines.h"
+#include "ViterbiACS.h"
+#include "Golay24128.h"
+#include "Golay2087.h"
+#include "BPTC19696.h"
+#include "RS634717.h"
+#include "P25Utils.h"
+#include "Hamming.h"
+#include "P25NID.h"
+#include "QR1676.h"
+#include "AMBEFEC.h"
+#include "Defines.h"
+#include "CRC.h"
+#include "BCH.h"
+#include "Utils.h"
+#include "Log.h"
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+const unsigned int DEFAULT_FRAMES = 20000U;
+
+const unsigned int DEFAULT_SEED = 1U;
+
+// Only the first few differences of each codec are printed
+const unsigned int MAX_REPORTS = 10U;
+
+// The bit error rates for the codes given random errors
+const double BERS[] = {0.0, 0.01, 0.02, 0.05, 0.1};
+
+struct CBitRange {
+	unsigned int m_start;
+	unsigned int m_end;
+};
+
+// The coded bits of a DMR burst either side of the sync or EMB
+const CBitRange DMR_BURST[] = { {0U, 98U}, {166U, 264U} };
+
+// The AMBE bits of a DMR voice burst either side of the sync or EMB
+const CBitRange DMR_AMBE[] = { {0U, 108U}, {156U, 264U} };
+
+const CBitRange BITS_72[]  = { {0U, 72U} };
+const CBitRange BITS_144[] = { {0U, 144U} };
+const CBitRange BITS_196[] = { {0U, 196U} };
+const CBitRange BITS_216[] = { {0U, 216U} };
+
+static std::mt19937 rng;
+static unsigned int frames = DEFAULT_FRAMES;
+
+static const char*  codec = nullptr;
+static unsigned int cases = 0U;
+static unsigned int differences = 0U;
+static unsigned int failures = 0U;
+
+static void start(const char* name)
+{
+	codec       = name;
+	cases       = 0U;
+	differences = 0U;
+}
+
+static void check(bool same, const char* fmt, ...)
+{
+	cases++;
+	if (same)
+		return;
+
+	if (differences++ < MAX_REPORTS) {
+		::printf("%s: difference at ", codec);
+
+		va_list vl;
+		va_start(vl, fmt);
+		::vprintf(fmt, vl);
+		va_end(vl);
+
+		::printf("\n");
+	}
+}
+
+static void finish()
+{
+	::printf("%s: %u cases, %u differences\n", codec, cases, differences);
+
+	failures += differences;
+}
+
+// Every error pattern of up to three bits in a word of n bits, starting with no error
+template <typename FUNCTION>
+static void forEachError(unsigned int n, FUNCTION function)
+{
+	function(0U);
+
+	for (unsigned int i = 0U; i < n; i++) {
+		function(1U << i);
+
+		for (unsigned int j = i + 1U; j < n; j++) {
+			function((1U << i) | (1U << j));
+
+			for (unsigned int k = j + 1U; k < n; k++)
+				function((1U << i) | (1U << j) | (1U << k));
+		}
+	}
+}
+
+static void randomData(unsigned char* data, unsigned int bytes)
+{
+	for (unsigned int i = 0U; i < bytes; i++)
+		data[i] = rng();
+}
+
+static void addErrors(unsigned char* code, const CBitRange* ranges, unsigned int nRanges, double ber)
+{
+	if (ber <= 0.0)
+		return;
+
+	std::bernoulli_distribution flip(ber);
+
+	for (unsigned int r = 0U; r < nRanges; r++) {
+		for (unsigned int i = ranges[r].m_start; i < ranges[r].m_end; i++) {
+			if (flip(rng))
+				code[i / 8U] ^= 0x80U >> (i % 8U);
+		}
+	}
+}
+
+static void testGolay24128()
+{
+	std::vector<unsigned int> in;
+	std::vector<unsigned int> out;
+	std::vector<unsigned int> errors;
+	std::unique_ptr<bool[]> valid;
+
+	start("golay24128");
+
+	for (unsigned int data = 0U; data < 0x1000U; data++) {
+		unsigned int code = CGolay24128::encode24128(data);
+		check(code == Baseline::CGolay24128::encode24128(data), "encode 0x%03X", data);
+
+		in.clear();
+		forEachError(24U, [&](unsigned int error) { in.push_back(code ^ error); });
+
+		unsigned int count = in.size();
+		out.resize(count);
+		errors.resize(count);
+		valid.reset(new bool[count]);
+
+		CGolay24128::decode24128(in.data(), out.data(), valid.get(), errors.data(), count);
+
+		for (unsigned int i = 0U; i < count; i++) {
+			unsigned int oldData;
+			bool oldValid = Baseline::CGolay24128::decode24128(in[i], oldData);
+			unsigned int oldErrors = CUtils::countBits(in[i] ^ Baseline::CGolay24128::encode24128(oldData));
+
+			unsigned int newData;
+			bool newValid = CGolay24128::decode24128(in[i], newData);
+			check(newData == oldData && newValid == oldValid, "decode 0x%06X", in[i]);
+
+			unsigned char bytes[3U];
+			bytes[0U] = in[i] >> 16;
+			bytes[1U] = in[i] >> 8;
+			bytes[2U] = in[i] >> 0;
+			newValid = CGolay24128::decode24128(bytes, newData);
+			check(newData == oldData && newValid == oldValid, "byte decode 0x%06X", in[i]);
+
+			check(out[i] == oldData && valid[i] == oldValid && errors[i] == oldErrors, "batch decode 0x%06X", in[i]);
+		}
+	}
+
+	finish();
+}
+
+static void testGolay23127()
+{
+	std::vector<unsigned int> in;
+	std::vector<unsigned int> out;
+	std::vector<unsigned int> errors;
+
+	start("golay23127");
+
+	for (unsigned int data = 0U; data < 0x1000U; data++) {
+		unsigned int code = CGolay24128::encode23127(data);
+		check(code == Baseline::CGolay24128::encode23127(data), "encode 0x%03X", data);
+
+		in.clear();
+		forEachError(23U, [&](unsigned int error) { in.push_back((code >> 1) ^ error); });
+
+		unsigned int count = in.size();
+		out.resize(count);
+		errors.resize(count);
+
+		CGolay24128::decode23127(in.data(), out.data(), errors.data(), count);
+
+		for (unsigned int i = 0U; i < count; i++) {
+			unsigned int oldData   = Baseline::CGolay24128::decode23127(in[i]);
+			unsigned int oldErrors = CUtils::countBits(in[i] ^ (Baseline::CGolay24128::encode23127(oldData) >> 1));
+
+			check(CGolay24128::decode23127(in[i]) == oldData, "decode 0x%06X", in[i]);
+			check(out[i] == oldData && errors[i] == oldErrors, "batch decode 0x%06X", in[i]);
+		}
+	}
+
+	finish();
+}
+
+static void testGolay2087()
+{
+#if defined(USE_DMR)
+	start("golay2087");
+
+	for (unsigned int data = 0U; data < 0x100U; data++) {
+		unsigned char code[3U] = {(unsigned char)data, 0x00U, 0x00U};
+		CGolay2087::encode(code);
+
+		unsigned char oldCode[3U] = {(unsigned char)data, 0x00U, 0x00U};
+		Baseline::CGolay2087::encode(oldCode);
+		check(::memcmp(code, oldCode, 3U) == 0, "encode 0x%02X", data);
+
+		forEachError(20U, [&](unsigned int error) {
+			// The 20 coded bits are the top of the three bytes
+			unsigned char in[3U];
+			for (unsigned int i = 0U; i < 3U; i++)
+				in[i] = code[i] ^ ((error << 12) >> (24U - i * 8U));
+
+			check(CGolay2087::decode(in) == Baseline::CGolay2087::decode(in), "decode %02X%02X%02X", in[0U], in[1U], in[2U]);
+		});
+	}
+
+	finish();
+#endif
+}
+
+static void testQR1676()
+{
+#if defined(USE_DMR)
+	start("qr1676");
+
+	for (unsigned int data = 0U; data < 0x80U; data++) {
+		unsigned char code[2U] = {(unsigned char)(data << 1), 0x00U};
+		CQR1676::encode(code);
+
+		unsigned char oldCode[2U] = {(unsigned char)(data << 1), 0x00U};
+		Baseline::CQR1676::encode(oldCode);
+		check(::memcmp(code, oldCode, 2U) == 0, "encode 0x%02X", data);
+	}
+
+	for (unsigned int code = 0U; code < 0x10000U; code++) {
+		unsigned char in[2U] = {(unsigned char)(code >> 8), (unsigned char)code};
+		check(CQR1676::decode(in) == Baseline::CQR1676::decode(in), "decode 0x%04X", code);
+	}
+
+	finish();
+#endif
+}
+
+struct CHammingCodec {
+	const char*  m_name;
+	unsigned int m_n;
+	unsigned int m_k;
+	void         (*m_oldEncode)(bool* d);
+	bool         (*m_oldDecode)(bool* d);
+	void         (*m_encode)(bool* d);
+	bool         (*m_decode)(bool* d);
+	unsigned int (*m_packedEncode)(unsigned int data);
+	bool         (*m_packedDecode)(unsigned int& code);
+};
+
+static unsigned int packBits(const bool* d, unsigned int n)
+{
+	unsigned int v = 0U;
+	for (unsigned int i = 0U; i < n; i++)
+		v = (v << 1) | (d[i] ? 0x01U : 0x00U);
+
+	return v;
+}
+
+static void unpackBits(unsigned int v, bool* d, unsigned int n)
+{
+	for (unsigned int i = 0U; i < n; i++)
+		d[i] = (v & (1U << (n - i - 1U))) != 0U;
+}
+
+// Both the boolean and the packed decoders are compared with the old boolean one for every possible codeword
+static void testHamming()
+{
+	const CHammingCodec HAMMING[] = {
+		{"hamming15113_1", 15U, 11U, &Baseline::CHamming::encode15113_1, &Baseline::CHamming::decode15113_1, &CHamming::encode15113_1, &CHamming::decode15113_1, &CHamming::encode15113_1, &CHamming::decode15113_1},
+		{"hamming15113_2", 15U, 11U, &Baseline::CHamming::encode15113_2, &Baseline::CHamming::decode15113_2, &CHamming::encode15113_2, &CHamming::decode15113_2, &CHamming::encode15113_2, &CHamming::decode15113_2},
+		{"hamming1393",    13U,  9U, &Baseline::CHamming::encode1393,    &Baseline::CHamming::decode1393,    &CHamming::encode1393,    &CHamming::decode1393,    &CHamming::encode1393,    &CHamming::decode1393},
+		{"hamming1063",    10U,  6U, &Baseline::CHamming::encode1063,    &Baseline::CHamming::decode1063,    &CHamming::encode1063,    &CHamming::decode1063,    &CHamming::encode1063,    &CHamming::decode1063},
+		{"hamming16114",   16U, 11U, &Baseline::CHamming::encode16114,   &Baseline::CHamming::decode16114,   &CHamming::encode16114,   &CHamming::decode16114,   &CHamming::encode16114,   &CHamming::decode16114},
+		{"hamming17123",   17U, 12U, &Baseline::CHamming::encode17123,   &Baseline::CHamming::decode17123,   &CHamming::encode17123,   &CHamming::decode17123,   &CHamming::encode17123,   &CHamming::decode17123}};
+
+	for (const CHammingCodec& hamming : HAMMING) {
+		start(hamming.m_name);
+
+		for (unsigned int data = 0U; data < (1U << hamming.m_k); data++) {
+			bool oldCode[17U] = {};
+			unpackBits(data, oldCode, hamming.m_k);
+			hamming.m_oldEncode(oldCode);
+
+			bool code[17U] = {};
+			unpackBits(data, code, hamming.m_k);
+			hamming.m_encode(code);
+
+			check(::memcmp(code, oldCode, sizeof(code)) == 0, "encode 0x%04X", data);
+			check(hamming.m_packedEncode(data) == packBits(oldCode, hamming.m_n), "packed encode 0x%04X", data);
+		}
+
+		for (unsigned int in = 0U; in < (1U << hamming.m_n); in++) {
+			bool oldCode[17U] = {};
+			unpackBits(in, oldCode, hamming.m_n);
+			bool oldValid = hamming.m_oldDecode(oldCode);
+
+			bool code[17U] = {};
+			unpackBits(in, code, hamming.m_n);
+			bool valid = hamming.m_decode(code);
+
+			check(::memcmp(code, oldCode, sizeof(code)) == 0 && valid == oldValid, "decode 0x%05X", in);
+
+			unsigned int packed = in;
+			valid = hamming.m_packedDecode(packed);
+
+			check(packed == packBits(oldCode, hamming.m_n) && valid == oldValid, "packed decode 0x%05X", in);
+		}
+
+		finish();
+	}
+}
+
+static void testBPTC19696()
+{
+#if defined(USE_DMR)
+	start("bptc19696");
+
+	for (double ber : BERS) {
+		for (unsigned int n = 0U; n < frames; n++) {
+			unsigned char data[12U];
+			randomData(data, 12U);
+
+			unsigned char code[33U] = {};
+			CBPTC19696 bptc;
+			bptc.encode(data, code);
+
+			unsigned char oldCode[33U] = {};
+			Baseline::CBPTC19696 oldBptc;
+			oldBptc.encode(data, oldCode);
+
+			check(::memcmp(code, oldCode, 33U) == 0, "encode of frame %u at ber %g", n, ber);
+
+			addErrors(code, DMR_BURST, 2U, ber);
+
+			unsigned char out[12U];
+			bptc.decode(code, out);
+
+			unsigned char oldOut[12U];
+			oldBptc.decode(code, oldOut);
+
+			check(::memcmp(out, oldOut, 12U) == 0, "decode of frame %u at ber %g", n, ber);
+		}
+	}
+
+	finish();
+#endif
+}
+
+static unsigned int distance(const unsigned char* a, const unsigned char* b, unsigned int bytes)
+{
+	unsigned int count = 0U;
+	for (unsigned int i = 0U; i < bytes; i++)
+		count += CUtils::countBits(a[i] ^ b[i]);
+
+	return count;
+}
+
+/*
+ * Encode random frames with both codecs, which must agree, then add random errors and decode
+ * them with both. A frame that the old decoder returned as valid with the right data must be
+ * returned the same by the new decoder, and the new decoder must get at least as many frames
+ * right as the old one at every bit error rate. The encoders and decoders are given as
+ * functions of the data and the coded frame.
+ *
+ * The trellis decoders are exempt from the first check, as they are maximum likelihood
+ * decoders and no such decoder can get right every frame the old search did. Where another
+ * path is as close to or closer than the one sent, the old search could stumble on the one
+ * sent while the Viterbi decoder takes the nearest. For them, given a non-zero maxDistance,
+ * a frame that the old decoder got right may instead be decoded to a frame no further from
+ * what was received than the one sent, or be rejected when the one sent has more than
+ * maxDistance bit errors, the most the decoder accepts.
+ */
+template <typename ENCODE, typename OLD_ENCODE, typename DECODE, typename OLD_DECODE>
+static void testSuperset(const char* name, unsigned int dataBytes, unsigned int codeBytes, const CBitRange* ranges, unsigned int nRanges, unsigned int maxDistance, ENCODE encode, OLD_ENCODE oldEncode, DECODE decode, OLD_DECODE oldDecode)
+{
+	start(name);
+
+	for (double ber : BERS) {
+		unsigned int oldCorrected = 0U;
+		unsigned int newCorrected = 0U;
+
+		for (unsigned int n = 0U; n < frames; n++) {
+			unsigned char data[40U] = {};
+			randomData(data, dataBytes);
+
+			unsigned char sent[40U] = {};
+			encode(data, sent);
+
+			unsigned char oldCode[40U] = {};
+			oldEncode(data, oldCode);
+
+			check(::memcmp(sent, oldCode, codeBytes) == 0, "encode of frame %u at ber %g", n, ber);
+
+			unsigned char code[40U];
+			::memcpy(code, sent, sizeof(code));
+			addErrors(code, ranges, nRanges, ber);
+
+			unsigned char out[40U] = {};
+			bool decoded = decode(code, out);
+			bool valid = decoded && ::memcmp(out, data, dataBytes) == 0;
+
+			unsigned char oldOut[40U] = {};
+			bool oldValid = oldDecode(code, oldOut) && ::memcmp(oldOut, data, dataBytes) == 0;
+
+			if (valid)
+				newCorrected++;
+			if (oldValid)
+				oldCorrected++;
+
+			if (valid || !oldValid || maxDistance == 0U) {
+				check(valid || !oldValid, "decode of frame %u at ber %g", n, ber);
+			} else if (decoded) {
+				unsigned char chosen[40U] = {};
+				encode(out, chosen);
+				check(distance(code, chosen, codeBytes) <= distance(code, sent, codeBytes), "decode of frame %u at ber %g to a further frame", n, ber);
+			} else {
+				check(distance(code, sent, codeBytes) > maxDistance, "rejection of frame %u at ber %g", n, ber);
+			}
+		}
+
+		::printf("%s: ber %g, old corrected %u, new corrected %u of %u frames\n", name, ber, oldCorrected, newCorrected, frames);
+
+		check(newCorrected >= oldCorrected, "count of frames corrected at ber %g", ber);
+	}
+
+	finish();
+}
+
+static void testTrellis()
+{
+#if defined(USE_DMR)
+	testSuperset("dmrtrellis", 18U, 33U, DMR_BURST, 2U, DMR_TRELLIS_MAX_DISTANCE,
+		[](const unsigned char* in, unsigned char* out) { CDMRTrellis trellis; trellis.encode(in, out); },
+		[](const unsigned char* in, unsigned char* out) { Baseline::CDMRTrellis trellis; trellis.encode(in, out); },
+		[](const unsigned char* in, unsigned char* out) { CDMRTrellis trellis; return trellis.decode(in, out); },
+		[](const unsigned char* in, unsigned char* out) { Baseline::CDMRTrellis trellis; return trellis.decode(in, out); });
+#endif
+
+#if defined(USE_P25)
+	testSuperset("p25trellis34", 18U, 25U, BITS_196, 1U, P25_TRELLIS_MAX_DISTANCE_34,
+		[](const unsigned char* in, unsigned char* out) { CP25Trellis trellis; trellis.encode34(in, out); },
+		[](const unsigned char* in, unsigned char* out) { Baseline::CP25Trellis trellis; trellis.encode34(in, out); },
+		[](const unsigned char* in, unsigned char* out) { CP25Trellis trellis; return trellis.decode34(in, out); },
+		[](const unsigned char* in, unsigned char* out) { Baseline::CP25Trellis trellis; return trellis.decode34(in, out); });
+
+	testSuperset("p25trellis12", 12U, 25U, BITS_196, 1U, P25_TRELLIS_MAX_DISTANCE_12,
+		[](const unsigned char* in, unsigned char* out) { CP25Trellis trellis; trellis.encode12(in, out); },
+		[](const unsigned char* in, unsigned char* out) { Baseline::CP25Trellis trellis; trellis.encode12(in, out); },
+		[](const unsigned char* in, unsigned char* out) { CP25Trellis trellis; return trellis.decode12(in, out); },
+		[](const unsigned char* in, unsigned char* out) { Baseline::CP25Trellis trellis; return trellis.decode12(in, out); });
+#endif
+}
+
+static void testRS()
+{
+#if defined(USE_P25)
+	testSuperset("rs241213", 9U, 18U, BITS_144, 1U, 0U,
+		[](const unsigned char* in, unsigned char* out) { CRS634717 rs; ::memcpy(out, in, 9U); rs.encode241213(out); },
+		[](const unsigned char* in, unsigned char* out) { Baseline::CRS634717 rs; ::memcpy(out, in, 9U); rs.encode241213(out); },
+		[](const unsigned char* in, unsigned char* out) { CRS634717 rs; ::memcpy(out, in, 18U); return rs.decode241213(out); },
+		[](const unsigned char* in, unsigned char* out) { Baseline::CRS634717 rs; ::memcpy(out, in, 18U); return rs.decode241213(out); });
+
+	testSuperset("rs24169", 12U, 18U, BITS_144, 1U, 0U,
+		[](const unsigned char* in, unsigned char* out) { CRS634717 rs; ::memcpy(out, in, 12U); rs.encode24169(out); },
+		[](const unsigned char* in, unsigned char* out) { Baseline::CRS634717 rs; ::memcpy(out, in, 12U); rs.encode24169(out); },
+		[](const unsigned char* in, unsigned char* out) { CRS634717 rs; ::memcpy(out, in, 18U); return rs.decode24169(out); },
+		[](const unsigned char* in, unsigned char* out) { Baseline::CRS634717 rs; ::memcpy(out, in, 18U); return rs.decode24169(out); });
+
+	testSuperset("rs362017", 15U, 27U, BITS_216, 1U, 0U,
+		[](const unsigned char* in, unsigned char* out) { CRS634717 rs; ::memcpy(out, in, 15U); rs.encode362017(out); },
+		[](const unsigned char* in, unsigned char* out) { Baseline::CRS634717 rs; ::memcpy(out, in, 15U); rs.encode362017(out); },
+		[](const unsigned char* in, unsigned char* out) { CRS634717 rs; ::memcpy(out, in, 27U); return rs.decode362017(out); },
+		[](const unsigned char* in, unsigned char* out) { Baseline::CRS634717 rs; ::memcpy(out, in, 27U); return rs.decode362017(out); });
+#endif
+}
+
+static void unpackBytes(const unsigned char* in, bool* bits, unsigned int n)
+{
+	for (unsigned int i = 0U; i < n; i++)
+		bits[i] = (in[i / 8U] & (0x80U >> (i % 8U))) != 0U;
+}
+
+#if defined(USE_P25)
+// The most errors in a NID that the BCH (63,16,23) decoder corrects
+const unsigned int BCH_MAX_ERRORS = 11U;
+
+// The NID sits between the frame sync and the first status symbol pair
+const CBitRange P25_NID[] = { {48U, 114U} };
+
+const unsigned char P25_DUIDS[] = {P25_DUID_HEADER, P25_DUID_TERM, P25_DUID_LDU1, P25_DUID_TSDU, P25_DUID_LDU2, P25_DUID_PDU, P25_DUID_TERM_LC};
+
+/*
+ * Every NID is encoded by both codecs, which must agree, and then given from none up to eleven
+ * bit errors in distinct places among the 63 protected bits. The decoder must restore every
+ * one of them and report the number of errors. The final parity bit is not part of the code.
+ */
+static void testBCH()
+{
+	start("bch");
+
+	for (unsigned int n = 0U; n < frames; n++) {
+		unsigned char nid[P25_NID_LENGTH_BYTES];
+		randomData(nid, P25_NID_LENGTH_BYTES);
+
+		unsigned char oldNid[P25_NID_LENGTH_BYTES];
+		::memcpy(oldNid, nid, P25_NID_LENGTH_BYTES);
+
+		CBCH bch;
+		bch.encode(nid);
+
+		Baseline::CBCH oldBch;
+		oldBch.encode(oldNid);
+
+		check(::memcmp(nid, oldNid, P25_NID_LENGTH_BYTES) == 0, "encode of NID %u", n);
+
+		for (unsigned int count = 0U; count <= BCH_MAX_ERRORS; count++) {
+			unsigned char code[P25_NID_LENGTH_BYTES];
+			::memcpy(code, nid, P25_NID_LENGTH_BYTES);
+
+			bool flipped[63U] = {false};
+			for (unsigned int i = 0U; i < count; i++) {
+				unsigned int bit;
+				do {
+					bit = rng() % 63U;
+				} while (flipped[bit]);
+
+				flipped[bit] = true;
+				code[bit / 8U] ^= 0x80U >> (bit % 8U);
+			}
+
+			unsigned int errors;
+			bool valid = bch.decode(code, errors);
+
+			check(valid && errors == count && ::memcmp(code, nid, P25_NID_LENGTH_BYTES) == 0, "decode of NID %u with %u errors", n, count);
+		}
+	}
+
+	finish();
+}
+
+/*
+ * A NID is made for a random NAC and DUID by both versions of CP25NID, which must agree, and
+ * given random errors. Every NID that the old decoder accepted must be accepted by the new one
+ * with the same DUID. Where there are no more than eleven errors in the protected bits, the new
+ * decoder must accept the NID for its own NAC, reject it when set to another NAC, and accept it
+ * with its NAC when that is one of the other NACs to receive or when every NAC is received.
+ */
+static void testP25NID()
+{
+	start("p25nid");
+
+	for (double ber : BERS) {
+		unsigned int oldAccepted = 0U, accepted = 0U;
+
+		for (unsigned int n = 0U; n < frames; n++) {
+			unsigned int nac   = rng() % 0x1000U;
+			unsigned int other = nac ^ (1U + rng() % 0xFFFU);
+			unsigned char duid = P25_DUIDS[rng() % 7U];
+
+			CP25NID p25nid(nac, std::vector<unsigned int>());
+			Baseline::CP25NID oldP25nid(nac);
+
+			unsigned char frame[15U], oldFrame[15U];
+			randomData(frame, 15U);
+			::memcpy(oldFrame, frame, 15U);
+
+			p25nid.encode(frame, duid);
+			oldP25nid.encode(oldFrame, duid);
+
+			check(::memcmp(frame, oldFrame, 15U) == 0, "encode of NID %u at ber %g", n, ber);
+
+			unsigned char sent[P25_NID_LENGTH_BYTES];
+			CP25Utils::decode(frame, sent, 48U, 114U);
+
+			addErrors(frame, P25_NID, 1U, ber);
+
+			unsigned char received[P25_NID_LENGTH_BYTES];
+			CP25Utils::decode(frame, received, 48U, 114U);
+
+			// The parity bit at the end isn't protected
+			received[7U] = (received[7U] & 0xFEU) | (sent[7U] & 0x01U);
+			unsigned int errors = distance(sent, received, P25_NID_LENGTH_BYTES);
+
+			bool oldValid = oldP25nid.decode(frame);
+			bool valid    = p25nid.decode(frame);
+
+			if (oldValid) {
+				oldAccepted++;
+				check(valid && p25nid.getDUID() == oldP25nid.getDUID(), "decode of NID %u at ber %g", n, ber);
+			}
+
+			if (valid)
+				accepted++;
+
+			if (errors <= BCH_MAX_ERRORS) {
+				check(valid && p25nid.getDUID() == duid && p25nid.getNAC() == nac, "decode of NID %u with %u errors at ber %g", n, errors, ber);
+
+				CP25NID wrong(other, std::vector<unsigned int>());
+				check(!wrong.decode(frame), "decode of NID %u for NAC $%03X as NAC $%03X at ber %g", n, nac, other, ber);
+
+				CP25NID listed(other, std::vector<unsigned int>(1U, nac));
+				check(listed.decode(frame) && listed.getDUID() == duid && listed.getNAC() == nac, "decode of NID %u for NAC $%03X as another NAC to receive at ber %g", n, nac, ber);
+
+				CP25NID any(other, std::vector<unsigned int>(1U, P25_NAC_RX_ANY));
+				check(any.decode(frame) && any.getDUID() == duid && any.getNAC() == nac, "decode of NID %u for NAC $%03X when every NAC is received at ber %g", n, nac, ber);
+			}
+		}
+
+		::printf("p25nid: ber %g, old accepted %u, new accepted %u of %u frames\n", ber, oldAccepted, accepted, frames);
+	}
+
+	finish();
+}
+#endif
+
+// Random data of every length up to 64 bytes, checked as it is and with a bit in error
+static void testCRC()
+{
+	start("crc");
+
+	for (unsigned int length = 3U; length <= 64U; length++) {
+		for (unsigned int n = 0U; n < 200U; n++) {
+			unsigned char data[64U];
+			randomData(data, length);
+
+			unsigned int bit = rng() % (length * 8U);
+
+#if defined(USE_DMR)
+			check(CCRC::crc8(data, length) == Baseline::CCRC::crc8(data, length), "crc8 of %u bytes", length);
+#endif
+
+#if defined(USE_DMR) || defined(USE_YSF) || defined(USE_P25)
+			unsigned char code[64U], oldCode[64U];
+			::memcpy(code, data, length);
+			::memcpy(oldCode, data, length);
+			CCRC::addCCITT162(code, length);
+			Baseline::CCRC::addCCITT162(oldCode, length);
+			check(::memcmp(code, oldCode, length) == 0, "addCCITT162 of %u bytes", length);
+
+			check(CCRC::checkCCITT162(code, length) == Baseline::CCRC::checkCCITT162(code, length), "checkCCITT162 of %u bytes", length);
+			code[bit / 8U] ^= 0x80U >> (bit % 8U);
+			check(CCRC::checkCCITT162(code, length) == Baseline::CCRC::checkCCITT162(code, length), "checkCCITT162 of %u bytes with bit %u in error", length, bit);
+#endif
+
+#if defined(USE_DSTAR)
+			::memcpy(code, data, length);
+			::memcpy(oldCode, data, length);
+			CCRC::addCCITT161(code, length);
+			Baseline::CCRC::addCCITT161(oldCode, length);
+			check(::memcmp(code, oldCode, length) == 0, "addCCITT161 of %u bytes", length);
+
+			check(CCRC::checkCCITT161(code, length) == Baseline::CCRC::checkCCITT161(code, length), "checkCCITT161 of %u bytes", length);
+			code[bit / 8U] ^= 0x80U >> (bit % 8U);
+			check(CCRC::checkCCITT161(code, length) == Baseline::CCRC::checkCCITT161(code, length), "checkCCITT161 of %u bytes with bit %u in error", length, bit);
+#endif
+		}
+	}
+
+#if defined(USE_DMR)
+	// The five bit CRC now takes the nine bytes that the old one took as 72 bits
+	for (unsigned int n = 0U; n < frames; n++) {
+		unsigned char data[9U];
+		randomData(data, 9U);
+
+		bool bits[72U];
+		unpackBytes(data, bits, 72U);
+
+		unsigned int crc;
+		Baseline::CCRC::encodeFiveBit(bits, crc);
+		check(CCRC::encodeFiveBit(data) == crc, "encodeFiveBit of frame %u", n);
+
+		unsigned int tcrc = rng() % 32U;
+		check(CCRC::checkFiveBit(data, tcrc) == Baseline::CCRC::checkFiveBit(bits, tcrc), "checkFiveBit of frame %u", n);
+	}
+#endif
+
+	finish();
+}
+
+/*
+ * Random frames are encoded by both codecs, which must agree, then given random errors and
+ * decoded by the old decoder and by the new one, a symbol pair at a time and all together. The
+ * decoded bits and the path metric returned must all be the same. The symbols are hard bits
+ * scaled by the given value, and a flipped bit is sometimes sent as an erasure midway between.
+ */
+template <typename CODEC, typename OLD_CODEC>
+static void testConvolution(const char* name, unsigned int dataBits, unsigned int steps, uint8_t one)
+{
+	start(name);
+
+	for (double ber : BERS) {
+		std::bernoulli_distribution flip(ber);
+
+		for (unsigned int n = 0U; n < frames; n++) {
+			// The tail bits are left as zero
+			unsigned char data[25U] = {};
+			randomData(data, dataBits / 8U);
+
+			unsigned char code[50U] = {};
+			CODEC conv;
+			conv.encode(data, code, steps);
+
+			unsigned char oldCode[50U] = {};
+			OLD_CODEC oldConv;
+			oldConv.encode(data, oldCode, steps);
+
+			check(::memcmp(code, oldCode, sizeof(code)) == 0, "encode of frame %u at ber %g", n, ber);
+
+			uint8_t symbols[400U];
+			for (unsigned int i = 0U; i < (steps * 2U); i++) {
+				bool bit = (code[i / 8U] & (0x80U >> (i % 8U))) != 0U;
+				if (flip(rng))
+					symbols[i] = (one > 1U && (rng() % 4U) == 0U) ? (one / 2U) : (bit ? 0U : one);
+				else
+					symbols[i] = bit ? one : 0U;
+			}
+
+			oldConv.start();
+			for (unsigned int i = 0U; i < steps; i++)
+				oldConv.decode(symbols[i * 2U + 0U], symbols[i * 2U + 1U]);
+
+			unsigned char oldOut[25U] = {};
+			unsigned int oldMetric = oldConv.chainback(oldOut, dataBits);
+
+			conv.start();
+			for (unsigned int i = 0U; i < steps; i++)
+				conv.decode(symbols[i * 2U + 0U], symbols[i * 2U + 1U]);
+
+			unsigned char out[25U] = {};
+			unsigned int metric = conv.chainback(out, dataBits);
+
+			check(::memcmp(out, oldOut, sizeof(out)) == 0 && metric == oldMetric, "decode of frame %u at ber %g", n, ber);
+
+			conv.start();
+			conv.decode(symbols, steps);
+
+			::memset(out, 0x00U, sizeof(out));
+			metric = conv.chainback(out, dataBits);
+
+			check(::memcmp(out, oldOut, sizeof(out)) == 0 && metric == oldMetric, "block decode of frame %u at ber %g", n, ber);
+		}
+	}
+
+	finish();
+}
+
+/*
+ * The AMBE FEC is regenerated in place by both codecs, first from random bits and then from
+ * valid frames given random errors, and the frames and error counts must be the same. The
+ * batch calls regenerate several frames a stride apart, which must each come out as the old
+ * code makes them, with the bytes between them left alone.
+ */
+template <typename REGENERATE, typename OLD_REGENERATE, typename BATCH>
+static void testAMBE(const char* name, unsigned int bytes, const CBitRange* ranges, unsigned int nRanges, unsigned int count, unsigned int stride, REGENERATE regenerate, OLD_REGENERATE oldRegenerate, BATCH regenerateBatch)
+{
+	start(name);
+
+	for (double ber : BERS) {
+		for (unsigned int n = 0U; n < frames; n++) {
+			unsigned char frame[33U];
+			randomData(frame, bytes);
+
+			// A frame of random bits is damaged beyond repair, so it is used as it is at first
+			if (ber > 0.0) {
+				regenerate(frame);
+				addErrors(frame, ranges, nRanges, ber);
+			}
+
+			unsigned char oldFrame[33U];
+			::memcpy(oldFrame, frame, bytes);
+			unsigned int oldErrors = oldRegenerate(oldFrame);
+
+			unsigned char newFrame[33U];
+			::memcpy(newFrame, frame, bytes);
+			unsigned int errors = regenerate(newFrame);
+
+			check(::memcmp(newFrame, oldFrame, bytes) == 0 && errors == oldErrors, "regenerate of frame %u at ber %g", n, ber);
+		}
+
+		for (unsigned int n = 0U; n < (frames / count); n++) {
+			unsigned char batch[100U];
+			randomData(batch, count * stride);
+
+			for (unsigned int i = 0U; ber > 0.0 && i < count; i++) {
+				regenerate(batch + i * stride);
+				addErrors(batch + i * stride, ranges, nRanges, ber);
+			}
+
+			unsigned char oldBatch[100U];
+			::memcpy(oldBatch, batch, count * stride);
+
+			unsigned int oldErrors[5U];
+			unsigned int oldTotal = 0U;
+			for (unsigned int i = 0U; i < count; i++) {
+				oldErrors[i] = oldRegenerate(oldBatch + i * stride);
+				oldTotal += oldErrors[i];
+			}
+
+			unsigned int errors[5U];
+			unsigned int total = regenerateBatch(batch, count, stride, errors);
+
+			check(::memcmp(batch, oldBatch, count * stride) == 0 && total == oldTotal && ::memcmp(errors, oldErrors, count * sizeof(unsigned int)) == 0,
+			      "batch regenerate of frames %u at ber %g", n, ber);
+		}
+	}
+
+	finish();
+}
+
+#if defined(USE_YSF) || defined(USE_P25)
+// The IMBE interleave, as in the old AMBEFEC.cpp, giving the bit sent for each bit of c0 to c7
+const unsigned int IMBE_INTERLEAVE[] = {
+	0,  7, 12, 19, 24, 31, 36, 43, 48, 55, 60, 67, 72, 79, 84, 91,  96, 103, 108, 115, 120, 127, 132, 139,
+	1,  6, 13, 18, 25, 30, 37, 42, 49, 54, 61, 66, 73, 78, 85, 90,  97, 102, 109, 114, 121, 126, 133, 138,
+	2,  9, 14, 21, 26, 33, 38, 45, 50, 57, 62, 69, 74, 81, 86, 93,  98, 105, 110, 117, 122, 129, 134, 141,
+	3,  8, 15, 20, 27, 32, 39, 44, 51, 56, 63, 68, 75, 80, 87, 92,  99, 104, 111, 116, 123, 128, 135, 140,
+	4, 11, 16, 23, 28, 35, 40, 47, 52, 59, 64, 71, 76, 83, 88, 95, 100, 107, 112, 119, 124, 131, 136, 143,
+	5, 10, 17, 22, 29, 34, 41, 46, 53, 58, 65, 70, 77, 82, 89, 94, 101, 106, 113, 118, 125, 130, 137, 142
+};
+
+static bool readBit(const unsigned char* bytes, unsigned int i)
+{
+	return (bytes[i / 8U] & (0x80U >> (i % 8U))) != 0U;
+}
+
+static void writeBit(unsigned char* bytes, unsigned int i, bool b)
+{
+	if (b)
+		bytes[i / 8U] |= 0x80U >> (i % 8U);
+	else
+		bytes[i / 8U] &= ~(0x80U >> (i % 8U));
+}
+
+/*
+ * The old IMBE code wrote 24 bits back for each Golay word of c0 to c3, so the first bit of
+ * c1, c2, c3 and c4 was overwritten with a zero before it was decoded. For c1 that happened
+ * before the bits were de-whitened, and for the others after it. The old output must be the
+ * new output for the frame with those four bits sent as the old code read them, so that the
+ * two differ only in frames where one of those bits was set otherwise.
+ */
+static void testIMBE()
+{
+	start("ambefec_imbe");
+
+	for (double ber : BERS) {
+		unsigned int touched = 0U, changed = 0U, oldRight = 0U, newRight = 0U;
+
+		for (unsigned int n = 0U; n < frames; n++) {
+			unsigned char sent[18U];
+			randomData(sent, 18U);
+
+			CAMBEFEC fec;
+			if (ber > 0.0)
+				fec.regenerateIMBE(sent);
+
+			unsigned char frame[18U];
+			::memcpy(frame, sent, 18U);
+			addErrors(frame, BITS_144, 1U, ber);
+
+			unsigned char oldFrame[18U];
+			::memcpy(oldFrame, frame, 18U);
+			Baseline::CAMBEFEC oldFec;
+			unsigned int oldErrors = oldFec.regenerateIMBE(oldFrame);
+
+			unsigned char newFrame[18U];
+			::memcpy(newFrame, frame, 18U);
+			unsigned int errors = fec.regenerateIMBE(newFrame);
+
+			// The whitening is seeded from the data of c0, which both decode the same
+			unsigned int c0 = 0U;
+			for (unsigned int i = 0U; i < 23U; i++)
+				c0 = (c0 << 1) | (readBit(frame, IMBE_INTERLEAVE[i]) ? 1U : 0U);
+			unsigned int c0data = CGolay24128::decode23127(c0);
+
+			bool prn[114U];
+			unsigned int p = 16U * c0data;
+			for (unsigned int i = 0U; i < 114U; i++) {
+				p = (173U * p + 13849U) % 65536U;
+				prn[i] = p >= 32768U;
+			}
+
+			unsigned char buggy[18U];
+			::memcpy(buggy, frame, 18U);
+			writeBit(buggy, IMBE_INTERLEAVE[23U], false);
+			writeBit(buggy, IMBE_INTERLEAVE[46U], prn[46U - 23U]);
+			writeBit(buggy, IMBE_INTERLEAVE[69U], prn[69U - 23U]);
+			writeBit(buggy, IMBE_INTERLEAVE[92U], prn[92U - 23U]);
+
+			unsigned char modelFrame[18U];
+			::memcpy(modelFrame, buggy, 18U);
+			fec.regenerateIMBE(modelFrame);
+
+			check(::memcmp(oldFrame, modelFrame, 18U) == 0 && oldErrors == distance(oldFrame, frame, 18U) && errors == distance(newFrame, frame, 18U),
+			      "regenerate of frame %u at ber %g", n, ber);
+
+			bool differ = ::memcmp(oldFrame, newFrame, 18U) != 0 || errors != oldErrors;
+			if (::memcmp(buggy, frame, 18U) == 0)
+				check(!differ, "untouched frame %u at ber %g", n, ber);
+			else
+				touched++;
+
+			if (differ)
+				changed++;
+			if (::memcmp(oldFrame, sent, 18U) == 0)
+				oldRight++;
+			if (::memcmp(newFrame, sent, 18U) == 0)
+				newRight++;
+		}
+
+		::printf("ambefec_imbe: ber %g, %u frames touched by the old bug, %u changed, %u right before and %u after\n", ber, touched, changed, oldRight, newRight);
+	}
+
+	finish();
+}
+#endif
+
+static void testFeatures(bool forceScalar)
+{
+	CCPUFeatures::init(forceScalar);
+#if defined(USE_DMR) || defined(USE_DSTAR) || defined(USE_YSF) || defined(USE_NXDN)
+	CAMBEFEC::init();
+#endif
+#if defined(USE_YSF) || defined(USE_NXDN)
+	CViterbiACS::init();
+#endif
+
+	unsigned int features = forceScalar ? 0U : CCPUFeatures::getDetected();
+	::printf("CPU features: %s\n", CCPUFeatures::toString(features).c_str());
+
+#if defined(USE_YSF)
+	// 176 data bits and four tail bits at rate 1/2
+	testConvolution<CYSFConvolution, Baseline::CYSFConvolution>("ysfconvolution", 176U, 180U, 1U);
+#endif
+
+#if defined(USE_NXDN)
+	// 96 data bits and four tail bits at rate 1/2, with erasures as the punctured bits are sent
+	testConvolution<CNXDNConvolution, Baseline::CNXDNConvolution>("nxdnconvolution", 96U, 100U, 2U);
+#endif
+
+#if defined(USE_DMR) || defined(USE_YSF) || defined(USE_NXDN)
+	// Three AMBE frames in a DMR burst, and up to three bursts together
+	testAMBE("ambefec_dmr", 33U, DMR_AMBE, 2U, 3U, 33U,
+		[](unsigned char* bytes) { CAMBEFEC fec; return fec.regenerateDMR(bytes); },
+		[](unsigned char* bytes) { Baseline::CAMBEFEC fec; return fec.regenerateDMR(bytes); },
+		[](unsigned char* bytes, unsigned int count, unsigned int stride, unsigned int* errors) { CAMBEFEC fec; return fec.regenerateDMR(bytes, count, stride, errors); });
+#endif
+
+#if defined(USE_YSF) || defined(USE_NXDN)
+	// Five frames between the DCH sections of a YSF V/D mode 1 frame
+	testAMBE("ambefec_ysfdn", 9U, BITS_72, 1U, 5U, 18U,
+		[](unsigned char* bytes) { CAMBEFEC fec; return fec.regenerateYSFDN(bytes); },
+		[](unsigned char* bytes) { Baseline::CAMBEFEC fec; return fec.regenerateYSFDN(bytes); },
+		[](unsigned char* bytes, unsigned int count, unsigned int stride, unsigned int* errors) { CAMBEFEC fec; return fec.regenerateYSFDN(bytes, count, stride, errors); });
+#endif
+
+#if defined(USE_DSTAR)
+	// There is no batch call for D-Star, so the batch is the single frame call
+	testAMBE("ambefec_dstar", 9U, BITS_72, 1U, 1U, 9U,
+		[](unsigned char* bytes) { CAMBEFEC fec; return fec.regenerateDStar(bytes); },
+		[](unsigned char* bytes) { Baseline::CAMBEFEC fec; return fec.regenerateDStar(bytes); },
+		[](unsigned char* bytes, unsigned int, unsigned int, unsigned int* errors) { CAMBEFEC fec; return errors[0U] = fec.regenerateDStar(bytes); });
+#endif
+
+#if defined(USE_YSF) || defined(USE_P25)
+	testIMBE();
+#endif
+}
+
+int main(int argc, char** argv)
+{
+	unsigned int seed = DEFAULT_SEED;
+
+	for (int i = 1; i < argc; i++) {
+		if (::strcmp(argv[i], "-f") == 0 && (i + 1) < argc) {
+			frames = (unsigned int)::atoi(argv[++i]);
+		} else if (::strcmp(argv[i], "-s") == 0 && (i + 1) < argc) {
+			seed = (unsigned int)::atoi(argv[++i]);
+		} else {
+			::fprintf(stderr, "Usage: FECTest [-f frames] [-s seed]\n");
+			return 1;
+		}
+	}
+
+	if (frames == 0U)
+		frames = DEFAULT_FRAMES;
+
+	rng.seed(seed);
+
+	// The old decoders log the frames they can't fix
+	LogInitialise(0U, 0U);
+
+	testGolay24128();
+	testGolay23127();
+	testGolay2087();
+	testQR1676();
+	testHamming();
+	testBPTC19696();
+	testTrellis();
+	testRS();
+#if defined(USE_P25)
+	testBCH();
+	testP25NID();
+#endif
+	testCRC();
+
+	testFeatures(false);
+	testFeatures(true);
+
+	if (failures > 0U) {
+		::printf("FAILED with %u differences\n", failures);
+		return 1;
+	}
+
+	::printf("PASSED\n");
+
+	return 0;
+}
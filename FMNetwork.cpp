@@ -32,7 +32,61 @@
 
 const unsigned int BUFFER_LENGTH = 1500U;
 
-CFMNetwork::CFMNetwork(const std::string& callsign, const std::string& localAddress, unsigned short localPort, const std::string& gatewayAddress, unsigned short gatewayPort, bool debug) :
+const unsigned int MAX_SAMPLES = BUFFER_LENGTH;
+
+// The data packet header of "FM" and the encoding tag
+const unsigned int DATA_HEADER_LENGTH = 3U;
+
+// The most samples sent in one packet, bounded by PCM at two bytes a sample
+const unsigned int MAX_TX_SAMPLES = (BUFFER_LENGTH - DATA_HEADER_LENGTH) / 2U;
+
+const int ULAW_BIAS = 0x84;
+const int ULAW_CLIP = 32635;
+
+const int ADPCM_STEP_TABLE[] = {
+	7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+	50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+	253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+	1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+	3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487,
+	12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767};
+
+const int ADPCM_INDEX_TABLE[] = {-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8};
+
+const int ADPCM_MAX_INDEX = 88;
+
+// The ADPCM packet header after the FMA tag, sample count, predictor and step index
+const unsigned int ADPCM_HEADER_LENGTH = 5U;
+
+static_assert(DATA_HEADER_LENGTH + MAX_TX_SAMPLES * 2U <= BUFFER_LENGTH, "PCM packets overflow the buffer");
+static_assert(DATA_HEADER_LENGTH + MAX_TX_SAMPLES <= BUFFER_LENGTH, "u-law packets overflow the buffer");
+static_assert(DATA_HEADER_LENGTH + ADPCM_HEADER_LENGTH + (MAX_TX_SAMPLES + 1U) / 2U <= BUFFER_LENGTH, "ADPCM packets overflow the buffer");
+
+static char encodingTag(FM_ENCODING encoding)
+{
+	switch (encoding) {
+	case FM_ENCODING::ULAW:
+		return 'U';
+	case FM_ENCODING::ADPCM:
+		return 'A';
+	default:
+		return 'D';
+	}
+}
+
+static const char* encodingName(FM_ENCODING encoding)
+{
+	switch (encoding) {
+	case FM_ENCODING::ULAW:
+		return "G.711 u-law";
+	case FM_ENCODING::ADPCM:
+		return "IMA-ADPCM";
+	default:
+		return "PCM";
+	}
+}
+
+CFMNetwork::CFMNetwork(const std::string& callsign, const std::string& localAddress, unsigned short localPort, const std::string& gatewayAddress, unsigned short gatewayPort, FM_ENCODING encoding, bool debug) :
 m_callsign(callsign),
 m_socket(localAddress, localPort),
 m_addr(),
@@ -41,7 +95,12 @@ m_debug(debug),
 m_enabled(false),
 m_buffer(2000U, "FM Network"),
 m_seqNo(0U),
-m_timer(1000U, 5U)
+m_timer(1000U, 5U),
+m_encoding(encoding),
+m_txEncoding(FM_ENCODING::PCM),
+m_txPredictor(0),
+m_txIndex(0U),
+m_ulawTable(nullptr)
 {
 	assert(!callsign.empty());
 	assert(gatewayPort > 0U);
@@ -54,10 +113,24 @@ m_timer(1000U, 5U)
 	size_t pos = callsign.find_first_of(' ');
 	if (pos != std::string::npos)
 		m_callsign = callsign.substr(0U, pos);
+
+	// Decoding u-law is a simple lookup
+	m_ulawTable = new short[256U];
+	for (unsigned int i = 0U; i < 256U; i++) {
+		unsigned int u = ~i & 0xFFU;
+		int t = (((u & 0x0FU) << 3) + ULAW_BIAS) << ((u & 0x70U) >> 4);
+		m_ulawTable[i] = short((u & 0x80U) == 0x80U ? (ULAW_BIAS - t) : (t - ULAW_BIAS));
+	}
 }
 
 CFMNetwork::~CFMNetwork()
 {
+	delete[] m_ulawTable;
+}
+
+void CFMNetwork::setSocketOptions(unsigned int rxBufferSize, unsigned int txBufferSize, int dscp, int keepAliveDSCP, int priority)
+{
+	m_socket.setOptions(rxBufferSize, txBufferSize, dscp, keepAliveDSCP, priority);
 }
 
 bool CFMNetwork::open()
@@ -92,6 +165,14 @@ bool CFMNetwork::writeData(const float* data, unsigned int nSamples)
 	assert(data != nullptr);
 	assert(nSamples > 0U);
 
+	if (nSamples > MAX_TX_SAMPLES)
+		nSamples = MAX_TX_SAMPLES;
+
+	// Kept as a separate pass so that the compiler can vectorise it
+	short samples[MAX_SAMPLES];
+	for (unsigned int i = 0U; i < nSamples; i++)
+		samples[i] = short(data[i] * 32767.0F + 0.5F);
+
 	uint8_t buffer[BUFFER_LENGTH];
 	::memset(buffer, 0x00U, BUFFER_LENGTH);
 
@@ -99,15 +180,26 @@ bool CFMNetwork::writeData(const float* data, unsigned int nSamples)
 
 	buffer[length++] = 'F';
 	buffer[length++] = 'M';
-	buffer[length++] = 'D';
-
-	for (unsigned int i = 0U; i < nSamples; i++) {
-		short val = short(data[i] * 32767.0F + 0.5F);			// Changing audio format from float to S16LE
-
-		buffer[length++] = (val >> 0) & 0xFFU;
-		buffer[length++] = (val >> 8) & 0xFFU;
+	buffer[length++] = encodingTag(m_txEncoding);
+
+	switch (m_txEncoding) {
+	case FM_ENCODING::ULAW:
+		length += encodeULaw(samples, nSamples, buffer + length);
+		break;
+	case FM_ENCODING::ADPCM:
+		length += encodeADPCM(samples, nSamples, buffer + length);
+		break;
+	default:
+		// Changing audio format from float to S16LE
+		for (unsigned int i = 0U; i < nSamples; i++) {
+			buffer[length++] = (samples[i] >> 0) & 0xFFU;
+			buffer[length++] = (samples[i] >> 8) & 0xFFU;
+		}
+		break;
 	}
 
+	assert(length <= BUFFER_LENGTH);
+
 	m_seqNo++;
 
 	if (m_debug)
@@ -147,6 +239,9 @@ bool CFMNetwork::writeEnd()
 
 	m_seqNo = 0U;
 
+	m_txPredictor = 0;
+	m_txIndex     = 0U;
+
 	if (m_debug)
 		CUtils::dump(1U, "FM Network Data Sent", buffer, 3U);
 
@@ -157,14 +252,20 @@ bool CFMNetwork::writePing()
 {
 	uint8_t buffer[5U];
 
-	buffer[0U] = 'F';
-	buffer[1U] = 'M';
-	buffer[2U] = 'P';
+	unsigned int length = 0U;
+
+	buffer[length++] = 'F';
+	buffer[length++] = 'M';
+	buffer[length++] = 'P';
+
+	// Offer the compressed encoding, the gateway echoes it back if it supports it
+	if (m_encoding != FM_ENCODING::PCM)
+		buffer[length++] = encodingTag(m_encoding);
 
 	if (m_debug)
-		CUtils::dump(1U, "FM Network Data Sent", buffer, 3U);
+		CUtils::dump(1U, "FM Network Data Sent", buffer, length);
 
-	return m_socket.write(buffer, 3U, m_addr, m_addrLen);
+	return m_socket.writeKeepAlive(buffer, length, m_addr, m_addrLen);
 }
 
 void CFMNetwork::clock(unsigned int ms)
@@ -196,16 +297,201 @@ void CFMNetwork::clock(unsigned int ms)
 	if (::memcmp(buffer, "FM", 2U) != 0)
 		return;
 
-	if (::memcmp(buffer, "FMP", 3U) == 0)
+	if (::memcmp(buffer, "FMP", 3U) == 0) {
+		FM_ENCODING encoding = FM_ENCODING::PCM;
+		if (length > 3 && m_encoding != FM_ENCODING::PCM && buffer[3U] == encodingTag(m_encoding))
+			encoding = m_encoding;
+
+		if (encoding != m_txEncoding) {
+			LogMessage("FM, using %s audio to the gateway", encodingName(encoding));
+			m_txEncoding = encoding;
+		}
+
 		return;
+	}
 
 	if (m_debug)
 		CUtils::dump(1U, "FM Network Data Received", buffer, length);
 
-	if (::memcmp(buffer, "FMD", 3U) != 0)
+	if (::memcmp(buffer, "FMD", 3U) == 0) {
+		m_buffer.addData(buffer + 3U, length - 3U);
+		return;
+	}
+
+	short samples[MAX_SAMPLES];
+	unsigned int nSamples = 0U;
+
+	if (::memcmp(buffer, "FMU", 3U) == 0)
+		nSamples = decodeULaw(buffer + 3U, length - 3U, samples);
+	else if (::memcmp(buffer, "FMA", 3U) == 0)
+		nSamples = decodeADPCM(buffer + 3U, length - 3U, samples);
+
+	if (nSamples == 0U)
 		return;
 
-	m_buffer.addData(buffer + 3U, length - 3U);
+	// Store as S16LE, as if it had arrived as PCM
+	unsigned char data[MAX_SAMPLES * 2U];
+	for (unsigned int i = 0U; i < nSamples; i++) {
+		data[i * 2U + 0U] = (samples[i] >> 0) & 0xFFU;
+		data[i * 2U + 1U] = (samples[i] >> 8) & 0xFFU;
+	}
+
+	m_buffer.addData(data, nSamples * 2U);
+}
+
+unsigned int CFMNetwork::encodeULaw(const short* in, unsigned int nSamples, unsigned char* out) const
+{
+	assert(in != nullptr);
+	assert(out != nullptr);
+
+	for (unsigned int i = 0U; i < nSamples; i++) {
+		int pcm  = in[i];
+		int sign = (pcm < 0) ? 0x80 : 0x00;
+		int mag  = (pcm < 0) ? -pcm : pcm;
+		if (mag > ULAW_CLIP)
+			mag = ULAW_CLIP;
+		mag += ULAW_BIAS;
+
+		int exponent = 7;
+		for (int mask = 0x4000; (mag & mask) == 0 && exponent > 0; mask >>= 1)
+			exponent--;
+
+		int mantissa = (mag >> (exponent + 3)) & 0x0F;
+
+		out[i] = ~(sign | (exponent << 4) | mantissa);
+	}
+
+	return nSamples;
+}
+
+unsigned int CFMNetwork::decodeULaw(const unsigned char* in, unsigned int length, short* out) const
+{
+	assert(in != nullptr);
+	assert(out != nullptr);
+
+	if (length > MAX_SAMPLES)
+		length = MAX_SAMPLES;
+
+	for (unsigned int i = 0U; i < length; i++)
+		out[i] = m_ulawTable[in[i]];
+
+	return length;
+}
+
+// Each packet carries the encoder state so that a lost packet only affects itself
+unsigned int CFMNetwork::encodeADPCM(const short* in, unsigned int nSamples, unsigned char* out)
+{
+	assert(in != nullptr);
+	assert(out != nullptr);
+
+	out[0U] = (nSamples >> 0) & 0xFFU;
+	out[1U] = (nSamples >> 8) & 0xFFU;
+	out[2U] = (m_txPredictor >> 0) & 0xFFU;
+	out[3U] = (m_txPredictor >> 8) & 0xFFU;
+	out[4U] = m_txIndex;
+
+	int predictor = m_txPredictor;
+	int index     = int(m_txIndex);
+
+	unsigned char* p = out + ADPCM_HEADER_LENGTH;
+	::memset(p, 0x00U, (nSamples + 1U) / 2U);
+
+	for (unsigned int i = 0U; i < nSamples; i++) {
+		int step  = ADPCM_STEP_TABLE[index];
+		int diff  = in[i] - predictor;
+		int delta = step >> 3;
+
+		unsigned char nibble = 0x00U;
+		if (diff < 0) {
+			nibble = 0x08U;
+			diff   = -diff;
+		}
+
+		if (diff >= step) {
+			nibble |= 0x04U;
+			diff   -= step;
+			delta  += step;
+		}
+		step >>= 1;
+
+		if (diff >= step) {
+			nibble |= 0x02U;
+			diff   -= step;
+			delta  += step;
+		}
+		step >>= 1;
+
+		if (diff >= step) {
+			nibble |= 0x01U;
+			delta  += step;
+		}
+
+		predictor += (nibble & 0x08U) == 0x08U ? -delta : delta;
+		if (predictor > 32767)
+			predictor = 32767;
+		else if (predictor < -32768)
+			predictor = -32768;
+
+		index += ADPCM_INDEX_TABLE[nibble];
+		if (index < 0)
+			index = 0;
+		else if (index > ADPCM_MAX_INDEX)
+			index = ADPCM_MAX_INDEX;
+
+		p[i / 2U] |= (i % 2U) == 0U ? nibble : (nibble << 4);
+	}
+
+	m_txPredictor = short(predictor);
+	m_txIndex     = (unsigned int)index;
+
+	return ADPCM_HEADER_LENGTH + (nSamples + 1U) / 2U;
+}
+
+unsigned int CFMNetwork::decodeADPCM(const unsigned char* in, unsigned int length, short* out) const
+{
+	assert(in != nullptr);
+	assert(out != nullptr);
+
+	if (length < ADPCM_HEADER_LENGTH)
+		return 0U;
+
+	unsigned int nSamples = (in[0U] << 0) | (in[1U] << 8);
+	int predictor = short((in[2U] << 0) | (in[3U] << 8));
+	int index     = in[4U];
+
+	if (index > ADPCM_MAX_INDEX || nSamples > MAX_SAMPLES || (nSamples + 1U) / 2U > length - ADPCM_HEADER_LENGTH)
+		return 0U;
+
+	const unsigned char* p = in + ADPCM_HEADER_LENGTH;
+
+	for (unsigned int i = 0U; i < nSamples; i++) {
+		unsigned char nibble = (i % 2U) == 0U ? (p[i / 2U] & 0x0FU) : (p[i / 2U] >> 4);
+
+		int step  = ADPCM_STEP_TABLE[index];
+		int delta = step >> 3;
+		if ((nibble & 0x04U) == 0x04U)
+			delta += step;
+		if ((nibble & 0x02U) == 0x02U)
+			delta += step >> 1;
+		if ((nibble & 0x01U) == 0x01U)
+			delta += step >> 2;
+
+		predictor += (nibble & 0x08U) == 0x08U ? -delta : delta;
+		if (predictor > 32767)
+			predictor = 32767;
+		else if (predictor < -32768)
+			predictor = -32768;
+
+		index += ADPCM_INDEX_TABLE[nibble];
+		if (index < 0)
+			index = 0;
+		else if (index > ADPCM_MAX_INDEX)
+			index = ADPCM_MAX_INDEX;
+
+		out[i] = short(predictor);
+	}
+
+	return nSamples;
 }
 
 unsigned int CFMNetwork::readData(float* out, unsigned int nOut)
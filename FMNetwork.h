@@ -32,9 +32,11 @@
 
 class CFMNetwork {
 public:
-	CFMNetwork(const std::string& callsign, const std::string& localAddress, unsigned short localPort, const std::string& gatewayAddress, unsigned short gatewayPort, bool debug);
+	CFMNetwork(const std::string& callsign, const std::string& localAddress, unsigned short localPort, const std::string& gatewayAddress, unsigned short gatewayPort, FM_ENCODING encoding, bool debug);
 	~CFMNetwork();
 
+	void setSocketOptions(unsigned int rxBufferSize, unsigned int txBufferSize, int dscp, int keepAliveDSCP, int priority);
+
 	bool open();
 
 	void enable(bool enabled);
@@ -61,9 +63,20 @@ private:
 	CRingBuffer<unsigned char> m_buffer;
 	unsigned int        m_seqNo;
 	CTimer              m_timer;
+	FM_ENCODING         m_encoding;
+	FM_ENCODING         m_txEncoding;
+	short               m_txPredictor;
+	unsigned int        m_txIndex;
+	short*              m_ulawTable;
 
 	bool writeStart();
 	bool writePing();
+
+	unsigned int encodeULaw(const short* in, unsigned int nSamples, unsigned char* out) const;
+	unsigned int encodeADPCM(const short* in, unsigned int nSamples, unsigned char* out);
+
+	unsigned int decodeULaw(const unsigned char* in, unsigned int length, short* out) const;
+	unsigned int decodeADPCM(const unsigned char* in, unsigned int length, short* out) const;
 };
 
 #endif
@@ -0,0 +1 @@
+const char *gitversion = "10b8ad88fc4819e9b9894fb95f66d7414a40da5b";
@@ -28,6 +28,11 @@ public:
 
 	static bool decode24128(unsigned int in, unsigned int& out);
 	static bool decode24128(unsigned char* in, unsigned int& out);
+
+	// Decode a number of codewords together, giving the data and the number of bits corrected
+	// in each, the errors and valid arrays may be nullptr when they're not wanted
+	static void decode23127(const unsigned int* in, unsigned int* out, unsigned int* errors, unsigned int count);
+	static void decode24128(const unsigned int* in, unsigned int* out, bool* valid, unsigned int* errors, unsigned int count);
 };
 
 #endif
@@ -17,10 +17,59 @@
  */
 
 #include "Hamming.h"
+#include "FECTables.h"
 
 #include <cstdio>
 #include <cassert>
 
+// The data bits covered by each parity bit, the first data bit is the most significant
+constexpr unsigned int CHECKS_15113_1[] = {0x7F0U, 0x78EU, 0x66DU, 0x55BU};
+constexpr unsigned int CHECKS_15113_2[] = {0x7ACU, 0x3D6U, 0x1EBU, 0x759U};
+constexpr unsigned int CHECKS_1393[]    = {0x1ACU, 0x1D6U, 0x1EBU, 0x159U};
+constexpr unsigned int CHECKS_1063[]    = {0x39U,  0x35U,  0x2EU,  0x1EU};
+constexpr unsigned int CHECKS_16114[]   = {0x7ACU, 0x3D6U, 0x1EBU, 0x759U, 0x537U};
+constexpr unsigned int CHECKS_17123[]   = {0xF34U, 0xF9AU, 0x7CDU, 0xCD2U, 0xE69U};
+
+constexpr CHammingTables<15U, 11U> HAMMING_15113_1(CHECKS_15113_1);
+constexpr CHammingTables<15U, 11U> HAMMING_15113_2(CHECKS_15113_2);
+constexpr CHammingTables<13U, 9U>  HAMMING_1393(CHECKS_1393);
+constexpr CHammingTables<10U, 6U>  HAMMING_1063(CHECKS_1063);
+constexpr CHammingTables<16U, 11U> HAMMING_16114(CHECKS_16114);
+constexpr CHammingTables<17U, 12U> HAMMING_17123(CHECKS_17123);
+
+static_assert(HAMMING_15113_1.verify(), "Hamming (15,11,3) #1 can't correct every single bit error");
+static_assert(HAMMING_15113_2.verify(), "Hamming (15,11,3) #2 can't correct every single bit error");
+static_assert(HAMMING_1393.verify(),    "Hamming (13,9,3) can't correct every single bit error");
+static_assert(HAMMING_1063.verify(),    "Hamming (10,6,3) can't correct every single bit error");
+static_assert(HAMMING_16114.verify(),   "Hamming (16,11,4) can't correct every single bit error");
+static_assert(HAMMING_17123.verify(),   "Hamming (17,12,3) can't correct every single bit error");
+
+// Correct a single bit error, returning true only if a bit was changed
+template <unsigned int N, unsigned int K>
+static bool correct(const CHammingTables<N, K>& tables, unsigned int& code)
+{
+	unsigned int error = tables.error(code);
+	if (error == 0U || error == HAMMING_NO_FIX)
+		return false;
+
+	code ^= error;
+
+	return true;
+}
+
+// Correct a single bit error, returning false only if the errors can't be corrected
+template <unsigned int N, unsigned int K>
+static bool check(const CHammingTables<N, K>& tables, unsigned int& code)
+{
+	unsigned int error = tables.error(code);
+	if (error == HAMMING_NO_FIX)
+		return false;
+
+	code ^= error;
+
+	return true;
+}
+
  // Hamming (15,11,3) check a boolean data array
 bool CHamming::decode15113_1(bool* d)
 {
@@ -347,3 +396,63 @@ void CHamming::encode17123(bool* d)
 	d[15] = d[0] ^ d[1] ^ d[4] ^ d[5] ^ d[7] ^ d[10];
 	d[16] = d[0] ^ d[1] ^ d[2] ^ d[5] ^ d[6] ^ d[8] ^ d[11];
 }
+
+unsigned int CHamming::encode15113_1(unsigned int data)
+{
+	return HAMMING_15113_1.encode(data);
+}
+
+bool CHamming::decode15113_1(unsigned int& code)
+{
+	return correct(HAMMING_15113_1, code);
+}
+
+unsigned int CHamming::encode15113_2(unsigned int data)
+{
+	return HAMMING_15113_2.encode(data);
+}
+
+bool CHamming::decode15113_2(unsigned int& code)
+{
+	return correct(HAMMING_15113_2, code);
+}
+
+unsigned int CHamming::encode1393(unsigned int data)
+{
+	return HAMMING_1393.encode(data);
+}
+
+bool CHamming::decode1393(unsigned int& code)
+{
+	return correct(HAMMING_1393, code);
+}
+
+unsigned int CHamming::encode1063(unsigned int data)
+{
+	return HAMMING_1063.encode(data);
+}
+
+bool CHamming::decode1063(unsigned int& code)
+{
+	return correct(HAMMING_1063, code);
+}
+
+unsigned int CHamming::encode16114(unsigned int data)
+{
+	return HAMMING_16114.encode(data);
+}
+
+bool CHamming::decode16114(unsigned int& code)
+{
+	return check(HAMMING_16114, code);
+}
+
+unsigned int CHamming::encode17123(unsigned int data)
+{
+	return HAMMING_17123.encode(data);
+}
+
+bool CHamming::decode17123(unsigned int& code)
+{
+	return check(HAMMING_17123, code);
+}
@@ -1,5 +1,5 @@
 /*
- *   Copyright (C) 2015,2016 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2015,2016,2025 by Jonathan Naylor G4KLX
  *
  *   This program is free software; you can redistribute it and/or modify
  *   it under the terms of the GNU General Public License as published by
@@ -38,6 +38,26 @@ public:
 
 	static void encode17123(bool* d);
 	static bool decode17123(bool* d);
+
+	// The same codes on packed codewords, the first bit is the most significant and the
+	// parity bits are the least significant. The encoders take just the data bits.
+	static unsigned int encode15113_1(unsigned int data);
+	static bool decode15113_1(unsigned int& code);
+
+	static unsigned int encode15113_2(unsigned int data);
+	static bool decode15113_2(unsigned int& code);
+
+	static unsigned int encode1393(unsigned int data);
+	static bool decode1393(unsigned int& code);
+
+	static unsigned int encode1063(unsigned int data);
+	static bool decode1063(unsigned int& code);
+
+	static unsigned int encode16114(unsigned int data);
+	static bool decode16114(unsigned int& code);
+
+	static unsigned int encode17123(unsigned int data);
+	static bool decode17123(unsigned int& code);
 };
 
 #endif
@@ -28,6 +28,9 @@
 #include "UDPController.h"
 #include "MQTTConnection.h"
 #include "DStarDefines.h"
+#include "CPUFeatures.h"
+#include "ViterbiACS.h"
+#include "AMBEFEC.h"
 #include "Version.h"
 #include "StopWatch.h"
 #include "Thread.h"
@@ -366,6 +369,14 @@ int CMMDVMHost::run()
 	LogInfo("MMDVMHost-%s is starting", VERSION);
 	LogInfo("Built %s %s (GitID #%.7s)", __TIME__, __DATE__, gitversion);
 
+	CCPUFeatures::init(m_conf.getForceScalar());
+#if defined(USE_DMR) || defined(USE_DSTAR) || defined(USE_YSF) || defined(USE_NXDN)
+	CAMBEFEC::init();
+#endif
+#if defined(USE_YSF) || defined(USE_NXDN)
+	CViterbiACS::init();
+#endif
+
 	writeJSONMessage("MMDVMHost is starting");
 
 	readParams();
@@ -730,6 +741,7 @@ int CMMDVMHost::run()
 	if (m_p25Enabled) {
 		unsigned int id     = m_conf.getP25Id();
 		unsigned int nac    = m_conf.getP25NAC();
+		std::vector<unsigned int> rxNACs = m_conf.getP25RXNACs();
 		unsigned int txHang = m_conf.getP25TXHang();
 		bool uidOverride    = m_conf.getP25OverrideUID();
 		bool selfOnly       = m_conf.getP25SelfOnly();
@@ -739,13 +751,22 @@ int CMMDVMHost::run()
 		LogInfo("P25 RF Parameters");
 		LogInfo("    Id: %u", id);
 		LogInfo("    NAC: $%03X", nac);
+		if (rxNACs.size() > 0U) {
+			std::string text;
+			for (const auto& rxNAC : rxNACs) {
+				char buffer[10U];
+				::sprintf(buffer, text.empty() ? "$%03X" : ", $%03X", rxNAC);
+				text += buffer;
+			}
+			LogInfo("    RX NACs: %s", text.c_str());
+		}
 		LogInfo("    UID Override: %s", uidOverride ? "yes" : "no");
 		LogInfo("    Self Only: %s", selfOnly ? "yes" : "no");
 		LogInfo("    Remote Gateway: %s", remoteGateway ? "yes" : "no");
 		LogInfo("    TX Hang: %us", txHang);
 		LogInfo("    Mode Hang: %us", m_p25RFModeHang);
 
-		m_p25 = new CP25Control(nac, id, selfOnly, uidOverride, m_p25Network, m_timeout, m_duplex, m_dmrLookup, remoteGateway, rssi);
+		m_p25 = new CP25Control(nac, rxNACs, id, selfOnly, uidOverride, m_p25Network, m_timeout, m_duplex, m_dmrLookup, remoteGateway, rssi);
 	}
 #endif
 
@@ -1767,6 +1788,11 @@ bool CMMDVMHost::createDStarNetwork()
 	unsigned short localPort   = m_conf.getDStarLocalPort();
 	bool debug                 = m_conf.getDStarNetworkDebug();
 	m_dstarNetModeHang         = m_conf.getDStarNetworkModeHang();
+	unsigned int rxBufferSize = m_conf.getDStarNetworkRXBufferSize();
+	unsigned int txBufferSize = m_conf.getDStarNetworkTXBufferSize();
+	int dscp                  = m_conf.getDStarNetworkDSCP();
+	int keepAliveDSCP         = m_conf.getDStarNetworkKeepAliveDSCP();
+	int priority              = m_conf.getDStarNetworkPriority();
 
 	LogInfo("D-Star Network Parameters");
 	LogInfo("    Gateway Address: %s", gatewayAddress.c_str());
@@ -1774,9 +1800,21 @@ bool CMMDVMHost::createDStarNetwork()
 	LogInfo("    Local Address: %s", localAddress.c_str());
 	LogInfo("    Local Port: %hu", localPort);
 	LogInfo("    Mode Hang: %us", m_dstarNetModeHang);
+	if (rxBufferSize > 0U)
+		LogInfo("    RX Buffer Size: %u", rxBufferSize);
+	if (txBufferSize > 0U)
+		LogInfo("    TX Buffer Size: %u", txBufferSize);
+	if (dscp >= 0)
+		LogInfo("    DSCP: %d", dscp);
+	if (keepAliveDSCP >= 0)
+		LogInfo("    Keep Alive DSCP: %d", keepAliveDSCP);
+	if (priority >= 0)
+		LogInfo("    Priority: %d", priority);
 
 	m_dstarNetwork = new CDStarNetwork(gatewayAddress, gatewayPort, localAddress, localPort, m_duplex, VERSION, debug);
 
+	m_dstarNetwork->setSocketOptions(rxBufferSize, txBufferSize, dscp, keepAliveDSCP, priority);
+
 	bool ret = m_dstarNetwork->open();
 	if (!ret) {
 		delete m_dstarNetwork;
@@ -1804,6 +1842,14 @@ bool CMMDVMHost::createDMRNetwork()
 	bool slot2           = m_conf.getDMRNetworkSlot2();
 	HW_TYPE hwType       = m_modem->getHWType();
 	m_dmrNetModeHang     = m_conf.getDMRNetworkModeHang();
+	std::vector<std::pair<std::string, unsigned short>> standbys = m_conf.getDMRNetworkStandbyGateways();
+	unsigned int pingInterval = m_conf.getDMRNetworkPingInterval();
+	unsigned int missedPings  = m_conf.getDMRNetworkMissedPings();
+	unsigned int rxBufferSize = m_conf.getDMRNetworkRXBufferSize();
+	unsigned int txBufferSize = m_conf.getDMRNetworkTXBufferSize();
+	int dscp                  = m_conf.getDMRNetworkDSCP();
+	int keepAliveDSCP         = m_conf.getDMRNetworkKeepAliveDSCP();
+	int priority              = m_conf.getDMRNetworkPriority();
 
 	LogInfo("DMR Network Parameters");
 	LogInfo("    Gateway Address: %s", gatewayAddress.c_str());
@@ -1814,9 +1860,31 @@ bool CMMDVMHost::createDMRNetwork()
 	LogInfo("    Slot 1: %s", slot1 ? "enabled" : "disabled");
 	LogInfo("    Slot 2: %s", slot2 ? "enabled" : "disabled");
 	LogInfo("    Mode Hang: %us", m_dmrNetModeHang);
+	for (std::vector<std::pair<std::string, unsigned short>>::const_iterator it = standbys.cbegin(); it != standbys.cend(); ++it)
+		LogInfo("    Standby Gateway: %s:%hu", (*it).first.c_str(), (*it).second);
+	if (!standbys.empty()) {
+		LogInfo("    Ping Interval: %ums", pingInterval);
+		LogInfo("    Missed Pings: %u", missedPings);
+	}
+	if (rxBufferSize > 0U)
+		LogInfo("    RX Buffer Size: %u", rxBufferSize);
+	if (txBufferSize > 0U)
+		LogInfo("    TX Buffer Size: %u", txBufferSize);
+	if (dscp >= 0)
+		LogInfo("    DSCP: %d", dscp);
+	if (keepAliveDSCP >= 0)
+		LogInfo("    Keep Alive DSCP: %d", keepAliveDSCP);
+	if (priority >= 0)
+		LogInfo("    Priority: %d", priority);
 
 	m_dmrNetwork = new CDMRNetwork(gatewayAddress, gatewayPort, localAddress, localPort, id, m_duplex, VERSION, slot1, slot2, hwType, debug);
 
+	m_dmrNetwork->setSocketOptions(rxBufferSize, txBufferSize, dscp, keepAliveDSCP, priority);
+
+	for (std::vector<std::pair<std::string, unsigned short>>::const_iterator it = standbys.cbegin(); it != standbys.cend(); ++it)
+		m_dmrNetwork->addStandby((*it).first, (*it).second);
+	m_dmrNetwork->setFailover(pingInterval, missedPings);
+
 	unsigned int rxFrequency = m_conf.getRXFrequency();
 	unsigned int txFrequency = m_conf.getTXFrequency();
 	unsigned int power       = m_conf.getPower();
@@ -1852,6 +1920,11 @@ bool CMMDVMHost::createYSFNetwork()
 	unsigned short gatewayPort = m_conf.getFusionNetworkGatewayPort();
 	m_ysfNetModeHang           = m_conf.getFusionNetworkModeHang();
 	bool debug                 = m_conf.getFusionNetworkDebug();
+	unsigned int rxBufferSize = m_conf.getFusionNetworkRXBufferSize();
+	unsigned int txBufferSize = m_conf.getFusionNetworkTXBufferSize();
+	int dscp                  = m_conf.getFusionNetworkDSCP();
+	int keepAliveDSCP         = m_conf.getFusionNetworkKeepAliveDSCP();
+	int priority              = m_conf.getFusionNetworkPriority();
 
 	LogInfo("System Fusion Network Parameters");
 	LogInfo("    Local Address: %s", localAddress.c_str());
@@ -1859,9 +1932,21 @@ bool CMMDVMHost::createYSFNetwork()
 	LogInfo("    Gateway Address: %s", gatewayAddress.c_str());
 	LogInfo("    Gateway Port: %hu", gatewayPort);
 	LogInfo("    Mode Hang: %us", m_ysfNetModeHang);
+	if (rxBufferSize > 0U)
+		LogInfo("    RX Buffer Size: %u", rxBufferSize);
+	if (txBufferSize > 0U)
+		LogInfo("    TX Buffer Size: %u", txBufferSize);
+	if (dscp >= 0)
+		LogInfo("    DSCP: %d", dscp);
+	if (keepAliveDSCP >= 0)
+		LogInfo("    Keep Alive DSCP: %d", keepAliveDSCP);
+	if (priority >= 0)
+		LogInfo("    Priority: %d", priority);
 
 	m_ysfNetwork = new CYSFNetwork(localAddress, localPort, gatewayAddress, gatewayPort, m_callsign, debug);
 
+	m_ysfNetwork->setSocketOptions(rxBufferSize, txBufferSize, dscp, keepAliveDSCP, priority);
+
 	bool ret = m_ysfNetwork->open();
 	if (!ret) {
 		delete m_ysfNetwork;
@@ -1884,6 +1969,11 @@ bool CMMDVMHost::createP25Network()
 	unsigned short localPort   = m_conf.getP25LocalPort();
 	m_p25NetModeHang           = m_conf.getP25NetworkModeHang();
 	bool debug                 = m_conf.getP25NetworkDebug();
+	unsigned int rxBufferSize = m_conf.getP25NetworkRXBufferSize();
+	unsigned int txBufferSize = m_conf.getP25NetworkTXBufferSize();
+	int dscp                  = m_conf.getP25NetworkDSCP();
+	int keepAliveDSCP         = m_conf.getP25NetworkKeepAliveDSCP();
+	int priority              = m_conf.getP25NetworkPriority();
 
 	LogInfo("P25 Network Parameters");
 	LogInfo("    Gateway Address: %s", gatewayAddress.c_str());
@@ -1891,9 +1981,21 @@ bool CMMDVMHost::createP25Network()
 	LogInfo("    Local Address: %s", localAddress.c_str());
 	LogInfo("    Local Port: %hu", localPort);
 	LogInfo("    Mode Hang: %us", m_p25NetModeHang);
+	if (rxBufferSize > 0U)
+		LogInfo("    RX Buffer Size: %u", rxBufferSize);
+	if (txBufferSize > 0U)
+		LogInfo("    TX Buffer Size: %u", txBufferSize);
+	if (dscp >= 0)
+		LogInfo("    DSCP: %d", dscp);
+	if (keepAliveDSCP >= 0)
+		LogInfo("    Keep Alive DSCP: %d", keepAliveDSCP);
+	if (priority >= 0)
+		LogInfo("    Priority: %d", priority);
 
 	m_p25Network = new CP25Network(gatewayAddress, gatewayPort, localAddress, localPort, debug);
 
+	m_p25Network->setSocketOptions(rxBufferSize, txBufferSize, dscp, keepAliveDSCP, priority);
+
 	bool ret = m_p25Network->open();
 	if (!ret) {
 		delete m_p25Network;
@@ -1917,6 +2019,12 @@ bool CMMDVMHost::createNXDNNetwork()
 	unsigned short localPort   = m_conf.getNXDNLocalPort();
 	m_nxdnNetModeHang          = m_conf.getNXDNNetworkModeHang();
 	bool debug                 = m_conf.getNXDNNetworkDebug();
+	unsigned int rxBufferSize = m_conf.getNXDNNetworkRXBufferSize();
+	unsigned int txBufferSize = m_conf.getNXDNNetworkTXBufferSize();
+	int dscp                  = m_conf.getNXDNNetworkDSCP();
+	int keepAliveDSCP         = m_conf.getNXDNNetworkKeepAliveDSCP();
+	int priority              = m_conf.getNXDNNetworkPriority();
+	bool receiverReports      = m_conf.getNXDNNetworkReceiverReports();
 
 	LogInfo("NXDN Network Parameters");
 	LogInfo("    Protocol: %s", protocol.c_str());
@@ -1925,12 +2033,26 @@ bool CMMDVMHost::createNXDNNetwork()
 	LogInfo("    Local Address: %s", localAddress.c_str());
 	LogInfo("    Local Port: %hu", localPort);
 	LogInfo("    Mode Hang: %us", m_nxdnNetModeHang);
+	if (rxBufferSize > 0U)
+		LogInfo("    RX Buffer Size: %u", rxBufferSize);
+	if (txBufferSize > 0U)
+		LogInfo("    TX Buffer Size: %u", txBufferSize);
+	if (dscp >= 0)
+		LogInfo("    DSCP: %d", dscp);
+	if (keepAliveDSCP >= 0)
+		LogInfo("    Keep Alive DSCP: %d", keepAliveDSCP);
+	if (priority >= 0)
+		LogInfo("    Priority: %d", priority);
+	if (protocol == "Kenwood")
+		LogInfo("    RTCP Receiver Reports: %s", receiverReports ? "enabled" : "disabled");
 
 	if (protocol == "Kenwood")
-		m_nxdnNetwork = new CNXDNKenwoodNetwork(localAddress, localPort, gatewayAddress, gatewayPort, debug);
+		m_nxdnNetwork = new CNXDNKenwoodNetwork(localAddress, localPort, gatewayAddress, gatewayPort, receiverReports, debug);
 	else
 		m_nxdnNetwork = new CNXDNIcomNetwork(localAddress, localPort, gatewayAddress, gatewayPort, debug);
 
+	m_nxdnNetwork->setSocketOptions(rxBufferSize, txBufferSize, dscp, keepAliveDSCP, priority);
+
 	bool ret = m_nxdnNetwork->open();
 	if (!ret) {
 		delete m_nxdnNetwork;
@@ -1988,8 +2110,14 @@ bool CMMDVMHost::createFMNetwork()
 	bool deEmphasis            = m_conf.getFMDeEmphasis();
 	float txAudioGain          = m_conf.getFMTXAudioGain();
 	float rxAudioGain          = m_conf.getFMRXAudioGain();
+	std::string encodingStr    = m_conf.getFMNetworkEncoding();
 	m_fmNetModeHang            = m_conf.getFMNetworkModeHang();
 	bool debug                 = m_conf.getFMNetworkDebug();
+	unsigned int rxBufferSize = m_conf.getFMNetworkRXBufferSize();
+	unsigned int txBufferSize = m_conf.getFMNetworkTXBufferSize();
+	int dscp                  = m_conf.getFMNetworkDSCP();
+	int keepAliveDSCP         = m_conf.getFMNetworkKeepAliveDSCP();
+	int priority              = m_conf.getFMNetworkPriority();
 
 	LogInfo("FM Network Parameters");
 	LogInfo("    Gateway Address: %s", gatewayAddress.c_str());
@@ -2000,9 +2128,28 @@ bool CMMDVMHost::createFMNetwork()
 	LogInfo("    De-Emphasis: %s", deEmphasis ? "yes" : "no");
 	LogInfo("    TX Audio Gain: %.2f", txAudioGain);
 	LogInfo("    RX Audio Gain: %.2f", rxAudioGain);
+	LogInfo("    Encoding: %s", encodingStr.c_str());
 	LogInfo("    Mode Hang: %us", m_fmNetModeHang);
-
-	m_fmNetwork = new CFMNetwork(callsign, localAddress, localPort, gatewayAddress, gatewayPort, debug);
+	if (rxBufferSize > 0U)
+		LogInfo("    RX Buffer Size: %u", rxBufferSize);
+	if (txBufferSize > 0U)
+		LogInfo("    TX Buffer Size: %u", txBufferSize);
+	if (dscp >= 0)
+		LogInfo("    DSCP: %d", dscp);
+	if (keepAliveDSCP >= 0)
+		LogInfo("    Keep Alive DSCP: %d", keepAliveDSCP);
+	if (priority >= 0)
+		LogInfo("    Priority: %d", priority);
+
+	FM_ENCODING encoding = FM_ENCODING::PCM;
+	if (encodingStr == "uLaw")
+		encoding = FM_ENCODING::ULAW;
+	else if (encodingStr == "ADPCM")
+		encoding = FM_ENCODING::ADPCM;
+
+	m_fmNetwork = new CFMNetwork(callsign, localAddress, localPort, gatewayAddress, gatewayPort, encoding, debug);
+
+	m_fmNetwork->setSocketOptions(rxBufferSize, txBufferSize, dscp, keepAliveDSCP, priority);
 
 	bool ret = m_fmNetwork->open();
 	if (!ret) {
@@ -2548,6 +2548,24 @@ RESP_TYPE_MMDVM CModem::getResponse()
 {
 	assert(m_port != nullptr);
 
+	// Ports that keep the frame boundaries hand over the whole frame at once
+	if (m_port->isFramed()) {
+		int ret = m_port->read(m_buffer, BUFFER_LENGTH);
+		if (ret < 0) {
+			LogError("Error when reading from the modem");
+			return RESP_TYPE_MMDVM::ERR;
+		}
+
+		if (ret < 3)
+			return RESP_TYPE_MMDVM::TIMEOUT;
+
+		m_length = ret;
+		m_offset = m_length > 255U ? 4U : 3U;
+		m_type   = m_buffer[m_offset - 1U];
+
+		return RESP_TYPE_MMDVM::OK;
+	}
+
 	if (m_state == SERIAL_STATE::START) {
 		// Get the start of the frame or nothing at all
 		int ret = m_port->read(m_buffer + 0U, 1U);
@@ -21,3 +21,8 @@
 IModemPort::~IModemPort()
 {
 }
+
+bool IModemPort::isFramed() const
+{
+	return false;
+}
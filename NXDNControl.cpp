@@ -100,13 +100,13 @@ bool CNXDNControl::writeModem(unsigned char *data, unsigned int len)
 		unsigned short dstId = m_rfLayer3.getDestinationGroupId();
 		bool grp             = m_rfLayer3.getIsGroup();
 		unsigned short srcId = m_rfLayer3.getSourceUnitId();
-		std::string source = m_lookup->find(srcId);
+		CUserDBView source = m_lookup->find(srcId);
 
 		if (m_rssi != 0) {
-			LogMessage("NXDN, transmission lost from %s to %s%u, %.1f seconds, BER: %.1f%%, RSSI: %d/%d/%ddBm", source.c_str(), grp ? "TG " : "", dstId, float(m_rfFrames) / 12.5F, float(m_rfErrs * 100U) / float(m_rfBits), m_minRSSI, m_maxRSSI, m_aveRSSI / int(m_rssiCountTotal));
+			LogMessage("NXDN, transmission lost from %s to %s%u, %.1f seconds, BER: %.1f%%, RSSI: %d/%d/%ddBm", source.getCallsign().data(), grp ? "TG " : "", dstId, float(m_rfFrames) / 12.5F, float(m_rfErrs * 100U) / float(m_rfBits), m_minRSSI, m_maxRSSI, m_aveRSSI / int(m_rssiCountTotal));
 			writeJSONRF("lost", float(m_rfFrames) / 12.5F, float(m_rfErrs * 100U) / float(m_rfBits), m_minRSSI, m_maxRSSI, m_aveRSSI / int(m_rssiCountTotal));
 		} else {
-			LogMessage("NXDN, transmission lost from %s to %s%u, %.1f seconds, BER: %.1f%%", source.c_str(), grp ? "TG " : "", dstId, float(m_rfFrames) / 12.5F, float(m_rfErrs * 100U) / float(m_rfBits));
+			LogMessage("NXDN, transmission lost from %s to %s%u, %.1f seconds, BER: %.1f%%", source.getCallsign().data(), grp ? "TG " : "", dstId, float(m_rfFrames) / 12.5F, float(m_rfErrs * 100U) / float(m_rfBits));
 			writeJSONRF("lost", float(m_rfFrames) / 12.5F, float(m_rfErrs * 100U) / float(m_rfBits));
 		}
 		writeEndRF();
@@ -271,14 +271,14 @@ bool CNXDNControl::processVoice(unsigned char usc, unsigned char option, unsigne
 			unsigned short dstId = m_rfLayer3.getDestinationGroupId();
 			bool grp             = m_rfLayer3.getIsGroup();
 			unsigned short srcId = m_rfLayer3.getSourceUnitId();
-			std::string source   = m_lookup->find(srcId);
+			CUserDBView source   = m_lookup->find(srcId);
 
 			m_rfFrames++;
 			if (m_rssi != 0) {
-				LogMessage("NXDN, received RF end of transmission from %s to %s%u, %.1f seconds, BER: %.1f%%, RSSI: %d/%d/%d dBm", source.c_str(), grp ? "TG " : "", dstId, float(m_rfFrames) / 12.5F, float(m_rfErrs * 100U) / float(m_rfBits), m_minRSSI, m_maxRSSI, m_aveRSSI / int(m_rssiCountTotal));
+				LogMessage("NXDN, received RF end of transmission from %s to %s%u, %.1f seconds, BER: %.1f%%, RSSI: %d/%d/%d dBm", source.getCallsign().data(), grp ? "TG " : "", dstId, float(m_rfFrames) / 12.5F, float(m_rfErrs * 100U) / float(m_rfBits), m_minRSSI, m_maxRSSI, m_aveRSSI / int(m_rssiCountTotal));
 				writeJSONRF("end", float(m_rfFrames) / 12.5F, float(m_rfErrs * 100U) / float(m_rfBits), m_minRSSI, m_maxRSSI, m_aveRSSI / int(m_rssiCountTotal));
 			} else {
-				LogMessage("NXDN, received RF end of transmission from %s to %s%u, %.1f seconds, BER: %.1f%%", source.c_str(), grp ? "TG " : "", dstId, float(m_rfFrames) / 12.5F, float(m_rfErrs * 100U) / float(m_rfBits));
+				LogMessage("NXDN, received RF end of transmission from %s to %s%u, %.1f seconds, BER: %.1f%%", source.getCallsign().data(), grp ? "TG " : "", dstId, float(m_rfFrames) / 12.5F, float(m_rfErrs * 100U) / float(m_rfBits));
 				writeJSONRF("end", float(m_rfFrames) / 12.5F, float(m_rfErrs * 100U) / float(m_rfBits));
 			}
 			writeEndRF();
@@ -305,10 +305,10 @@ bool CNXDNControl::processVoice(unsigned char usc, unsigned char option, unsigne
 			unsigned short dstId = m_rfLayer3.getDestinationGroupId();
 			bool grp             = m_rfLayer3.getIsGroup();
 			unsigned short srcId = m_rfLayer3.getSourceUnitId();
-			std::string source   = m_lookup->find(srcId);
+			CUserDBView source   = m_lookup->find(srcId);
 
-			LogMessage("NXDN, received RF header from %s to %s%u", source.c_str(), grp ? "TG " : "", dstId);
-			writeJSONRF("start", srcId, source, grp, dstId);
+			LogMessage("NXDN, received RF header from %s to %s%u", source.getCallsign().data(), grp ? "TG " : "", dstId);
+			writeJSONRF("start", srcId, source.getCallsign(), grp, dstId);
 		}
 
 		return true;
@@ -414,9 +414,9 @@ bool CNXDNControl::processVoice(unsigned char usc, unsigned char option, unsigne
 			m_bitErrsAccum = 0U;
 			m_bitsCount    = 0U;
 
-			std::string source = m_lookup->find(srcId);
-			LogMessage("NXDN, received RF late entry from %s to %s%u", source.c_str(), grp ? "TG " : "", dstId);
-			writeJSONRF("late_entry", srcId, source, grp, dstId);
+			CUserDBView source = m_lookup->find(srcId);
+			LogMessage("NXDN, received RF late entry from %s to %s%u", source.getCallsign().data(), grp ? "TG " : "", dstId);
+			writeJSONRF("late_entry", srcId, source.getCallsign(), grp, dstId);
 
 			m_rfState = RPT_RF_STATE::AUDIO;
 
@@ -495,11 +495,7 @@ bool CNXDNControl::processVoice(unsigned char usc, unsigned char option, unsigne
 		// Regenerate the audio and interpret the FACCH1 data
 		if (option == NXDN_LICH_STEAL_NONE) {
 			CAMBEFEC ambe;
-			unsigned int errors = 0U;
-			errors += ambe.regenerateYSFDN(data + 2U + NXDN_FSW_LICH_SACCH_LENGTH_BYTES + 0U);
-			errors += ambe.regenerateYSFDN(data + 2U + NXDN_FSW_LICH_SACCH_LENGTH_BYTES + 9U);
-			errors += ambe.regenerateYSFDN(data + 2U + NXDN_FSW_LICH_SACCH_LENGTH_BYTES + 18U);
-			errors += ambe.regenerateYSFDN(data + 2U + NXDN_FSW_LICH_SACCH_LENGTH_BYTES + 27U);
+			unsigned int errors = ambe.regenerateYSFDN(data + 2U + NXDN_FSW_LICH_SACCH_LENGTH_BYTES + 0U, 4U, 9U);
 			m_rfErrs += errors;
 			m_rfBits += 188U;
 			writeJSONBER(188U, errors);
@@ -516,9 +512,7 @@ bool CNXDNControl::processVoice(unsigned char usc, unsigned char option, unsigne
 			facch1.getRaw(netData + 5U + 0U);
 
 			CAMBEFEC ambe;
-			unsigned int errors = 0U;
-			errors += ambe.regenerateYSFDN(data + 2U + NXDN_FSW_LICH_SACCH_LENGTH_BYTES + 18U);
-			errors += ambe.regenerateYSFDN(data + 2U + NXDN_FSW_LICH_SACCH_LENGTH_BYTES + 27U);
+			unsigned int errors = ambe.regenerateYSFDN(data + 2U + NXDN_FSW_LICH_SACCH_LENGTH_BYTES + 18U, 2U, 9U);
 			m_rfErrs += errors;
 			m_rfBits += 94U;
 			writeJSONBER(94U, errors);
@@ -528,9 +522,7 @@ bool CNXDNControl::processVoice(unsigned char usc, unsigned char option, unsigne
 			audio.decode(data + 2U + NXDN_FSW_LICH_SACCH_LENGTH_BYTES + 18U, netData + 5U + 14U);
 		} else if (option == NXDN_LICH_STEAL_FACCH1_2) {
 			CAMBEFEC ambe;
-			unsigned int errors = 0U;
-			errors += ambe.regenerateYSFDN(data + 2U + NXDN_FSW_LICH_SACCH_LENGTH_BYTES);
-			errors += ambe.regenerateYSFDN(data + 2U + NXDN_FSW_LICH_SACCH_LENGTH_BYTES + 9U);
+			unsigned int errors = ambe.regenerateYSFDN(data + 2U + NXDN_FSW_LICH_SACCH_LENGTH_BYTES + 0U, 2U, 9U);
 			m_rfErrs += errors;
 			m_rfBits += 94U;
 			writeJSONBER(94U, errors);
@@ -615,12 +607,12 @@ bool CNXDNControl::processData(unsigned char option, unsigned char *data)
 
 		unsigned char frames = layer3.getDataBlocks();
 
-		std::string source = m_lookup->find(srcId);
+		CUserDBView source = m_lookup->find(srcId);
 
 		writeJSONRSSI();
 
-		LogMessage("NXDN, received RF data header from %s to %s%u, %u blocks", source.c_str(), grp ? "TG " : "", dstId, frames);
-		writeJSONNet("start", srcId, source, grp, dstId, frames);
+		LogMessage("NXDN, received RF data header from %s to %s%u, %u blocks", source.getCallsign().data(), grp ? "TG " : "", dstId, frames);
+		writeJSONNet("start", srcId, source.getCallsign(), grp, dstId, frames);
 
 		m_rfLayer3 = layer3;
 		m_rfFrames = 0U;
@@ -681,9 +673,9 @@ bool CNXDNControl::processData(unsigned char option, unsigned char *data)
 		unsigned short dstId = m_rfLayer3.getDestinationGroupId();
 		bool grp             = m_rfLayer3.getIsGroup();
 		unsigned short srcId = m_rfLayer3.getSourceUnitId();
-		std::string source   = m_lookup->find(srcId);
+		CUserDBView source   = m_lookup->find(srcId);
 
-		LogMessage("NXDN, ended RF data transmission from %s to %s%u", source.c_str(), grp ? "TG " : "", dstId);
+		LogMessage("NXDN, ended RF data transmission from %s to %s%u", source.getCallsign().data(), grp ? "TG " : "", dstId);
 		writeJSONNet("end");
 		writeEndRF();
 	}
@@ -776,9 +768,9 @@ void CNXDNControl::writeNetwork()
 
 				unsigned char frames = layer3.getDataBlocks();
 
-				std::string source = m_lookup->find(srcId);
-				LogMessage("NXDN, received network data header from %s to %s%u, %u blocks", source.c_str(), grp ? "TG " : "", dstId, frames);
-				writeJSONNet("start", srcId, source, grp, dstId, frames);
+				CUserDBView source = m_lookup->find(srcId);
+				LogMessage("NXDN, received network data header from %s to %s%u, %u blocks", source.getCallsign().data(), grp ? "TG " : "", dstId, frames);
+				writeJSONNet("start", srcId, source.getCallsign(), grp, dstId, frames);
 
 				m_netState = RPT_NET_STATE::DATA;
 			} else {
@@ -803,10 +795,10 @@ void CNXDNControl::writeNetwork()
 				unsigned short dstId = m_netLayer3.getDestinationGroupId();
 				bool grp             = m_netLayer3.getIsGroup();
 				unsigned short srcId = m_netLayer3.getSourceUnitId();
-				std::string source   = m_lookup->find(srcId);
+				CUserDBView source   = m_lookup->find(srcId);
 
-				LogMessage("NXDN, ended network data transmission from %s to %s%u", source.c_str(), grp ? "TG " : "", dstId);
-				writeJSONNet("start", srcId, source, grp, dstId);
+				LogMessage("NXDN, ended network data transmission from %s to %s%u", source.getCallsign().data(), grp ? "TG " : "", dstId);
+				writeJSONNet("start", srcId, source.getCallsign(), grp, dstId);
 				writeEndNet();
 			}
 		}
@@ -840,17 +832,16 @@ void CNXDNControl::writeNetwork()
 		unsigned short dstId = m_netLayer3.getDestinationGroupId();
 		bool grp             = m_netLayer3.getIsGroup();
 		unsigned short srcId = m_netLayer3.getSourceUnitId();
-		class CUserDBentry source;
-		m_lookup->findWithName(srcId, &source);
+		CUserDBView source = m_lookup->find(srcId);
 
 		if (type == NXDN_MESSAGE_TYPE_TX_REL) {
 			m_netFrames++;
-			LogMessage("NXDN, received network end of transmission from %s to %s%u, %.1f seconds", source.get(keyCALLSIGN).c_str(), grp ? "TG " : "", dstId, float(m_netFrames) / 12.5F);
+			LogMessage("NXDN, received network end of transmission from %s to %s%u, %.1f seconds", source.getCallsign().data(), grp ? "TG " : "", dstId, float(m_netFrames) / 12.5F);
 			writeJSONNet("end", float(m_netFrames) / 12.5F);
 			writeEndNet();
 		} else if (type == NXDN_MESSAGE_TYPE_VCALL) {
-			LogMessage("NXDN, received network transmission from %s to %s%u", source.get(keyCALLSIGN).c_str(), grp ? "TG " : "", dstId);
-			writeJSONNet("start", srcId, source.get(keyCALLSIGN), grp, dstId);
+			LogMessage("NXDN, received network transmission from %s to %s%u", source.getCallsign().data(), grp ? "TG " : "", dstId);
+			writeJSONNet("start", srcId, source.getCallsign(), grp, dstId);
 
 			m_netTimeoutTimer.start();
 			m_packetTimer.start();
@@ -899,10 +890,9 @@ void CNXDNControl::writeNetwork()
 			unsigned short dstId = m_netLayer3.getDestinationGroupId();
 			bool grp             = m_netLayer3.getIsGroup();
 
-			class CUserDBentry source;
-			m_lookup->findWithName(srcId, &source);
-			LogMessage("NXDN, received network transmission from %s to %s%u", source.get(keyCALLSIGN).c_str(), grp ? "TG " : "", dstId);
-			writeJSONNet("start", srcId, source.get(keyCALLSIGN), grp, dstId);
+			CUserDBView source = m_lookup->find(srcId);
+			LogMessage("NXDN, received network transmission from %s to %s%u", source.getCallsign().data(), grp ? "TG " : "", dstId);
+			writeJSONNet("start", srcId, source.getCallsign(), grp, dstId);
 
 			m_netTimeoutTimer.start();
 			m_packetTimer.start();
@@ -1170,7 +1160,7 @@ void CNXDNControl::writeJSONBER(unsigned int bits, unsigned int errs)
 	}
 }
 
-void CNXDNControl::writeJSONRF(const char* action, unsigned short srcId, const std::string& srcInfo, bool grp, unsigned short dstId)
+void CNXDNControl::writeJSONRF(const char* action, unsigned short srcId, std::string_view srcInfo, bool grp, unsigned short dstId)
 {
 	assert(action != nullptr);
 
@@ -1227,7 +1217,7 @@ void CNXDNControl::writeJSONNet(const char* action)
 	WriteJSON("NXDN", json);
 }
 
-void CNXDNControl::writeJSONNet(const char* action, unsigned short srcId, const std::string& srcInfo, bool grp, unsigned short dstId)
+void CNXDNControl::writeJSONNet(const char* action, unsigned short srcId, std::string_view srcInfo, bool grp, unsigned short dstId)
 {
 	assert(action != nullptr);
 
@@ -1238,7 +1228,7 @@ void CNXDNControl::writeJSONNet(const char* action, unsigned short srcId, const
 	WriteJSON("NXDN", json);
 }
 
-void CNXDNControl::writeJSONNet(const char* action, unsigned short srcId, const std::string& srcInfo, bool grp, unsigned short dstId, unsigned char frames)
+void CNXDNControl::writeJSONNet(const char* action, unsigned short srcId, std::string_view srcInfo, bool grp, unsigned short dstId, unsigned char frames)
 {
 	assert(action != nullptr);
 
@@ -1272,7 +1262,7 @@ void CNXDNControl::writeJSON(nlohmann::json& json, const char* action)
 	json["action"]    = action;
 }
 
-void CNXDNControl::writeJSON(nlohmann::json& json, const char* source, const char* action, unsigned short srcId, const std::string& srcInfo, bool grp, unsigned short dstId)
+void CNXDNControl::writeJSON(nlohmann::json& json, const char* source, const char* action, unsigned short srcId, std::string_view srcInfo, bool grp, unsigned short dstId)
 {
 	assert(source != nullptr);
 	assert(action != nullptr);
@@ -34,6 +34,7 @@
 #if defined(USE_NXDN)
 
 #include <string>
+#include <string_view>
 
 #include <nlohmann/json.hpp>
 
@@ -105,17 +106,17 @@ private:
 	void writeJSONRSSI();
 	void writeJSONBER(unsigned int bits, unsigned int errs);
 
-	void writeJSONRF(const char* action, unsigned short srcId, const std::string& srcInfo, bool grp, unsigned short dstId);
+	void writeJSONRF(const char* action, unsigned short srcId, std::string_view srcInfo, bool grp, unsigned short dstId);
 	void writeJSONRF(const char* action, float duration, float ber);
 	void writeJSONRF(const char* action, float duration, float ber, int minRSSI, int maxRSSI, int aveRSSI);
 
-	void writeJSONNet(const char* action, unsigned short srcId, const std::string& srcInfo, bool grp, unsigned short dstId);
-	void writeJSONNet(const char* action, unsigned short srcId, const std::string& srcInfo, bool grp, unsigned short dstId, unsigned char frames);
+	void writeJSONNet(const char* action, unsigned short srcId, std::string_view srcInfo, bool grp, unsigned short dstId);
+	void writeJSONNet(const char* action, unsigned short srcId, std::string_view srcInfo, bool grp, unsigned short dstId, unsigned char frames);
 	void writeJSONNet(const char* action);
 	void writeJSONNet(const char* action, float duration);
 
 	void writeJSON(nlohmann::json& json, const char* action);
-	void writeJSON(nlohmann::json& json, const char* source, const char* action, unsigned short srcId, const std::string& srcInfo, bool grp, unsigned short dstId);
+	void writeJSON(nlohmann::json& json, const char* source, const char* action, unsigned short srcId, std::string_view srcInfo, bool grp, unsigned short dstId);
 };
 
 #endif
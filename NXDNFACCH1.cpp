@@ -100,13 +100,7 @@ bool CNXDNFACCH1::decode(const unsigned char* data, unsigned int offset)
 	CNXDNConvolution conv;
 	conv.start();
 
-	n = 0U;
-	for (unsigned int i = 0U; i < 100U; i++) {
-		uint8_t s0 = temp2[n++];
-		uint8_t s1 = temp2[n++];
-
-		conv.decode(s0, s1);
-	}
+	conv.decode(temp2, 100U);
 
 	conv.chainback(m_data, 96U);
 
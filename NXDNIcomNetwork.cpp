@@ -48,6 +48,11 @@ CNXDNIcomNetwork::~CNXDNIcomNetwork()
 {
 }
 
+void CNXDNIcomNetwork::setSocketOptions(unsigned int rxBufferSize, unsigned int txBufferSize, int dscp, int keepAliveDSCP, int priority)
+{
+	m_socket.setOptions(rxBufferSize, txBufferSize, dscp, keepAliveDSCP, priority);
+}
+
 bool CNXDNIcomNetwork::open()
 {
 	if (m_addrLen == 0U) {
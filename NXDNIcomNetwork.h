@@ -36,6 +36,8 @@ public:
 	CNXDNIcomNetwork(const std::string& localAddress, unsigned short localPort, const std::string& gatewayAddress, unsigned short gatewayPort, bool debug);
 	virtual ~CNXDNIcomNetwork();
 
+	virtual void setSocketOptions(unsigned int rxBufferSize, unsigned int txBufferSize, int dscp, int keepAliveDSCP, int priority);
+
 	virtual bool open();
 
 	virtual void enable(bool enabled);
@@ -35,7 +35,17 @@ const unsigned char BIT_MASK_TABLE[] = { 0x80U, 0x40U, 0x20U, 0x10U, 0x08U, 0x04
 
 const unsigned int BUFFER_LENGTH = 200U;
 
-CNXDNKenwoodNetwork::CNXDNKenwoodNetwork(const std::string& localAddress, unsigned short localPort, const std::string& gwyAddress, unsigned short gwyPort, bool debug) :
+// RFC 3550 Appendix A.1 sequence number validation limits
+const uint32_t RTP_SEQ_MOD  = 1U << 16;
+const uint16_t MAX_DROPOUT  = 3000U;
+const uint16_t MAX_MISORDER = 100U;
+
+// The playout buffer holds this many packets, and waits between these limits, in RTP units of 1/80 ms, for a missing one
+const unsigned int PLAYOUT_SLOTS     = 16U;
+const uint32_t     PLAYOUT_MIN_DELAY = 20U * 80U;
+const uint32_t     PLAYOUT_MAX_DELAY = 160U * 80U;
+
+CNXDNKenwoodNetwork::CNXDNKenwoodNetwork(const std::string& localAddress, unsigned short localPort, const std::string& gwyAddress, unsigned short gwyPort, bool receiverReports, bool debug) :
 m_rtpSocket(localAddress, localPort + 0U),
 m_rtcpSocket(localAddress, localPort + 1U),
 m_rtcpAddr(),
@@ -60,7 +70,29 @@ m_hangTimer(1000U, 5U),
 m_hangType(0U),
 m_hangSrc(0U),
 m_hangDst(0U),
-m_random()
+m_random(),
+m_receiverReports(receiverReports),
+m_rxSeen(false),
+m_rxSSRC(0U),
+m_maxSeq(0U),
+m_cycles(0U),
+m_baseSeq(0U),
+m_badSeq(0U),
+m_received(0U),
+m_expectedPrior(0U),
+m_receivedPrior(0U),
+m_transit(0U),
+m_minTransit(0U),
+m_jitter(0U),
+m_reordered(0U),
+m_late(0U),
+m_rrTimer(1000U, 5U),
+m_playout(nullptr),
+m_playoutLen(nullptr),
+m_playoutSeq(nullptr),
+m_playoutTS(nullptr),
+m_playoutRunning(false),
+m_playoutNext(0U)
 {
 	assert(localPort > 0U);
 	assert(!gwyAddress.empty());
@@ -68,6 +100,13 @@ m_random()
 
 	m_sacch = new unsigned char[10U];
 
+	m_playout    = new unsigned char[PLAYOUT_SLOTS * BUFFER_LENGTH];
+	m_playoutLen = new unsigned int[PLAYOUT_SLOTS];
+	m_playoutSeq = new uint32_t[PLAYOUT_SLOTS];
+	m_playoutTS  = new uint32_t[PLAYOUT_SLOTS];
+
+	clearPlayout();
+
 	if (CUDPSocket::lookup(gwyAddress, gwyPort + 1U, m_rtcpAddr, m_rtcpAddrLen) != 0)
 		m_rtcpAddrLen = 0U;
 		
@@ -82,6 +121,16 @@ m_random()
 CNXDNKenwoodNetwork::~CNXDNKenwoodNetwork()
 {
 	delete[] m_sacch;
+	delete[] m_playout;
+	delete[] m_playoutLen;
+	delete[] m_playoutSeq;
+	delete[] m_playoutTS;
+}
+
+void CNXDNKenwoodNetwork::setSocketOptions(unsigned int rxBufferSize, unsigned int txBufferSize, int dscp, int keepAliveDSCP, int priority)
+{
+	m_rtpSocket.setOptions(rxBufferSize, txBufferSize, dscp, keepAliveDSCP, priority);
+	m_rtcpSocket.setOptions(rxBufferSize, txBufferSize, keepAliveDSCP >= 0 ? keepAliveDSCP : dscp, keepAliveDSCP, priority);
 }
 
 bool CNXDNKenwoodNetwork::open()
@@ -738,6 +787,70 @@ bool CNXDNKenwoodNetwork::writeRTCPHang()
 	return m_rtcpSocket.write(buffer, 20U, m_rtcpAddr, m_rtcpAddrLen);
 }
 
+bool CNXDNKenwoodNetwork::writeRTCPReceiverReport()
+{
+	// Cumulative and interval loss as per RFC 3550 Appendix A.3
+	uint32_t extendedMax = m_cycles + m_maxSeq;
+	uint32_t expected    = extendedMax - m_baseSeq + 1U;
+	int32_t lost         = int32_t(expected - m_received);
+	if (lost > 0x7FFFFF)
+		lost = 0x7FFFFF;
+	else if (lost < -0x800000)
+		lost = -0x800000;
+
+	uint32_t expectedInterval = expected - m_expectedPrior;
+	uint32_t receivedInterval = m_received - m_receivedPrior;
+	int32_t lostInterval      = int32_t(expectedInterval - receivedInterval);
+	m_expectedPrior = expected;
+	m_receivedPrior = m_received;
+
+	uint8_t fraction = 0U;
+	if (expectedInterval != 0U && lostInterval > 0)
+		fraction = uint8_t((uint32_t(lostInterval) << 8) / expectedInterval);
+
+	uint32_t jitter = m_jitter >> 4;
+
+	unsigned char buffer[35U];
+	::memset(buffer, 0x00U, 35U);
+
+	buffer[0U] = 0x81U;
+	buffer[1U] = 0xC9U;
+	buffer[2U] = 0x00U;
+	buffer[3U] = 0x07U;
+
+	buffer[4U] = (m_ssrc >> 24) & 0xFFU;
+	buffer[5U] = (m_ssrc >> 16) & 0xFFU;
+	buffer[6U] = (m_ssrc >> 8)  & 0xFFU;
+	buffer[7U] = (m_ssrc >> 0)  & 0xFFU;
+
+	buffer[8U]  = (m_rxSSRC >> 24) & 0xFFU;
+	buffer[9U]  = (m_rxSSRC >> 16) & 0xFFU;
+	buffer[10U] = (m_rxSSRC >> 8)  & 0xFFU;
+	buffer[11U] = (m_rxSSRC >> 0)  & 0xFFU;
+
+	buffer[12U] = fraction;
+	buffer[13U] = (uint32_t(lost) >> 16) & 0xFFU;
+	buffer[14U] = (uint32_t(lost) >> 8)  & 0xFFU;
+	buffer[15U] = (uint32_t(lost) >> 0)  & 0xFFU;
+
+	buffer[16U] = (extendedMax >> 24) & 0xFFU;
+	buffer[17U] = (extendedMax >> 16) & 0xFFU;
+	buffer[18U] = (extendedMax >> 8)  & 0xFFU;
+	buffer[19U] = (extendedMax >> 0)  & 0xFFU;
+
+	buffer[20U] = (jitter >> 24) & 0xFFU;
+	buffer[21U] = (jitter >> 16) & 0xFFU;
+	buffer[22U] = (jitter >> 8)  & 0xFFU;
+	buffer[23U] = (jitter >> 0)  & 0xFFU;
+
+	// The gateway sends no sender reports, so LSR and DLSR stay at zero
+
+	if (m_debug)
+		CUtils::dump(1U, "Kenwood Network RTCP Data Sent", buffer, 32U);
+
+	return m_rtcpSocket.writeKeepAlive(buffer, 32U, m_rtcpAddr, m_rtcpAddrLen);
+}
+
 bool CNXDNKenwoodNetwork::read(unsigned char* data)
 {
 	assert(data != nullptr);
@@ -745,7 +858,11 @@ bool CNXDNKenwoodNetwork::read(unsigned char* data)
 	unsigned char dummy[BUFFER_LENGTH];
 	readRTCP(dummy);
 
-	unsigned int len = readRTP(data);
+	// Drain the socket into the playout buffer before choosing the next frame
+	while (readRTP())
+		;
+
+	unsigned int len = readPlayout(data);
 	switch (len) {
 	case 0U:	// Nothing received
 		return false;
@@ -764,32 +881,242 @@ bool CNXDNKenwoodNetwork::read(unsigned char* data)
 	}
 }
 
-unsigned int CNXDNKenwoodNetwork::readRTP(unsigned char* data)
+bool CNXDNKenwoodNetwork::readRTP()
 {
-	assert(data != nullptr);
-
 	unsigned char buffer[BUFFER_LENGTH];
 
 	sockaddr_storage address;
 	unsigned int addrLen;
 	int length = m_rtpSocket.read(buffer, BUFFER_LENGTH, address, addrLen);
 	if (length <= 0)
-		return 0U;
+		return false;
 
 	if (!CUDPSocket::match(m_rtpAddr, address, IPMATCHTYPE::ADDRESS_ONLY)) {
 		LogMessage("NXDN, RTP packet received from an invalid source");
-		return 0U;
+		return true;
 	}
 
 	if (!m_enabled)
-		return 0U;
+		return true;
 
 	if (m_debug)
 		CUtils::dump(1U, "Kenwood Network RTP Data Received", buffer, length);
 
-	::memcpy(data, buffer + 12U, length - 12U);
+	if (length <= 12)
+		return true;
 
-	return length - 12U;
+	uint16_t seq       = (buffer[2U] << 8) | (buffer[3U] << 0);
+	uint32_t timeStamp = (buffer[4U] << 24) | (buffer[5U] << 16) | (buffer[6U] << 8) | (buffer[7U] << 0);
+	uint32_t ssrc      = (buffer[8U] << 24) | (buffer[9U] << 16) | (buffer[10U] << 8) | (buffer[11U] << 0);
+
+	// A new source restarts the statistics and the playout sequence. The
+	// source address has already been checked, so the RFC 3550 probation
+	// period is not used, it would only discard the voice header.
+	if (!m_rxSeen || ssrc != m_rxSSRC) {
+		if (m_rxSeen)
+			writeStatistics(true);
+
+		m_rxSeen = true;
+		m_rxSSRC = ssrc;
+		initSequence(seq);
+		clearPlayout();
+
+		m_received  = 1U;
+		m_transit   = uint32_t(getTimeStamp()) - timeStamp;
+		m_minTransit = m_transit;
+		m_jitter    = 0U;
+		m_reordered = 0U;
+		m_late      = 0U;
+
+		m_rrTimer.start();
+	} else {
+		if (!updateSequence(seq))
+			return true;
+
+		updateJitter(timeStamp);
+	}
+
+	if (!m_rrTimer.isRunning())
+		m_rrTimer.start();
+
+	// Map the 16-bit sequence number onto the extended sequence space
+	uint32_t extSeq = m_cycles + m_maxSeq + int16_t(seq - m_maxSeq);
+
+	if (!m_playoutRunning) {
+		m_playoutRunning = true;
+		m_playoutNext    = extSeq;
+	}
+
+	if (int32_t(extSeq - m_playoutNext) < 0) {
+		// Already played out, or skipped as lost
+		m_late++;
+		return true;
+	}
+
+	if ((extSeq - m_playoutNext) >= PLAYOUT_SLOTS) {
+		// Too far ahead to hold, restart the playout from here
+		clearPlayout();
+		m_playoutRunning = true;
+		m_playoutNext    = extSeq;
+	}
+
+	unsigned int slot = extSeq % PLAYOUT_SLOTS;
+	::memcpy(m_playout + slot * BUFFER_LENGTH, buffer + 12U, length - 12U);
+	m_playoutLen[slot] = length - 12U;
+	m_playoutSeq[slot] = extSeq;
+	m_playoutTS[slot]  = timeStamp;
+
+	return true;
+}
+
+unsigned int CNXDNKenwoodNetwork::readPlayout(unsigned char* data)
+{
+	assert(data != nullptr);
+
+	if (!m_playoutRunning)
+		return 0U;
+
+	for (;;) {
+		unsigned int slot = m_playoutNext % PLAYOUT_SLOTS;
+		if (m_playoutLen[slot] > 0U && m_playoutSeq[slot] == m_playoutNext) {
+			unsigned int length = m_playoutLen[slot];
+			::memcpy(data, m_playout + slot * BUFFER_LENGTH, length);
+			m_playoutLen[slot] = 0U;
+			m_playoutNext++;
+			return length;
+		}
+
+		// Find the earliest packet held after the gap
+		bool found = false;
+		uint32_t seq = 0U;
+		uint32_t timeStamp = 0U;
+		for (unsigned int i = 0U; i < PLAYOUT_SLOTS; i++) {
+			if (m_playoutLen[i] == 0U)
+				continue;
+
+			if (!found || int32_t(m_playoutSeq[i] - seq) < 0) {
+				seq       = m_playoutSeq[i];
+				timeStamp = m_playoutTS[i];
+				found     = true;
+			}
+		}
+
+		if (!found)
+			return 0U;
+
+		// Wait for the missing packet until the held one is due to be played
+		uint32_t delay = 3U * (m_jitter >> 4);
+		if (delay < PLAYOUT_MIN_DELAY)
+			delay = PLAYOUT_MIN_DELAY;
+		else if (delay > PLAYOUT_MAX_DELAY)
+			delay = PLAYOUT_MAX_DELAY;
+
+		uint32_t now = uint32_t(getTimeStamp());
+		if (int32_t(now - (timeStamp + m_minTransit + delay)) < 0)
+			return 0U;
+
+		m_playoutNext = seq;
+	}
+}
+
+void CNXDNKenwoodNetwork::initSequence(uint16_t seq)
+{
+	m_baseSeq       = seq;
+	m_maxSeq        = seq;
+	m_badSeq        = RTP_SEQ_MOD + 1U;
+	m_cycles        = 0U;
+	m_received      = 0U;
+	m_receivedPrior = 0U;
+	m_expectedPrior = 0U;
+}
+
+bool CNXDNKenwoodNetwork::updateSequence(uint16_t seq)
+{
+	// RFC 3550 Appendix A.1, without the probation period
+	uint16_t delta = seq - m_maxSeq;
+
+	if (delta == 0U) {
+		// Duplicate
+		return false;
+	} else if (delta < MAX_DROPOUT) {
+		// In order, with a permissible gap
+		if (seq < m_maxSeq)
+			m_cycles += RTP_SEQ_MOD;
+		m_maxSeq = seq;
+	} else if (delta <= RTP_SEQ_MOD - MAX_MISORDER) {
+		// A very large jump, believe it if the next packet follows on from it
+		if (seq == m_badSeq) {
+			LogMessage("NXDN, RTP sequence restarted at %u", seq);
+			initSequence(seq);
+			clearPlayout();
+		} else {
+			m_badSeq = (seq + 1U) & (RTP_SEQ_MOD - 1U);
+			return false;
+		}
+	} else {
+		// Reordered
+		m_reordered++;
+	}
+
+	m_received++;
+
+	return true;
+}
+
+void CNXDNKenwoodNetwork::updateJitter(uint32_t timeStamp)
+{
+	// RFC 3550 Appendix A.8, with the jitter held scaled by 16
+	uint32_t transit = uint32_t(getTimeStamp()) - timeStamp;
+
+	int32_t d = int32_t(transit - m_transit);
+	m_transit = transit;
+	if (d < 0)
+		d = -d;
+
+	m_jitter += uint32_t(d) - ((m_jitter + 8U) >> 4);
+
+	if (int32_t(transit - m_minTransit) < 0)
+		m_minTransit = transit;
+}
+
+void CNXDNKenwoodNetwork::clearPlayout()
+{
+	for (unsigned int i = 0U; i < PLAYOUT_SLOTS; i++)
+		m_playoutLen[i] = 0U;
+
+	m_playoutRunning = false;
+	m_playoutNext    = 0U;
+}
+
+void CNXDNKenwoodNetwork::writeStatistics(bool final)
+{
+	if (m_received == 0U)
+		return;
+
+	uint32_t extendedMax = m_cycles + m_maxSeq;
+	uint32_t expected    = extendedMax - m_baseSeq + 1U;
+	int32_t lost         = int32_t(expected - m_received);
+
+	// 80 RTP timestamp units per millisecond
+	float jitter = float(m_jitter >> 4) / 80.0F;
+
+	if (final)
+		LogMessage("NXDN, RTP statistics, received: %u, lost: %d, reordered: %u, late: %u, jitter: %.1fms", m_received, lost, m_reordered, m_late, jitter);
+
+	nlohmann::json json;
+
+	json["timestamp"]    = CUtils::createTimestamp();
+	json["mode"]         = "NXDN";
+	json["ssrc"]         = m_rxSSRC;
+	json["received"]     = m_received;
+	json["lost"]         = lost;
+	json["highest_seq"]  = extendedMax;
+	json["reordered"]    = m_reordered;
+	json["late"]         = m_late;
+	json["jitter"]       = jitter;
+	json["final"]        = final;
+
+	WriteJSON("RTP", json);
 }
 
 unsigned int CNXDNKenwoodNetwork::readRTCP(unsigned char* data)
@@ -815,6 +1142,10 @@ unsigned int CNXDNKenwoodNetwork::readRTCP(unsigned char* data)
 	if (m_debug)
 		CUtils::dump(1U, "Kenwood Network RTCP Data Received", buffer, length);
 
+	// Sender and receiver reports carry nothing for us
+	if (buffer[1U] == 0xC8U || buffer[1U] == 0xC9U)
+		return 0U;
+
 	if (::memcmp(buffer + 8U, "KWNE", 4U) != 0) {
 		LogError("Missing RTCP KWNE signature");
 		return 0U;
@@ -830,6 +1161,17 @@ void CNXDNKenwoodNetwork::reset()
 	m_rtcpTimer.stop();
 	m_hangTimer.stop();
 
+	if (m_rrTimer.isRunning()) {
+		if (m_receiverReports)
+			writeRTCPReceiverReport();
+		writeStatistics(true);
+		m_rrTimer.stop();
+	}
+
+	// The next transmission starts a fresh set of statistics
+	m_rxSeen = false;
+	clearPlayout();
+
 	m_headerSeen = false;
 	m_seen1 = false;
 	m_seen2 = false;
@@ -866,6 +1208,14 @@ void CNXDNKenwoodNetwork::clock(unsigned int ms)
 		m_rtcpTimer.stop();
 		m_hangTimer.stop();
 	}
+
+	m_rrTimer.clock(ms);
+	if (m_rrTimer.isRunning() && m_rrTimer.hasExpired()) {
+		if (m_receiverReports)
+			writeRTCPReceiverReport();
+		writeStatistics(false);
+		m_rrTimer.start();
+	}
 }
 
 bool CNXDNKenwoodNetwork::processKenwoodVoiceHeader(unsigned char* inData)
@@ -32,9 +32,11 @@
 
 class CNXDNKenwoodNetwork : public INXDNNetwork {
 public:
-	CNXDNKenwoodNetwork(const std::string& localAddress, unsigned short localPort, const std::string& gwyAddress, unsigned short gwyPort, bool debug);
+	CNXDNKenwoodNetwork(const std::string& localAddress, unsigned short localPort, const std::string& gwyAddress, unsigned short gwyPort, bool receiverReports, bool debug);
 	virtual ~CNXDNKenwoodNetwork();
 
+	virtual void setSocketOptions(unsigned int rxBufferSize, unsigned int txBufferSize, int dscp, int keepAliveDSCP, int priority);
+
 	virtual bool open();
 
 	virtual void enable(bool enabled);
@@ -77,6 +79,28 @@ private:
 	unsigned short   m_hangSrc;
 	unsigned short   m_hangDst;
 	std::mt19937     m_random;
+	bool             m_receiverReports;
+	bool             m_rxSeen;
+	uint32_t         m_rxSSRC;
+	uint16_t         m_maxSeq;
+	uint32_t         m_cycles;
+	uint32_t         m_baseSeq;
+	uint32_t         m_badSeq;
+	uint32_t         m_received;
+	uint32_t         m_expectedPrior;
+	uint32_t         m_receivedPrior;
+	uint32_t         m_transit;
+	uint32_t         m_minTransit;
+	uint32_t         m_jitter;
+	unsigned int     m_reordered;
+	unsigned int     m_late;
+	CTimer           m_rrTimer;
+	unsigned char*   m_playout;
+	unsigned int*    m_playoutLen;
+	uint32_t*        m_playoutSeq;
+	uint32_t*        m_playoutTS;
+	bool             m_playoutRunning;
+	uint32_t         m_playoutNext;
 
 	bool processIcomVoiceHeader(const unsigned char* data);
 	bool processIcomVoiceData(const unsigned char* data);
@@ -97,7 +121,14 @@ private:
 	bool writeRTCPPing();
 	bool writeRTCPHang(unsigned char type, unsigned short src, unsigned short dst);
 	bool writeRTCPHang();
-	unsigned int readRTP(unsigned char* data);
+	bool writeRTCPReceiverReport();
+	bool readRTP();
+	unsigned int readPlayout(unsigned char* data);
+	void initSequence(uint16_t seq);
+	bool updateSequence(uint16_t seq);
+	void updateJitter(uint32_t timeStamp);
+	void clearPlayout();
+	void writeStatistics(bool final);
 	unsigned int readRTCP(unsigned char* data);
 	unsigned long getTimeStamp() const;
 };
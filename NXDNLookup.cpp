@@ -54,7 +54,7 @@ bool CNXDNLookup::read()
 void CNXDNLookup::reload()
 {
 	if (m_reloadTime == 0U)
-		m_table.load(m_filename);
+		m_table.reload(m_filename);
 	else
 		m_reload = true;	
 }
@@ -71,7 +71,7 @@ void CNXDNLookup::entry()
 
 		timer.clock();
 		if (timer.hasExpired() || m_reload) {
-			m_table.load(m_filename);
+			m_table.reload(m_filename);
 			timer.start();
 			m_reload = false;
 		}
@@ -92,44 +92,13 @@ void CNXDNLookup::stop()
 	wait();
 }
 
-void CNXDNLookup::findWithName(unsigned int id, class CUserDBentry *entry)
+// The callsign refers to the lookup table rather than being copied from it
+CUserDBView CNXDNLookup::find(unsigned int id)
 {
-	if (id == 0xFFFFU) {
-		entry->clear();
-		entry->set(keyCALLSIGN, "ALL");
-		return;
-	}
-
-	if (m_table.lookup(id, entry)) {
-		LogDebug("FindWithName =%s %s", entry->get(keyCALLSIGN).c_str(), entry->get(keyFIRST_NAME).c_str());
-	} else {
-		entry->clear();
-
-		char text[10U];
-		::snprintf(text, sizeof(text), "%u", id);
-		entry->set(keyCALLSIGN, text);
-	}
-
-	return;
-}
-
-std::string CNXDNLookup::find(unsigned int id)
-{
-	std::string callsign;
-
 	if (id == 0xFFFFU)
-		return std::string("ALL");
-
-	class CUserDBentry entry;
-	if (m_table.lookup(id, &entry)) {
-		callsign = entry.get(keyCALLSIGN);
-	} else {
-		char text[10U];
-		::snprintf(text, sizeof(text), "%u", id);
-		callsign = std::string(text);
-	}
+		return CUserDBView("ALL");
 
-	return callsign;
+	return m_table.find(id);
 }
 
 bool CNXDNLookup::exists(unsigned int id)
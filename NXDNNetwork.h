@@ -39,6 +39,8 @@ class INXDNNetwork {
 public:
 	virtual ~INXDNNetwork() = 0;
 
+	virtual void setSocketOptions(unsigned int rxBufferSize, unsigned int txBufferSize, int dscp, int keepAliveDSCP, int priority) = 0;
+
 	virtual bool open() = 0;
 
 	virtual void enable(bool enabled) = 0;
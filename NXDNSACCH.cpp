@@ -93,13 +93,7 @@ bool CNXDNSACCH::decode(const unsigned char* data)
 	CNXDNConvolution conv;
 	conv.start();
 
-	n = 0U;
-	for (unsigned int i = 0U; i < 40U; i++) {
-		uint8_t s0 = temp2[n++];
-		uint8_t s1 = temp2[n++];
-
-		conv.decode(s0, s1);
-	}
+	conv.decode(temp2, 40U);
 
 	conv.chainback(m_data, 36U);
 
@@ -121,13 +121,7 @@ bool CNXDNUDCH::decode(const unsigned char* data)
 	CNXDNConvolution conv;
 	conv.start();
 
-	n = 0U;
-	for (unsigned int i = 0U; i < 207U; i++) {
-		uint8_t s0 = temp2[n++];
-		uint8_t s1 = temp2[n++];
-
-		conv.decode(s0, s1);
-	}
+	conv.decode(temp2, 207U);
 
 	conv.chainback(m_data, 203U);
 
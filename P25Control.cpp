@@ -41,7 +41,7 @@ const unsigned char BIT_MASK_TABLE[] = {0x80U, 0x40U, 0x20U, 0x10U, 0x08U, 0x04U
 #define WRITE_BIT(p,i,b) p[(i)>>3] = (b) ? (p[(i)>>3] | BIT_MASK_TABLE[(i)&7]) : (p[(i)>>3] & ~BIT_MASK_TABLE[(i)&7])
 #define READ_BIT(p,i)    (p[(i)>>3] & BIT_MASK_TABLE[(i)&7])
 
-CP25Control::CP25Control(unsigned int nac, unsigned int id, bool selfOnly, bool uidOverride, CP25Network* network, unsigned int timeout, bool duplex, CDMRLookup* lookup, bool remoteGateway, CRSSIInterpolator* rssiMapper) :
+CP25Control::CP25Control(unsigned int nac, const std::vector<unsigned int>& rxNACs, unsigned int id, bool selfOnly, bool uidOverride, CP25Network* network, unsigned int timeout, bool duplex, CDMRLookup* lookup, bool remoteGateway, CRSSIInterpolator* rssiMapper) :
 m_nac(nac),
 m_id(id),
 m_selfOnly(selfOnly),
@@ -63,7 +63,7 @@ m_rfErrs(0U),
 m_netFrames(0U),
 m_netLost(0U),
 m_rfDataFrames(0U),
-m_nid(nac),
+m_nid(nac, rxNACs),
 m_lastDUID(P25_DUID_TERM),
 m_audio(),
 m_rfData(),
@@ -132,13 +132,13 @@ bool CP25Control::writeModem(unsigned char* data, unsigned int len)
 		bool           grp = m_rfData.getLCF() == P25_LCF_GROUP;
 		unsigned int dstId = m_rfData.getDstId();
 		unsigned int srcId = m_rfData.getSrcId();
-		std::string source = m_lookup->find(srcId);
+		CUserDBView source = m_lookup->find(srcId);
 
 		if (m_rssi != 0) {
-			LogMessage("P25, transmission lost from %s to %s%u, %.1f seconds, BER: %.1f%%, RSSI: %d/%d/%d dBm", source.c_str(), grp ? "TG " : "", dstId, float(m_rfFrames) / 5.56F, float(m_rfErrs * 100U) / float(m_rfBits), m_minRSSI, m_maxRSSI, m_aveRSSI / int(m_rssiCountTotal));
+			LogMessage("P25, transmission lost from %s to %s%u, %.1f seconds, BER: %.1f%%, RSSI: %d/%d/%d dBm", source.getCallsign().data(), grp ? "TG " : "", dstId, float(m_rfFrames) / 5.56F, float(m_rfErrs * 100U) / float(m_rfBits), m_minRSSI, m_maxRSSI, m_aveRSSI / int(m_rssiCountTotal));
 			writeJSONRF("lost", float(m_rfFrames) / 5.56F, float(m_rfErrs * 100U) / float(m_rfBits), m_minRSSI, m_maxRSSI, m_aveRSSI / int(m_rssiCountTotal));
 		} else {
-			LogMessage("P25, transmission lost from %s to %s%u, %.1f seconds, BER: %.1f%%", source.c_str(), grp ? "TG " : "", dstId, float(m_rfFrames) / 5.56F, float(m_rfErrs * 100U) / float(m_rfBits));
+			LogMessage("P25, transmission lost from %s to %s%u, %.1f seconds, BER: %.1f%%", source.getCallsign().data(), grp ? "TG " : "", dstId, float(m_rfFrames) / 5.56F, float(m_rfErrs * 100U) / float(m_rfBits));
 			writeJSONRF("lost", float(m_rfFrames) / 5.56F, float(m_rfErrs * 100U) / float(m_rfBits));
 		}
 
@@ -268,10 +268,14 @@ bool CP25Control::writeModem(unsigned char* data, unsigned int len)
 
 			bool           grp = m_rfData.getLCF() == P25_LCF_GROUP;
 			unsigned int dstId = m_rfData.getDstId();
-			std::string source = m_lookup->find(srcId);
+			CUserDBView source = m_lookup->find(srcId);
 
-			LogMessage("P25, received RF voice transmission from %s to %s%u", source.c_str(), grp ? "TG " : "", dstId);
-			writeJSONRF("start", srcId, source, grp, dstId);
+			unsigned int nac = m_nid.getNAC();
+			if (nac != m_nac)
+				LogMessage("P25, received RF voice transmission from %s to %s%u on NAC $%03X", source.getCallsign().data(), grp ? "TG " : "", dstId, nac);
+			else
+				LogMessage("P25, received RF voice transmission from %s to %s%u", source.getCallsign().data(), grp ? "TG " : "", dstId);
+			writeJSONRF("start", srcId, source.getCallsign(), grp, dstId);
 
 			m_rfState = RPT_RF_STATE::AUDIO;
 
@@ -413,14 +417,14 @@ bool CP25Control::writeModem(unsigned char* data, unsigned int len)
 	
 		bool           grp = m_rfData.getLCF() == P25_LCF_GROUP;
 		unsigned int dstId = m_rfData.getDstId();
-		std::string source = m_lookup->find(m_rfData.getSrcId());
+		CUserDBView source = m_lookup->find(m_rfData.getSrcId());
 
 		unsigned char data[P25_TSDU_FRAME_LENGTH_BYTES + 2U];
 	
 		switch (m_rfData.getLCF()) {
 		case P25_LCF_GROUP: {
 				// Handle Group Voice Channel User - respond with Group Voice Channel Grant for talk permit
-				LogMessage("P25, received RF TSDU transmission, GROUP VOICE CH USER from %s to TG %u", source.c_str(), dstId);
+				LogMessage("P25, received RF TSDU transmission, GROUP VOICE CH USER from %s to TG %u", source.getCallsign().data(), dstId);
 				::memset(data + 2U, 0x00U, P25_TSDU_FRAME_LENGTH_BYTES);
 
 				// Regenerate Sync
@@ -456,7 +460,7 @@ bool CP25Control::writeModem(unsigned char* data, unsigned int len)
 			}
 			break;
 		case P25_LCF_TSBK_CALL_ALERT:
-			LogMessage("P25, received RF TSDU transmission, CALL ALERT from %s to %s%u", source.c_str(), grp ? "TG " : "", dstId);
+			LogMessage("P25, received RF TSDU transmission, CALL ALERT from %s to %s%u", source.getCallsign().data(), grp ? "TG " : "", dstId);
 			::memset(data + 2U, 0x00U, P25_TSDU_FRAME_LENGTH_BYTES);
 	
 			// Regenerate Sync
@@ -482,7 +486,7 @@ bool CP25Control::writeModem(unsigned char* data, unsigned int len)
 			}
 			break;
 		case P25_LCF_TSBK_ACK_RSP_FNE:
-			LogMessage("P25, received RF TSDU transmission, ACK RESPONSE FNE from %s to %s%u", source.c_str(), grp ? "TG " : "", dstId);
+			LogMessage("P25, received RF TSDU transmission, ACK RESPONSE FNE from %s to %s%u", source.getCallsign().data(), grp ? "TG " : "", dstId);
 			::memset(data + 2U, 0x00U, P25_TSDU_FRAME_LENGTH_BYTES);
 
 			// Regenerate Sync
@@ -532,7 +536,7 @@ bool CP25Control::writeModem(unsigned char* data, unsigned int len)
 			bool           grp = m_rfData.getLCF() == P25_LCF_GROUP;
 			unsigned int dstId = m_rfData.getDstId();
 			unsigned int srcId = m_rfData.getSrcId();
-			std::string source = m_lookup->find(srcId);
+			CUserDBView source = m_lookup->find(srcId);
 
 			m_rfState = RPT_RF_STATE::LISTENING;
 			m_rfTimeout.stop();
@@ -540,10 +544,10 @@ bool CP25Control::writeModem(unsigned char* data, unsigned int len)
 			m_lastDUID = duid;
 
 			if (m_rssi != 0) {
-				LogMessage("P25, received RF end of voice transmission from %s to %s%u, %.1f seconds, BER: %.1f%%, RSSI: %d/%d/%d dBm", source.c_str(), grp ? "TG " : "", dstId, float(m_rfFrames) / 5.56F, float(m_rfErrs * 100U) / float(m_rfBits), m_minRSSI, m_maxRSSI, m_aveRSSI / int(m_rssiCountTotal));
+				LogMessage("P25, received RF end of voice transmission from %s to %s%u, %.1f seconds, BER: %.1f%%, RSSI: %d/%d/%d dBm", source.getCallsign().data(), grp ? "TG " : "", dstId, float(m_rfFrames) / 5.56F, float(m_rfErrs * 100U) / float(m_rfBits), m_minRSSI, m_maxRSSI, m_aveRSSI / int(m_rssiCountTotal));
 				writeJSONRF("end", float(m_rfFrames) / 5.56F, float(m_rfErrs * 100U) / float(m_rfBits), m_minRSSI, m_maxRSSI, m_aveRSSI / int(m_rssiCountTotal));
 			} else {
-				LogMessage("P25, received RF end of voice transmission from %s to %s%u, %.1f seconds, BER: %.1f%%", source.c_str(), grp ? "TG " : "", dstId, float(m_rfFrames) / 5.56F, float(m_rfErrs * 100U) / float(m_rfBits));
+				LogMessage("P25, received RF end of voice transmission from %s to %s%u, %.1f seconds, BER: %.1f%%", source.getCallsign().data(), grp ? "TG " : "", dstId, float(m_rfFrames) / 5.56F, float(m_rfErrs * 100U) / float(m_rfBits));
 				writeJSONRF("end", float(m_rfFrames) / 5.56F, float(m_rfErrs * 100U) / float(m_rfBits));
 			}
 
@@ -1046,10 +1050,10 @@ void CP25Control::createNetHeader()
 	m_netData.setSrcId(srcId);
 	m_netData.setDstId(dstId);
 
-	std::string source = m_lookup->find(srcId);
+	CUserDBView source = m_lookup->find(srcId);
 
-	LogMessage("P25, received network transmission from %s to %s%u", source.c_str(), lcf == P25_LCF_GROUP ? "TG " : "", dstId);
-	writeJSONNet("start", srcId, source, lcf == P25_LCF_GROUP, dstId);
+	LogMessage("P25, received network transmission from %s to %s%u", source.getCallsign().data(), lcf == P25_LCF_GROUP ? "TG " : "", dstId);
+	writeJSONNet("start", srcId, source.getCallsign(), lcf == P25_LCF_GROUP, dstId);
 
 	m_netState = RPT_NET_STATE::AUDIO;
 	m_netTimeout.start();
@@ -1220,9 +1224,9 @@ void CP25Control::createNetTerminator()
 
 	unsigned int dstId = m_netData.getDstId();
 	unsigned int srcId = m_netData.getSrcId();
-	std::string source = m_lookup->find(srcId);
+	CUserDBView source = m_lookup->find(srcId);
 
-	LogMessage("P25, network end of transmission from %s to %s%u, %.1f seconds, %u%% packet loss", source.c_str(), m_netData.getLCF() == P25_LCF_GROUP ? "TG " : "", dstId, float(m_netFrames) / 50.0F, (m_netLost * 100U) / m_netFrames);
+	LogMessage("P25, network end of transmission from %s to %s%u, %.1f seconds, %u%% packet loss", source.getCallsign().data(), m_netData.getLCF() == P25_LCF_GROUP ? "TG " : "", dstId, float(m_netFrames) / 50.0F, (m_netLost * 100U) / m_netFrames);
 	writeJSONNet("end", float(m_netFrames) / 50.0F, float(m_netLost * 100U) / float(m_netFrames));
 
 	m_netTimeout.stop();
@@ -1293,7 +1297,7 @@ void CP25Control::writeJSONBER()
 	}
 }
 
-void CP25Control::writeJSONRF(const char* action, unsigned int srcId, const std::string& srcInfo, bool grp, unsigned int dstId)
+void CP25Control::writeJSONRF(const char* action, unsigned int srcId, std::string_view srcInfo, bool grp, unsigned int dstId)
 {
 	assert(action != nullptr);
 
@@ -1339,7 +1343,7 @@ void CP25Control::writeJSONRF(const char* action, float duration, float ber, int
 	WriteJSON("P25", json);
 }
 
-void CP25Control::writeJSONNet(const char* action, unsigned int srcId, const std::string& srcInfo, bool grp, unsigned int dstId)
+void CP25Control::writeJSONNet(const char* action, unsigned int srcId, std::string_view srcInfo, bool grp, unsigned int dstId)
 {
 	assert(action != nullptr);
 
@@ -1372,7 +1376,7 @@ void CP25Control::writeJSON(nlohmann::json& json, const char* action)
 	json["action"]    = action;
 }
 
-void CP25Control::writeJSON(nlohmann::json& json, const char* source, const char* action, unsigned int srcId, const std::string& srcInfo, bool grp, unsigned int dstId)
+void CP25Control::writeJSON(nlohmann::json& json, const char* source, const char* action, unsigned int srcId, std::string_view srcInfo, bool grp, unsigned int dstId)
 {
 	assert(source != nullptr);
 	assert(action != nullptr);
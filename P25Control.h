@@ -35,12 +35,14 @@
 #if defined(USE_P25)
 
 #include <cstdio>
+#include <string_view>
+#include <vector>
 
 #include <nlohmann/json.hpp>
 
 class CP25Control {
 public:
-	CP25Control(unsigned int nac, unsigned int id, bool selfOly, bool uidOverride, CP25Network* network, unsigned int timeout, bool duplex, CDMRLookup* lookup, bool remoteGateway, CRSSIInterpolator* rssiMapper);
+	CP25Control(unsigned int nac, const std::vector<unsigned int>& rxNACs, unsigned int id, bool selfOly, bool uidOverride, CP25Network* network, unsigned int timeout, bool duplex, CDMRLookup* lookup, bool remoteGateway, CRSSIInterpolator* rssiMapper);
 	~CP25Control();
 
 	bool writeModem(unsigned char* data, unsigned int len);
@@ -126,15 +128,15 @@ private:
 	void writeJSONRSSI();
 	void writeJSONBER();
 
-	void writeJSONRF(const char* action, unsigned int srcId, const std::string& srcInfo, bool grp, unsigned int dstId);
+	void writeJSONRF(const char* action, unsigned int srcId, std::string_view srcInfo, bool grp, unsigned int dstId);
 	void writeJSONRF(const char* action, float duration, float ber);
 	void writeJSONRF(const char* action, float duration, float ber, int minRSSI, int maxRSSI, int aveRSSI);
 
-	void writeJSONNet(const char* action, unsigned int srcId, const std::string& srcInfo, bool grp, unsigned int dstId);
+	void writeJSONNet(const char* action, unsigned int srcId, std::string_view srcInfo, bool grp, unsigned int dstId);
 	void writeJSONNet(const char* action, float duration, float loss);
 
 	void writeJSON(nlohmann::json& json, const char* action);
-	void writeJSON(nlohmann::json& json, const char* source, const char* action, unsigned int srcId, const std::string& srcInfo, bool grp, unsigned int dstId);
+	void writeJSON(nlohmann::json& json, const char* source, const char* action, unsigned int srcId, std::string_view srcInfo, bool grp, unsigned int dstId);
 };
 
 #endif
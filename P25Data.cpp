@@ -86,18 +86,13 @@ bool CP25Data::decodeHeader(const unsigned char* data)
 	unsigned char raw[81U];
 	CP25Utils::decode(data, raw, 114U, 780U);
 
-	// decode Golay (18,6,8) FEC
-	decodeHeaderGolay(raw, rs);
+	// decode Golay (18,6,8) FEC, the hexbits it can't correct are erasures for the RS decoder
+	uint64_t erasures = decodeHeaderGolay(raw, rs);
 
 	// decode RS (36,20,17) FEC
-	try {
-		bool ret = m_rs.decode362017(rs);
-		if (!ret)
-			return false;
-	} catch (...) {
-		CUtils::dump(2U, "P25, RS crashed with input data", rs, 81U);
+	bool ret = m_rs.decode362017(rs, erasures);
+	if (!ret)
 		return false;
-	}
 
 	m_mfId  = rs[9U];						// Mfg Id.
 /*
@@ -155,31 +150,26 @@ bool CP25Data::decodeLDU1(const unsigned char* data)
 
 	unsigned char raw[5U];
 	CP25Utils::decode(data, raw, 410U, 452U);
-	decodeLDUHamming(raw, rs + 0U);
+	uint64_t erasures = decodeLDUHamming(raw, rs + 0U);
 
 	CP25Utils::decode(data, raw, 600U, 640U);
-	decodeLDUHamming(raw, rs + 3U);
+	erasures |= decodeLDUHamming(raw, rs + 3U) << 4;
 
 	CP25Utils::decode(data, raw, 788U, 830U);
-	decodeLDUHamming(raw, rs + 6U);
+	erasures |= decodeLDUHamming(raw, rs + 6U) << 8;
 
 	CP25Utils::decode(data, raw, 978U, 1020U);
-	decodeLDUHamming(raw, rs + 9U);
+	erasures |= decodeLDUHamming(raw, rs + 9U) << 12;
 
 	CP25Utils::decode(data, raw, 1168U, 1208U);
-	decodeLDUHamming(raw, rs + 12U);
+	erasures |= decodeLDUHamming(raw, rs + 12U) << 16;
 
 	CP25Utils::decode(data, raw, 1356U, 1398U);
-	decodeLDUHamming(raw, rs + 15U);
+	erasures |= decodeLDUHamming(raw, rs + 15U) << 20;
 
-	try {
-		bool ret = m_rs.decode241213(rs);
-		if (!ret)
-			return false;
-	} catch (...) {
-		CUtils::dump(2U, "P25, RS carshed with input data", rs, 18U);
+	bool ret = m_rs.decode241213(rs, erasures);
+	if (!ret)
 		return false;
-	}
 
 	unsigned int srcId = (rs[6U] << 16) + (rs[7U] << 8) + rs[8U];
 
@@ -267,32 +257,27 @@ bool CP25Data::decodeLDU2(const unsigned char* data)
 	// deinterleave and decode Hamming (10,6,3) for LC data
 	unsigned char raw[5U];
 	CP25Utils::decode(data, raw, 410U, 452U);
-	decodeLDUHamming(raw, rs + 0U);
+	uint64_t erasures = decodeLDUHamming(raw, rs + 0U);
 
 	CP25Utils::decode(data, raw, 600U, 640U);
-	decodeLDUHamming(raw, rs + 3U);
+	erasures |= decodeLDUHamming(raw, rs + 3U) << 4;
 
 	CP25Utils::decode(data, raw, 788U, 830U);
-	decodeLDUHamming(raw, rs + 6U);
+	erasures |= decodeLDUHamming(raw, rs + 6U) << 8;
 
 	CP25Utils::decode(data, raw, 978U, 1020U);
-	decodeLDUHamming(raw, rs + 9U);
+	erasures |= decodeLDUHamming(raw, rs + 9U) << 12;
 
 	CP25Utils::decode(data, raw, 1168U, 1208U);
-	decodeLDUHamming(raw, rs + 12U);
+	erasures |= decodeLDUHamming(raw, rs + 12U) << 16;
 
 	CP25Utils::decode(data, raw, 1356U, 1398U);
-	decodeLDUHamming(raw, rs + 15U);
+	erasures |= decodeLDUHamming(raw, rs + 15U) << 20;
 
 	// decode RS (24,16,9) FEC
-	try {
-		bool ret = m_rs.decode24169(rs);
-		if (!ret)
-			return false;
-	} catch (...) {
-		CUtils::dump(2U, "P25, RS crashed with input data", rs, 18U);
+	bool ret = m_rs.decode24169(rs, erasures);
+	if (!ret)
 		return false;
-	}
 /*
 	m_algId = rs[9U];                                                    // Algorithm ID
 
@@ -586,25 +571,29 @@ void CP25Data::reset()
 	m_emergency = false;
 }
 
-void CP25Data::decodeLDUHamming(const unsigned char* data, unsigned char* raw)
+// Returns a mask of the hexbits whose Hamming code couldn't be corrected
+unsigned int CP25Data::decodeLDUHamming(const unsigned char* data, unsigned char* raw)
 {
+	unsigned int erasures = 0U;
+
 	unsigned int n = 0U;
 	unsigned int m = 0U;
 	for (unsigned int i = 0U; i < 4U; i++) {
-		bool hamming[10U];
+		unsigned int code = 0U;
+		for (unsigned int j = 0U; j < 10U; j++, n++)
+			code = (code << 1) | (READ_BIT(data, n) ? 0x01U : 0x00U);
 
-		for (unsigned int j = 0U; j < 10U; j++) {
-			hamming[j] = READ_BIT(data, n);
-			n++;
-		}
+		CHamming::decode1063(code);
 
-		CHamming::decode1063(hamming);
+		unsigned int hexbit = code >> 4;
+		if (CHamming::encode1063(hexbit) != code)
+			erasures |= 1U << i;
 
-		for (unsigned int j = 0U; j < 6U; j++) {
-			WRITE_BIT(raw, m, hamming[j]);
-			m++;
-		}
+		for (unsigned int j = 0U; j < 6U; j++, m++)
+			WRITE_BIT(raw, m, (hexbit << j) & 0x20U);
 	}
+
+	return erasures;
 }
 
 void CP25Data::encodeLDUHamming(unsigned char* data, const unsigned char* raw)
@@ -628,35 +617,29 @@ void CP25Data::encodeLDUHamming(unsigned char* data, const unsigned char* raw)
 	}
 }
 
-void CP25Data::decodeHeaderGolay(const unsigned char* data, unsigned char* raw)
+// Returns a mask of the hexbits whose Golay code couldn't be corrected
+uint64_t CP25Data::decodeHeaderGolay(const unsigned char* data, unsigned char* raw)
 {
+	uint64_t erasures = 0U;
+
 	// shortened Golay (18,6,8) decode
 	unsigned int n = 0U;
 	unsigned int m = 0U;
 	for (unsigned int i = 0U; i < 36U; i++) {
-		bool golay[18U];
-		for (unsigned int j = 0U; j < 18U; j++) {
-			golay[j] = READ_BIT(data, n);
-			n++;
-		}
-
 		unsigned int g0 = 0U;
-		for (unsigned int j = 0U; j < 18U; j++)
-			g0 = (g0 << 1) | (golay[j] ? 0x01U : 0x00U);
+		for (unsigned int j = 0U; j < 18U; j++, n++)
+			g0 = (g0 << 1) | (READ_BIT(data, n) ? 0x01U : 0x00U);
 
+		// a correction into the shortened bits is as bad as no correction at all
 		unsigned int c0data = 0U;
-		CGolay24128::decode24128(g0, c0data);
+		if (!CGolay24128::decode24128(g0, c0data) || c0data > 0x3FU)
+			erasures |= uint64_t(1U) << i;
 
-		for (int j = 5; j >= 0; j--) {
-			golay[j] = (c0data & 0x01U) == 0x01U;
-			c0data >>= 1;
-		}
-
-		for (unsigned int j = 0U; j < 6U; j++) {
-			WRITE_BIT(raw, m, golay[j]);
-			m++;
-		}
+		for (unsigned int j = 0U; j < 6U; j++, m++)
+			WRITE_BIT(raw, m, (c0data << j) & 0x20U);
 	}
+
+	return erasures;
 }
 
 void CP25Data::encodeHeaderGolay(unsigned char* data, const unsigned char* raw)
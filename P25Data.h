@@ -27,6 +27,8 @@
 #include "RS634717.h"
 #include "P25Trellis.h"
 
+#include <cstdint>
+
 class CP25Data {
 public:
 	CP25Data();
@@ -88,10 +90,10 @@ private:
 	CRS634717      m_rs;
 	CP25Trellis    m_trellis;
 
-	void decodeLDUHamming(const unsigned char* raw, unsigned char* data);
+	unsigned int decodeLDUHamming(const unsigned char* raw, unsigned char* data);
 	void encodeLDUHamming(unsigned char* data, const unsigned char* raw);
 
-	void decodeHeaderGolay(const unsigned char* raw, unsigned char* data);
+	uint64_t decodeHeaderGolay(const unsigned char* raw, unsigned char* data);
 	void encodeHeaderGolay(unsigned char* data, const unsigned char* raw);
 };
 
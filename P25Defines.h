@@ -41,6 +41,9 @@ const unsigned int P25_SYNC_LENGTH_BITS  = P25_SYNC_LENGTH_BYTES * 8U;
 const unsigned int P25_NID_LENGTH_BYTES  = 8U;
 const unsigned int P25_NID_LENGTH_BITS   = P25_NID_LENGTH_BYTES * 8U;
 
+// The NAC that tells a receiver to accept every NAC
+const unsigned int P25_NAC_RX_ANY = 0xF7EU;
+
 const unsigned char P25_SYNC_BYTES[]      = {0x55U, 0x75U, 0xF5U, 0xFFU, 0x77U, 0xFFU};
 const unsigned char P25_SYNC_BYTES_LENGTH = 6U;
 
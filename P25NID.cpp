@@ -27,10 +27,12 @@
 #include <cstdio>
 #include <cassert>
 
-const unsigned int MAX_NID_ERRS = 5U;
-
-CP25NID::CP25NID(unsigned int nac) :
+CP25NID::CP25NID(unsigned int nac, const std::vector<unsigned int>& rxNACs) :
+m_nac(nac),
+m_rxNACs(rxNACs),
+m_anyNAC(false),
 m_duid(0U),
+m_rxNAC(nac),
 m_hdr(nullptr),
 m_ldu1(nullptr),
 m_ldu2(nullptr),
@@ -39,6 +41,11 @@ m_term(nullptr),
 m_tsdu(nullptr),
 m_pdu(nullptr)
 {
+	for (const auto& rxNAC : m_rxNACs) {
+		if (rxNAC == P25_NAC_RX_ANY)
+			m_anyNAC = true;
+	}
+
 	CBCH bch;
 
 	m_hdr = new unsigned char[P25_NID_LENGTH_BYTES];
@@ -109,49 +116,46 @@ bool CP25NID::decode(const unsigned char* data)
 	unsigned char nid[P25_NID_LENGTH_BYTES];
 	CP25Utils::decode(data, nid, 48U, 114U);
 
-	unsigned int errs = CP25Utils::compare(nid, m_ldu1, P25_NID_LENGTH_BYTES);
-	if (errs < MAX_NID_ERRS) {
-		m_duid = P25_DUID_LDU1;
-		return true;
-	}
-
-	errs = CP25Utils::compare(nid, m_ldu2, P25_NID_LENGTH_BYTES);
-	if (errs < MAX_NID_ERRS) {
-		m_duid = P25_DUID_LDU2;
-		return true;
-	}
-
-	errs = CP25Utils::compare(nid, m_term, P25_NID_LENGTH_BYTES);
-	if (errs < MAX_NID_ERRS) {
-		m_duid = P25_DUID_TERM;
-		return true;
-	}
+	// The NAC and DUID come from the corrected NID, and are checked afterwards
+	CBCH bch;
+	unsigned int errs;
+	bool valid = bch.decode(nid, errs);
+	if (!valid)
+		return false;
 
-	errs = CP25Utils::compare(nid, m_termlc, P25_NID_LENGTH_BYTES);
-	if (errs < MAX_NID_ERRS) {
-		m_duid = P25_DUID_TERM_LC;
-		return true;
-	}
+	unsigned int nac   = (nid[0U] << 4) | (nid[1U] >> 4);
+	unsigned char duid = nid[1U] & 0x0FU;
 
-	errs = CP25Utils::compare(nid, m_hdr, P25_NID_LENGTH_BYTES);
-	if (errs < MAX_NID_ERRS) {
-		m_duid = P25_DUID_HEADER;
-		return true;
+	switch (duid) {
+	case P25_DUID_HEADER:
+	case P25_DUID_TERM:
+	case P25_DUID_LDU1:
+	case P25_DUID_TSDU:
+	case P25_DUID_LDU2:
+	case P25_DUID_PDU:
+	case P25_DUID_TERM_LC:
+		break;
+	default:
+		return false;
 	}
 
-	errs = CP25Utils::compare(nid, m_tsdu, P25_NID_LENGTH_BYTES);
-	if (errs < MAX_NID_ERRS) {
-		m_duid = P25_DUID_TSDU;
-		return true;
+	if (nac != m_nac && !m_anyNAC) {
+		bool found = false;
+		for (const auto& rxNAC : m_rxNACs) {
+			if (nac == rxNAC) {
+				found = true;
+				break;
+			}
+		}
+
+		if (!found)
+			return false;
 	}
 
-	errs = CP25Utils::compare(nid, m_pdu, P25_NID_LENGTH_BYTES);
-	if (errs < MAX_NID_ERRS) {
-		m_duid = P25_DUID_PDU;
-		return true;
-	}
+	m_duid  = duid;
+	m_rxNAC = nac;
 
-	return false;
+	return true;
 }
 
 void CP25NID::encode(unsigned char* data, unsigned char duid) const
@@ -190,5 +194,10 @@ unsigned char CP25NID::getDUID() const
 	return m_duid;
 }
 
+unsigned int CP25NID::getNAC() const
+{
+	return m_rxNAC;
+}
+
 #endif
 
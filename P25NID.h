@@ -24,19 +24,26 @@
 
 #if defined(USE_P25)
 
+#include <vector>
+
 class CP25NID {
 public:
-	CP25NID(unsigned int nac);
+	CP25NID(unsigned int nac, const std::vector<unsigned int>& rxNACs);
 	~CP25NID();
 
 	bool decode(const unsigned char* data);
 
 	unsigned char getDUID() const;
+	unsigned int  getNAC() const;
 
 	void encode(unsigned char* data, unsigned char duid) const;
 
 private:
+	unsigned int   m_nac;
+	std::vector<unsigned int> m_rxNACs;
+	bool           m_anyNAC;
 	unsigned char  m_duid;
+	unsigned int   m_rxNAC;
 	unsigned char* m_hdr;
 	unsigned char* m_ldu1;
 	unsigned char* m_ldu2;
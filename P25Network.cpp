@@ -105,6 +105,11 @@ CP25Network::~CP25Network()
 {
 }
 
+void CP25Network::setSocketOptions(unsigned int rxBufferSize, unsigned int txBufferSize, int dscp, int keepAliveDSCP, int priority)
+{
+	m_socket.setOptions(rxBufferSize, txBufferSize, dscp, keepAliveDSCP, priority);
+}
+
 bool CP25Network::open()
 {
 	if (m_addrLen == 0U) {
@@ -36,6 +36,8 @@ public:
 	CP25Network(const std::string& gatewayAddress, unsigned short gatewayPort, const std::string& localAddress, unsigned short localPort, bool debug);
 	~CP25Network();
 
+	void setSocketOptions(unsigned int rxBufferSize, unsigned int txBufferSize, int dscp, int keepAliveDSCP, int priority);
+
 	bool open();
 
 	void enable(bool enabled);
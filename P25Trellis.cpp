@@ -46,7 +46,9 @@ const unsigned char BIT_MASK_TABLE[] = {0x80U, 0x40U, 0x20U, 0x10U, 0x08U, 0x04U
 #define WRITE_BIT(p,i,b) p[(i)>>3] = (b) ? (p[(i)>>3] | BIT_MASK_TABLE[(i)&7]) : (p[(i)>>3] & ~BIT_MASK_TABLE[(i)&7])
 #define READ_BIT(p,i)    (p[(i)>>3] & BIT_MASK_TABLE[(i)&7])
 
-CP25Trellis::CP25Trellis()
+CP25Trellis::CP25Trellis() :
+m_trellis34(ENCODE_TABLE_34, 8U),
+m_trellis12(ENCODE_TABLE_12, 4U)
 {
 }
 
@@ -65,27 +67,14 @@ bool CP25Trellis::decode34(const unsigned char* data, unsigned char* payload)
 	unsigned char points[49U];
 	dibitsToPoints(dibits, points);
 
-	// Check the original code
 	unsigned char tribits[49U];
-	unsigned int failPos = checkCode34(points, tribits);
-	if (failPos == 999U) {
-		tribitsToBits(tribits, payload);
-		return true;
-	}
-
-	unsigned char savePoints[49U];
-	for (unsigned int i = 0U; i < 49U; i++)
-		savePoints[i] = points[i];
-
-	bool ret = fixCode34(points, failPos, payload);
-	if (ret)
-		return true;
-
-	if (failPos == 0U)
+	unsigned int distance = m_trellis34.decode(points, tribits);
+	if (distance > P25_TRELLIS_MAX_DISTANCE_34)
 		return false;
 
-	// Backtrack one place for a last go
-	return fixCode34(savePoints, failPos - 1U, payload);
+	tribitsToBits(tribits, payload);
+
+	return true;
 }
 
 void CP25Trellis::encode34(const unsigned char* payload, unsigned char* data)
@@ -97,15 +86,7 @@ void CP25Trellis::encode34(const unsigned char* payload, unsigned char* data)
 	bitsToTribits(payload, tribits);
 
 	unsigned char points[49U];
-	unsigned char state = 0U;
-
-	for (unsigned int i = 0U; i < 49U; i++) {
-		unsigned char tribit = tribits[i];
-
-		points[i] = ENCODE_TABLE_34[state * 8U + tribit];
-
-		state = tribit;
-	}
+	m_trellis34.encode(tribits, points);
 
 	signed char dibits[98U];
 	pointsToDibits(points, dibits);
@@ -124,27 +105,14 @@ bool CP25Trellis::decode12(const unsigned char* data, unsigned char* payload)
 	unsigned char points[49U];
 	dibitsToPoints(dibits, points);
 
-	// Check the original code
 	unsigned char bits[49U];
-	unsigned int failPos = checkCode12(points, bits);
-	if (failPos == 999U) {
-		dibitsToBits(bits, payload);
-		return true;
-	}
-
-	unsigned char savePoints[49U];
-	for (unsigned int i = 0U; i < 49U; i++)
-		savePoints[i] = points[i];
-
-	bool ret = fixCode12(points, failPos, payload);
-	if (ret)
-		return true;
-
-	if (failPos == 0U)
+	unsigned int distance = m_trellis12.decode(points, bits);
+	if (distance > P25_TRELLIS_MAX_DISTANCE_12)
 		return false;
 
-	// Backtrack one place for a last go
-	return fixCode12(savePoints, failPos - 1U, payload);
+	dibitsToBits(bits, payload);
+
+	return true;
 }
 
 void CP25Trellis::encode12(const unsigned char* payload, unsigned char* data)
@@ -156,15 +124,7 @@ void CP25Trellis::encode12(const unsigned char* payload, unsigned char* data)
 	bitsToDibits(payload, bits);
 
 	unsigned char points[49U];
-	unsigned char state = 0U;
-
-	for (unsigned int i = 0U; i < 49U; i++) {
-		unsigned char bit = bits[i];
-
-		points[i] = ENCODE_TABLE_12[state * 4U + bit];
-
-		state = bit;
-	}
+	m_trellis12.encode(bits, points);
 
 	signed char dibits[98U];
 	pointsToDibits(points, dibits);
@@ -415,116 +375,5 @@ void CP25Trellis::dibitsToBits(const unsigned char* dibits, unsigned char* paylo
 	}
 }
 
-bool CP25Trellis::fixCode34(unsigned char* points, unsigned int failPos, unsigned char* payload) const
-{
-	for (unsigned j = 0U; j < 20U; j++) {
-		unsigned int bestPos = 0U;
-		unsigned int bestVal = 0U;
-
-		for (unsigned int i = 0U; i < 16U; i++) {
-			points[failPos] = i;
-
-			unsigned char tribits[49U];
-			unsigned int pos = checkCode34(points, tribits);
-			if (pos == 999U) {
-				tribitsToBits(tribits, payload);
-				return true;
-			}
-
-			if (pos > bestPos) {
-				bestPos = pos;
-				bestVal = i;
-			}
-		}
-
-		points[failPos] = bestVal;
-		failPos = bestPos;
-	}
-
-	return false;
-}
-
-unsigned int CP25Trellis::checkCode34(const unsigned char* points, unsigned char* tribits) const
-{
-	unsigned char state = 0U;
-
-	for (unsigned int i = 0U; i < 49U; i++) {
-		tribits[i] = 9U;
-
-		for (unsigned int j = 0U; j < 8U; j++) {
-			if (points[i] == ENCODE_TABLE_34[state * 8U + j]) {
-				tribits[i] = j;
-				break;
-			}
-		}
-
-		if (tribits[i] == 9U)
-			return i;
-
-		state = tribits[i];
-	}
-
-	if (tribits[48U] != 0U)
-		return 48U;
-
-	return 999U;
-}
-
-
-bool CP25Trellis::fixCode12(unsigned char* points, unsigned int failPos, unsigned char* payload) const
-{
-	for (unsigned j = 0U; j < 20U; j++) {
-		unsigned int bestPos = 0U;
-		unsigned int bestVal = 0U;
-
-		for (unsigned int i = 0U; i < 16U; i++) {
-			points[failPos] = i;
-
-			unsigned char dibits[49U];
-			unsigned int pos = checkCode12(points, dibits);
-			if (pos == 999U) {
-				dibitsToBits(dibits, payload);
-				return true;
-			}
-
-			if (pos > bestPos) {
-				bestPos = pos;
-				bestVal = i;
-			}
-		}
-
-		points[failPos] = bestVal;
-		failPos = bestPos;
-	}
-
-	return false;
-}
-
-unsigned int CP25Trellis::checkCode12(const unsigned char* points, unsigned char* dibits) const
-{
-	unsigned char state = 0U;
-
-	for (unsigned int i = 0U; i < 49U; i++) {
-		dibits[i] = 5U;
-
-		for (unsigned int j = 0U; j < 4U; j++) {
-			if (points[i] == ENCODE_TABLE_12[state * 4U + j]) {
-				dibits[i] = j;
-				break;
-			}
-		}
-
-		if (dibits[i] == 5U)
-			return i;
-
-		state = dibits[i];
-	}
-
-	if (dibits[48U] != 0U)
-		return 48U;
-
-	return 999U;
-}
-
 #endif
 
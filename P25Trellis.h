@@ -15,9 +15,14 @@
 #define	P25Trellis_H
 
 #include "Defines.h"
+#include "Trellis.h"
 
 #if defined(USE_P25)
 
+// The most bit errors that a block may have from the closest codeword and still be accepted
+const unsigned int P25_TRELLIS_MAX_DISTANCE_34 = 8U;
+const unsigned int P25_TRELLIS_MAX_DISTANCE_12 = 16U;
+
 class CP25Trellis {
 public:
 	CP25Trellis();
@@ -30,6 +35,9 @@ public:
 	void encode12(const unsigned char* payload, unsigned char* data);
 
 private:
+	CTrellis m_trellis34;
+	CTrellis m_trellis12;
+
 	void deinterleave(const unsigned char* in, signed char* dibits) const;
 	void interleave(const signed char* dibits, unsigned char* out) const;
 	void dibitsToPoints(const signed char* dibits, unsigned char* points) const;
@@ -38,10 +46,6 @@ private:
 	void bitsToDibits(const unsigned char* payload, unsigned char* dibits) const;
 	void tribitsToBits(const unsigned char* tribits, unsigned char* payload) const;
 	void dibitsToBits(const unsigned char* dibits, unsigned char* payload) const;
-	bool fixCode34(unsigned char* points, unsigned int failPos, unsigned char* payload) const;
-	unsigned int checkCode34(const unsigned char* points, unsigned char* tribits) const;
-	bool fixCode12(unsigned char* points, unsigned int failPos, unsigned char* payload) const;
-	unsigned int checkCode12(const unsigned char* points, unsigned char* dibits) const;
 };
 
 #endif
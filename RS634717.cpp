@@ -18,13 +18,10 @@
 */
 
 #include "RS634717.h"
-#include "RS.h"
-
-#include <vector>
+#include "FECTables.h"
 
 #if defined(USE_P25)
 
-#include <cstdio>
 #include <cassert>
 #include <cstring>
 
@@ -82,78 +79,62 @@ const unsigned char ENCODE_MATRIX_362017[20U][36U] = {
 	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 002, 001, 053, 074, 002, 014, 052, 074, 012, 057, 024, 063, 015, 042, 052, 033 },
 	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 034, 035, 002, 023, 021, 027, 022, 033, 064, 042, 005, 073, 051, 046, 073, 060 } };
 
-const unsigned int rsGFexp[64] = {
-	1, 2, 4, 8, 16, 32, 3, 6, 12, 24, 48, 35, 5, 10, 20, 40,
-	19, 38, 15, 30, 60, 59, 53, 41, 17, 34, 7, 14, 28, 56, 51, 37,
-	9, 18, 36, 11, 22, 44, 27, 54, 47, 29, 58, 55, 45, 25, 50, 39,
-	13, 26, 52, 43, 21, 42, 23, 46, 31, 62, 63, 61, 57, 49, 33, 0 };
+const unsigned int GF_SIZE = 63U;		// the number of non-zero elements in GF(2^6)
+
+// GF(2^6) with the primitive polynomial x^6 + x + 1
+constexpr CGaloisTables<6U> GF64(0x43U);
 
-const unsigned int rsGFlog[64] = {
-	63, 0, 1, 6, 2, 12, 7, 26, 3, 32, 13, 35, 8, 48, 27, 18,
-	4, 24, 33, 16, 14, 52, 36, 54, 9, 45, 49, 38, 28, 41, 19, 56,
-	5, 62, 25, 11, 34, 31, 17, 47, 15, 23, 53, 51, 37, 44, 55, 40,
-	10, 61, 46, 30, 50, 22, 39, 43, 29, 60, 42, 21, 20, 59, 57, 58 };
+static_assert(GF64.verify(), "GF(2^6) polynomial isn't primitive");
+static_assert(GF64.SIZE == GF_SIZE && GF64.m_exp[6U] == 0x03U && GF64.m_log[0x3FU] == 0x3AU, "GF(2^6) tables are wrong");
 
-const unsigned char BIT_MASK_TABLE[] = { 0x80U, 0x40U, 0x20U, 0x10U, 0x08U, 0x04U, 0x02U, 0x01U };
+// The longest code is (36,20,17), which has 16 parity symbols
+const unsigned int MAX_HEXBITS = 36U;
+const unsigned int MAX_ROOTS   = 16U;
 
-#define WRITE_BIT(p,i,b) p[(i)>>3] = (b) ? (p[(i)>>3] | BIT_MASK_TABLE[(i)&7]) : (p[(i)>>3] & ~BIT_MASK_TABLE[(i)&7])
-#define READ_BIT(p,i)    (p[(i)>>3] & BIT_MASK_TABLE[(i)&7])
+static inline unsigned char gf6Mult(unsigned char a, unsigned char b)
+{
+	if (a == 0U || b == 0U)
+		return 0U;
+
+	return GF64.m_exp[GF64.m_log[a] + GF64.m_log[b]];
+}
 
-static unsigned char bin2Hex(const unsigned char* input, unsigned int offset)
+// Multiply by alpha ^ n, where n < 63
+static inline unsigned char gf6MultPower(unsigned char a, unsigned int n)
 {
-	unsigned char output = 0x00U;
+	if (a == 0U)
+		return 0U;
 
-	output |= READ_BIT(input, offset + 0U) ? 0x20U : 0x00U;
-	output |= READ_BIT(input, offset + 1U) ? 0x10U : 0x00U;
-	output |= READ_BIT(input, offset + 2U) ? 0x08U : 0x00U;
-	output |= READ_BIT(input, offset + 3U) ? 0x04U : 0x00U;
-	output |= READ_BIT(input, offset + 4U) ? 0x02U : 0x00U;
-	output |= READ_BIT(input, offset + 5U) ? 0x01U : 0x00U;
+	return GF64.m_exp[GF64.m_log[a] + n];
+}
+
+static inline unsigned char gf6Div(unsigned char a, unsigned char b)
+{
+	if (a == 0U)
+		return 0U;
 
-	return output;
+	return GF64.m_exp[GF64.m_log[a] + GF_SIZE - GF64.m_log[b]];
 }
 
-static void hex2Bin(unsigned char input, unsigned char* output, unsigned int offset)
+// Four hexbits are packed MSB first into every three bytes
+static void unpackHexbits(const unsigned char* in, unsigned char* out, unsigned int n)
 {
-	WRITE_BIT(output, offset + 0U, input & 0x20U);
-	WRITE_BIT(output, offset + 1U, input & 0x10U);
-	WRITE_BIT(output, offset + 2U, input & 0x08U);
-	WRITE_BIT(output, offset + 3U, input & 0x04U);
-	WRITE_BIT(output, offset + 4U, input & 0x02U);
-	WRITE_BIT(output, offset + 5U, input & 0x01U);
+	for (unsigned int i = 0U; i < n; i += 4U, in += 3U) {
+		out[i + 0U] = in[0U] >> 2;
+		out[i + 1U] = ((in[0U] << 4) | (in[1U] >> 4)) & 0x3FU;
+		out[i + 2U] = ((in[1U] << 2) | (in[2U] >> 6)) & 0x3FU;
+		out[i + 3U] = in[2U] & 0x3FU;
+	}
 }
 
-#define __RS(TYPE, SYMBOLS, PAYLOAD, POLY, FCR, PRIM)                           \
-            rs::reed_solomon<TYPE,                                        \
-            rs::log_<(SYMBOLS) + 1>::value,                               \
-            (SYMBOLS) - (PAYLOAD), FCR, PRIM,                                   \
-            rs::gfpoly<rs::log_<(SYMBOLS) + 1>::value, POLY>>
-
-#define __RS_63(PAYLOAD) __RS(unsigned char, 63, PAYLOAD, 0x43, 1, 1)
-
-class RS6347 : public __RS_63(47) {
-public:
-	RS6347() : __RS_63(47)() { /* stub */ }
-};
-RS6347 rs634717;    // 16 bit / 8 bit corrections max / 5 bytes total
-
-/**
- * @brief Implements Reed-Solomon (24,12,13)
- */
-class RS6351 : public __RS_63(51) {
-public:
-	RS6351() : __RS_63(51)() { /* stub */ }
-};
-RS6351 rs241213;    // 12 bit / 6 bit corrections max / 3 bytes total
-
-/**
- * @brief Implements Reed-Solomon (24,16,9)
- */
-class RS6355 : public __RS_63(55) {
-public:
-	RS6355() : __RS_63(55)() { /* stub */ }
-};
-RS6355 rs24169;     // 8 bit / 4 bit corrections max / 2 bytes total
+static void packHexbits(const unsigned char* in, unsigned char* out, unsigned int n)
+{
+	for (unsigned int i = 0U; i < n; i += 4U, out += 3U) {
+		out[0U] = (in[i + 0U] << 2) | (in[i + 1U] >> 4);
+		out[1U] = (in[i + 1U] << 4) | (in[i + 2U] >> 2);
+		out[2U] = (in[i + 2U] << 6) | in[i + 3U];
+	}
+}
 
 CRS634717::CRS634717()
 {
@@ -163,153 +144,237 @@ CRS634717::~CRS634717()
 {
 }
 
-bool CRS634717::decode241213(unsigned char* data)
+bool CRS634717::decode241213(unsigned char* data, uint64_t erasures)
 {
 	assert(data != nullptr);
 
-	std::vector<unsigned char> codeword(63, 0);
-
-	unsigned int offset = 0U;
-	for (unsigned int i = 0U; i < 24U; i++, offset += 6U)
-		codeword[39U + i] = bin2Hex(data, offset);
+	return decode(data, 24U, 12U, 6U, erasures);
+}
 
-	int ec = rs241213.decode(codeword);
+void CRS634717::encode241213(unsigned char* data)
+{
+	assert(data != nullptr);
 
-	offset = 0U;
-	for (unsigned int i = 0U; i < 12U; i++, offset += 6U)
-		hex2Bin(codeword[39U + i], data, offset);
+	encode(data, &ENCODE_MATRIX_241213[0U][0U], 24U, 12U);
+}
 
-	if (ec == -1 || ec >= 6)
-		return false;
+bool CRS634717::decode24169(unsigned char* data, uint64_t erasures)
+{
+	assert(data != nullptr);
 
-	return true;
+	return decode(data, 24U, 16U, 4U, erasures);
 }
 
-void CRS634717::encode241213(unsigned char* data)
+void CRS634717::encode24169(unsigned char* data)
 {
 	assert(data != nullptr);
 
-	unsigned char codeword[24U];
+	encode(data, &ENCODE_MATRIX_24169[0U][0U], 24U, 16U);
+}
 
-	for (unsigned int i = 0U; i < 24U; i++) {
-		codeword[i] = 0x00U;
+bool CRS634717::decode362017(unsigned char* data, uint64_t erasures)
+{
+	assert(data != nullptr);
 
-		unsigned int offset = 0U;
-		for (unsigned int j = 0U; j < 12U; j++, offset += 6U) {
-			unsigned char hexbit = bin2Hex(data, offset);
-			codeword[i] ^= gf6Mult(hexbit, ENCODE_MATRIX_241213[j][i]);
-		}
-	}
+	return decode(data, 36U, 20U, 8U, erasures);
+}
+
+void CRS634717::encode362017(unsigned char* data)
+{
+	assert(data != nullptr);
 
-	unsigned int offset = 0U;
-	for (unsigned int i = 0U; i < 24U; i++, offset += 6U)
-		hex2Bin(codeword[i], data, offset);
+	encode(data, &ENCODE_MATRIX_362017[0U][0U], 36U, 20U);
 }
 
-bool CRS634717::decode24169(unsigned char* data)
+void CRS634717::encode(unsigned char* data, const unsigned char* matrix, unsigned int n, unsigned int k) const
 {
 	assert(data != nullptr);
+	assert(matrix != nullptr);
 
-	std::vector<unsigned char> codeword(63, 0);
+	unsigned char codeword[MAX_HEXBITS];
+	unpackHexbits(data, codeword, k);
 
-	unsigned int offset = 0U;
-	for (unsigned int i = 0U; i < 24U; i++, offset += 6U)
-		codeword[39U + i] = bin2Hex(data, offset);
+	// The code is systematic, so only the parity columns of the matrix are needed
+	for (unsigned int i = k; i < n; i++)
+		codeword[i] = 0x00U;
 
-	int ec = rs24169.decode(codeword);
+	for (unsigned int j = 0U; j < k; j++, matrix += n) {
+		if (codeword[j] == 0x00U)
+			continue;
 
-	offset = 0U;
-	for (unsigned int i = 0U; i < 16U; i++, offset += 6U)
-		hex2Bin(codeword[39U + i], data, offset);
+		unsigned int log = GF64.m_log[codeword[j]];
+		for (unsigned int i = k; i < n; i++)
+			codeword[i] ^= gf6MultPower(matrix[i], log);
+	}
 
-	if (ec == -1 || ec >= 4)
-		return false;
+	packHexbits(codeword, data, n);
+}
 
-	return true;
+// Erasure hints come from inner codes that can be wrong about which hexbits are bad, so fall
+// back to an errors only decode when they don't lead to a valid codeword
+bool CRS634717::decode(unsigned char* data, unsigned int n, unsigned int k, unsigned int limit, uint64_t erasures) const
+{
+	assert(data != nullptr);
+
+	if (erasures != 0U && decodeErasures(data, n, k, limit, erasures))
+		return true;
+
+	return decodeErasures(data, n, k, limit, 0U);
 }
 
-void CRS634717::encode24169(unsigned char* data)
+// An errors-and-erasures decoder for the shortened RS(63,47) code, first consecutive root
+// alpha ^ 1. Hexbit i of the n received hexbits is the coefficient of x ^ (n - 1 - i). Bit i
+// of erasures marks hexbit i as unreliable. The block is accepted when twice the errors plus
+// the erasures stays two below twice the limit, without erasures this is fewer than limit errors.
+bool CRS634717::decodeErasures(unsigned char* data, unsigned int n, unsigned int k, unsigned int limit, uint64_t erasures) const
 {
 	assert(data != nullptr);
 
-	unsigned char codeword[24U];
+	const unsigned int nroots = n - k;
 
-	for (unsigned int i = 0U; i < 24U; i++) {
-		codeword[i] = 0x00U;
+	unsigned char codeword[MAX_HEXBITS];
+	unpackHexbits(data, codeword, n);
+
+	// Syndromes S(j) = r(alpha ^ j), j = 1 .. nroots, summed in the log domain one received
+	// hexbit at a time so that zero hexbits cost nothing
+	unsigned char s[MAX_ROOTS];
+	::memset(s, 0x00U, MAX_ROOTS);
+
+	for (unsigned int i = 0U; i < n; i++) {
+		if (codeword[i] == 0x00U)
+			continue;
+
+		unsigned int log   = GF64.m_log[codeword[i]];
+		unsigned int power = n - 1U - i;
+		unsigned int step  = power;
+		for (unsigned int j = 0U; j < nroots; j++) {
+			s[j] ^= GF64.m_exp[log + step];
 
-		unsigned int offset = 0U;
-		for (unsigned int j = 0U; j < 16U; j++, offset += 6U) {
-			unsigned char hexbit = bin2Hex(data, offset);
-			codeword[i] ^= gf6Mult(hexbit, ENCODE_MATRIX_24169[j][i]);
+			step += power;
+			if (step >= GF_SIZE)
+				step -= GF_SIZE;
 		}
 	}
 
-	unsigned int offset = 0U;
-	for (unsigned int i = 0U; i < 24U; i++, offset += 6U)
-		hex2Bin(codeword[i], data, offset);
-}
+	unsigned char any = 0x00U;
+	for (unsigned int j = 0U; j < nroots; j++)
+		any |= s[j];
 
-bool CRS634717::decode362017(unsigned char* data)
-{
-	assert(data != nullptr);
+	if (any == 0x00U)
+		return true;
 
-	std::vector<unsigned char> codeword(63, 0);
+	// The erasure locator is the product of (1 - X x) over the erased positions
+	unsigned char lambda[MAX_ROOTS + 1U];
+	::memset(lambda, 0x00U, MAX_ROOTS + 1U);
+	lambda[0U] = 0x01U;
 
-	unsigned int offset = 0U;
-	for (unsigned int i = 0U; i < 36U; i++, offset += 6U)
-		codeword[27U + i] = bin2Hex(data, offset);
+	unsigned int nErasures = 0U;
+	for (unsigned int i = 0U; i < n; i++) {
+		if ((erasures & (uint64_t(1U) << i)) == 0U)
+			continue;
 
-	int ec = rs634717.decode(codeword);
+		if (nErasures == nroots)
+			return false;
 
-	offset = 0U;
-	for (unsigned int i = 0U; i < 20U; i++, offset += 6U)
-		hex2Bin(codeword[27U + i], data, offset);
+		nErasures++;
 
-	if (ec == -1 || ec >= 8)
-		return false;
+		unsigned int power = n - 1U - i;
+		for (unsigned int j = nErasures; j > 0U; j--)
+			lambda[j] ^= gf6MultPower(lambda[j - 1U], power);
+	}
 
-	return true;
-}
+	// Berlekamp-Massey, starting from the erasure locator
+	unsigned char b[MAX_ROOTS + 1U];
+	::memcpy(b, lambda, MAX_ROOTS + 1U);
 
-void CRS634717::encode362017(unsigned char* data)
-{
-	assert(data != nullptr);
+	unsigned int el = nErasures;
+	for (unsigned int r = nErasures + 1U; r <= nroots; r++) {
+		unsigned char discr = 0x00U;
+		for (unsigned int i = 0U; i < r; i++)
+			discr ^= gf6Mult(lambda[i], s[r - i - 1U]);
 
-	unsigned char codeword[36U];
-
-	for (unsigned int i = 0U; i < 36U; i++) {
-		codeword[i] = 0x00U;
+		if (discr == 0x00U) {
+			::memmove(b + 1U, b, nroots);
+			b[0U] = 0x00U;
+			continue;
+		}
 
-		unsigned int offset = 0U;
-		for (unsigned int j = 0U; j < 20U; j++, offset += 6U) {
-			unsigned char hexbit = bin2Hex(data, offset);
-			codeword[i] ^= gf6Mult(hexbit, ENCODE_MATRIX_362017[j][i]);
+		unsigned char t[MAX_ROOTS + 1U];
+		t[0U] = lambda[0U];
+		for (unsigned int i = 0U; i < nroots; i++)
+			t[i + 1U] = lambda[i + 1U] ^ gf6Mult(discr, b[i]);
+
+		if (2U * el <= r + nErasures - 1U) {
+			el = r + nErasures - el;
+			for (unsigned int i = 0U; i <= nroots; i++)
+				b[i] = gf6Div(lambda[i], discr);
+		} else {
+			::memmove(b + 1U, b, nroots);
+			b[0U] = 0x00U;
 		}
+
+		::memcpy(lambda, t, nroots + 1U);
 	}
 
-	unsigned int offset = 0U;
-	for (unsigned int i = 0U; i < 36U; i++, offset += 6U)
-		hex2Bin(codeword[i], data, offset);
-}
+	unsigned int degLambda = 0U;
+	for (unsigned int i = 0U; i <= nroots; i++) {
+		if (lambda[i] != 0x00U)
+			degLambda = i;
+	}
 
-// GF(2 ^ 6) multiply(for Reed - Solomon encoder)
-unsigned char CRS634717::gf6Mult(unsigned char a, unsigned char b) const
-{
-	unsigned char p = 0x00U;
+	// Chien search over the positions that exist in the shortened code
+	unsigned int loc[MAX_ROOTS];
+	unsigned int count = 0U;
+	for (unsigned int i = 0U; i < n && count < degLambda; i++) {
+		unsigned int inverse = (GF_SIZE - (n - 1U - i)) % GF_SIZE;
 
-	for (unsigned int i = 0U; i < 6U; i++) {
-		if ((b & 0x01U) == 0x01U)
-			p ^= a;
+		unsigned char sum = lambda[0U];
+		for (unsigned int j = 1U, power = inverse; j <= degLambda; j++, power = (power + inverse) % GF_SIZE)
+			sum ^= gf6MultPower(lambda[j], power);
 
-		a <<= 1;
+		if (sum == 0x00U)
+			loc[count++] = i;
+	}
 
-		if ((a & 0x40U) == 0x40U)
-			a ^= 0x43U;			// primitive polynomial : x ^ 6 + x + 1
+	// A locator shorter than the register length, or with roots outside the code, means that
+	// the errors overwhelmed it
+	if (count == 0U || count != degLambda || degLambda != el)
+		return false;
 
-		b >>= 1;
+	unsigned int nErrors = count - nErasures;
+	if (2U * nErrors + nErasures > 2U * (limit - 1U))
+		return false;
+
+	// The error evaluator, omega(x) = S(x) lambda(x) mod x ^ nroots
+	unsigned char omega[MAX_ROOTS];
+	for (unsigned int i = 0U; i < nroots; i++) {
+		unsigned char sum = 0x00U;
+		for (unsigned int j = 0U; j <= i && j <= degLambda; j++)
+			sum ^= gf6Mult(s[i - j], lambda[j]);
+		omega[i] = sum;
 	}
 
-	return p;
+	// Forney, the error value is omega(X ^ -1) / lambda'(X ^ -1)
+	for (unsigned int j = 0U; j < count; j++) {
+		unsigned int inverse = (GF_SIZE - (n - 1U - loc[j])) % GF_SIZE;
+
+		unsigned char num = 0x00U;
+		for (unsigned int i = 0U, power = 0U; i < nroots; i++, power = (power + inverse) % GF_SIZE)
+			num ^= gf6MultPower(omega[i], power);
+
+		unsigned char den = 0x00U;
+		for (unsigned int i = 1U, power = 0U; i <= degLambda; i += 2U, power = (power + 2U * inverse) % GF_SIZE)
+			den ^= gf6MultPower(lambda[i], power);
+
+		if (den == 0x00U)
+			return false;
+
+		codeword[loc[j]] ^= gf6Div(num, den);
+	}
+
+	packHexbits(codeword, data, k);
+
+	return true;
 }
 
 #endif
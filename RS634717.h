@@ -1,5 +1,5 @@
 /*
-*   Copyright (C) 2016,2023,2024 by Jonathan Naylor G4KLX
+*   Copyright (C) 2016,2023,2024,2025 by Jonathan Naylor G4KLX
 *	Copyright (C) 2018,2023 by Bryan Biedenkapp <gatekeep@gmail.com> N2PLL
 *
 *   This program is free software; you can redistribute it and/or modify
@@ -24,22 +24,28 @@
 
 #if defined(USE_P25)
 
+#include <cstdint>
+
 class CRS634717
 {
 public:
 	CRS634717();
 	~CRS634717();
 
-	bool decode241213(unsigned char* data);
-	bool decode24169(unsigned char* data);
-	bool decode362017(unsigned char* data);
+	// Bit n of erasures marks hexbit n of the codeword as unreliable, for example when its
+	// inner Golay or Hamming code could not be corrected.
+	bool decode241213(unsigned char* data, uint64_t erasures = 0U);
+	bool decode24169(unsigned char* data, uint64_t erasures = 0U);
+	bool decode362017(unsigned char* data, uint64_t erasures = 0U);
 
 	void encode241213(unsigned char* data);
 	void encode24169(unsigned char* data);
 	void encode362017(unsigned char* data);
 
 private:
-	unsigned char gf6Mult(unsigned char a, unsigned char b) const;
+	bool decode(unsigned char* data, unsigned int n, unsigned int k, unsigned int limit, uint64_t erasures) const;
+	bool decodeErasures(unsigned char* data, unsigned int n, unsigned int k, unsigned int limit, uint64_t erasures) const;
+	void encode(unsigned char* data, const unsigned char* matrix, unsigned int n, unsigned int k) const;
 };
 
 #endif
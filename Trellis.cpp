@@ -0,0 +1,138 @@
+/*
+ *   Copyright (C) 2025 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "Trellis.h"
+
+#include <cstdio>
+#include <cassert>
+
+const unsigned int MAX_STATES = 8U;
+
+const unsigned int NO_PATH = 0xFFFFU;
+
+// The dibits of each constellation point
+constexpr signed char POINT_TABLE[16U][2U] = {
+	{+1, -1}, {-1, -1}, {+3, -3}, {-3, -3}, {-3, -1}, {+3, -1}, {-1, -3}, {+1, -3},
+	{-3, +3}, {+3, +3}, {-1, +1}, {+1, +1}, {+1, +3}, {-1, +3}, {+3, +1}, {-3, +1}};
+
+// The two bits that carry each dibit, Gray coded so that neighbouring levels differ by one bit
+constexpr unsigned int dibitToBits(signed char dibit)
+{
+	return (dibit == +3) ? 0x01U : (dibit == +1) ? 0x00U : (dibit == -1) ? 0x02U : 0x03U;
+}
+
+// The number of bits that differ between every pair of constellation points
+class CPointDistances {
+public:
+	constexpr CPointDistances() :
+	m_distance()
+	{
+		for (unsigned int a = 0U; a < 16U; a++) {
+			for (unsigned int b = 0U; b < 16U; b++) {
+				unsigned int diff = ((dibitToBits(POINT_TABLE[a][0U]) << 2) | dibitToBits(POINT_TABLE[a][1U])) ^
+						    ((dibitToBits(POINT_TABLE[b][0U]) << 2) | dibitToBits(POINT_TABLE[b][1U]));
+				unsigned char count = 0U;
+				for (; diff != 0U; diff &= diff - 1U)
+					count++;
+				m_distance[a][b] = count;
+			}
+		}
+	}
+
+	unsigned char m_distance[16U][16U];
+};
+
+constexpr CPointDistances POINT_DISTANCES;
+
+CTrellis::CTrellis(const unsigned char* encodeTable, unsigned int states) :
+m_encodeTable(encodeTable),
+m_states(states)
+{
+	assert(encodeTable != nullptr);
+	assert(states <= MAX_STATES);
+}
+
+CTrellis::~CTrellis()
+{
+}
+
+unsigned int CTrellis::decode(const unsigned char* points, unsigned char* symbols) const
+{
+	assert(points != nullptr);
+	assert(symbols != nullptr);
+
+	unsigned int metrics[MAX_STATES];
+	metrics[0U] = 0U;
+	for (unsigned int s = 1U; s < m_states; s++)
+		metrics[s] = NO_PATH;
+
+	// The best previous state for each state after each point
+	unsigned char decisions[TRELLIS_LENGTH_POINTS][MAX_STATES];
+
+	for (unsigned int i = 0U; i < TRELLIS_LENGTH_POINTS; i++) {
+		assert(points[i] < 16U);
+		const unsigned char* distance = POINT_DISTANCES.m_distance[points[i]];
+
+		// The next state is the input symbol
+		unsigned int newMetrics[MAX_STATES];
+		for (unsigned int t = 0U; t < m_states; t++) {
+			unsigned int best  = NO_PATH;
+			unsigned char from = 0U;
+
+			for (unsigned int s = 0U; s < m_states; s++) {
+				unsigned int metric = metrics[s] + distance[m_encodeTable[s * m_states + t]];
+				if (metric < best) {
+					best = metric;
+					from = s;
+				}
+			}
+
+			newMetrics[t]   = best;
+			decisions[i][t] = from;
+		}
+
+		for (unsigned int s = 0U; s < m_states; s++)
+			metrics[s] = newMetrics[s];
+	}
+
+	// The last symbol is always zero, which leaves the trellis in state 0
+	unsigned int state = 0U;
+	for (unsigned int i = TRELLIS_LENGTH_POINTS; i-- > 0U; ) {
+		symbols[i] = state;
+		state = decisions[i][state];
+	}
+
+	return metrics[0U];
+}
+
+void CTrellis::encode(const unsigned char* symbols, unsigned char* points) const
+{
+	assert(symbols != nullptr);
+	assert(points != nullptr);
+
+	unsigned int state = 0U;
+
+	for (unsigned int i = 0U; i < TRELLIS_LENGTH_POINTS; i++) {
+		unsigned int symbol = symbols[i];
+		assert(symbol < m_states);
+
+		points[i] = m_encodeTable[state * m_states + symbol];
+
+		state = symbol;
+	}
+}
@@ -0,0 +1,47 @@
+/*
+ *   Copyright (C) 2025 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(Trellis_H)
+#define	Trellis_H
+
+const unsigned int TRELLIS_LENGTH_POINTS = 49U;
+
+/*
+ * The rate 1/2 and 3/4 trellis codes used by DMR and P25. The state is the previous input
+ * symbol and each input symbol from a state sends one of sixteen constellation points,
+ * each of which is a pair of 4FSK dibits. A block is 49 points starting and ending in
+ * state 0.
+ */
+class CTrellis {
+public:
+	CTrellis(const unsigned char* encodeTable, unsigned int states);
+	~CTrellis();
+
+	// Find the path through the trellis closest to the received points with a Viterbi
+	// decoder. The input symbols along it are returned, and the number of bit errors
+	// between the path and the points.
+	unsigned int decode(const unsigned char* points, unsigned char* symbols) const;
+
+	void encode(const unsigned char* symbols, unsigned char* points) const;
+
+private:
+	const unsigned char* m_encodeTable;
+	unsigned int         m_states;
+};
+
+#endif
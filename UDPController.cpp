@@ -24,11 +24,34 @@
 
 const unsigned int BUFFER_LENGTH = 600U;
 
+const unsigned char MMDVM_FRAME_START = 0xE0U;
+
+static unsigned int frameLength(const unsigned char* data, unsigned int length)
+{
+	if (length < 2U)
+		return 0U;
+
+	if (data[1U] != 0U)
+		return data[1U];
+
+	if (length < 3U)
+		return 0U;
+
+	return data[2U] + 255U;
+}
+
 CUDPController::CUDPController(const std::string& modemAddress, unsigned int modemPort, const std::string& localAddress, unsigned int localPort) :
 m_socket(localAddress, localPort),
 m_addr(),
 m_addrLen(0U),
-m_buffer(2000U, "UDP Controller Ring Buffer")
+m_datagrams(nullptr),
+m_lengths(nullptr),
+m_addresses(nullptr),
+m_count(0U),
+m_index(0U),
+m_offset(0U),
+m_frame(nullptr),
+m_frameLen(0U)
 {
 	assert(!modemAddress.empty());
 	assert(modemPort > 0U);
@@ -36,10 +59,19 @@ m_buffer(2000U, "UDP Controller Ring Buffer")
 
 	if (CUDPSocket::lookup(modemAddress, modemPort, m_addr, m_addrLen) != 0)
 		m_addrLen = 0U;
+
+	m_datagrams = new unsigned char[UDP_MAX_DATAGRAMS * BUFFER_LENGTH];
+	m_lengths   = new unsigned int[UDP_MAX_DATAGRAMS];
+	m_addresses = new sockaddr_storage[UDP_MAX_DATAGRAMS];
+	m_frame     = new unsigned char[BUFFER_LENGTH];
 }
 
 CUDPController::~CUDPController()
 {
+	delete[] m_datagrams;
+	delete[] m_lengths;
+	delete[] m_addresses;
+	delete[] m_frame;
 }
 
 bool CUDPController::open()
@@ -54,33 +86,82 @@ bool CUDPController::open()
 
 int CUDPController::read(unsigned char* buffer, unsigned int length)
 {
-    assert(buffer != nullptr);
-    assert(length > 0U);
-
-    unsigned char data[BUFFER_LENGTH];
-    sockaddr_storage addr;
-    unsigned int addrLen;
-    int ret = m_socket.read(data, BUFFER_LENGTH, addr, addrLen);
-
-    // An error occurred on the socket
-    if (ret < 0)
-        return ret;
-
-    // Add new data to the ring buffer
-    if (ret > 0) {
-        if (CUDPSocket::match(addr, m_addr))
-            m_buffer.addData(data, ret);
-    }
-
-    // Get required data from the ring buffer
-    unsigned int avail = m_buffer.dataSize();
-    if (avail < length)
-        length = avail;
-
-    if (length > 0U)
-        m_buffer.getData(buffer, length);
+	assert(buffer != nullptr);
+	assert(length > 0U);
 
-    return int(length);
+	for (;;) {
+		// Drain all of the pending datagrams in one go
+		if (m_index >= m_count) {
+			int ret = m_socket.read(m_datagrams, BUFFER_LENGTH, UDP_MAX_DATAGRAMS, m_lengths, m_addresses);
+			if (ret <= 0)
+				return ret;
+
+			m_count  = ret;
+			m_index  = 0U;
+			m_offset = 0U;
+		}
+
+		if (!CUDPSocket::match(m_addresses[m_index], m_addr) || m_offset >= m_lengths[m_index]) {
+			m_index++;
+			m_offset = 0U;
+			continue;
+		}
+
+		const unsigned char* data = m_datagrams + m_index * BUFFER_LENGTH + m_offset;
+		unsigned int avail = m_lengths[m_index] - m_offset;
+
+		if (m_frameLen == 0U) {
+			// Resynchronise on the next datagram
+			if (data[0U] != MMDVM_FRAME_START) {
+				m_index++;
+				m_offset = 0U;
+				continue;
+			}
+
+			// The normal case, the whole frame is within the datagram and is passed on directly
+			unsigned int len = frameLength(data, avail);
+			if (len > 0U && len <= avail) {
+				m_offset += len;
+
+				if (len > length) {
+					LogWarning("MMDVM frame of %u bytes is too long for the buffer", len);
+					continue;
+				}
+
+				::memcpy(buffer, data, len);
+				return int(len);
+			}
+		}
+
+		// The frame is split across datagrams, so assemble it
+		unsigned int len  = frameLength(m_frame, m_frameLen);
+		unsigned int want = (len == 0U) ? 1U : len - m_frameLen;
+		if (want > avail)
+			want = avail;
+		if (m_frameLen + want > BUFFER_LENGTH) {
+			m_frameLen = 0U;
+			m_index++;
+			m_offset = 0U;
+			continue;
+		}
+
+		::memcpy(m_frame + m_frameLen, data, want);
+		m_frameLen += want;
+		m_offset   += want;
+
+		len = frameLength(m_frame, m_frameLen);
+		if (len > 0U && m_frameLen >= len) {
+			m_frameLen = 0U;
+
+			if (len > length) {
+				LogWarning("MMDVM frame of %u bytes is too long for the buffer", len);
+				continue;
+			}
+
+			::memcpy(buffer, m_frame, len);
+			return int(len);
+		}
+	}
 }
 
 int CUDPController::write(const unsigned char* buffer, unsigned int length)
@@ -94,4 +175,14 @@ int CUDPController::write(const unsigned char* buffer, unsigned int length)
 void CUDPController::close()
 {
 	m_socket.close();
+
+	m_count    = 0U;
+	m_index    = 0U;
+	m_offset   = 0U;
+	m_frameLen = 0U;
+}
+
+bool CUDPController::isFramed() const
+{
+	return true;
 }
@@ -20,7 +20,6 @@
 #define UDPController_H
 
 #include "ModemPort.h"
-#include "RingBuffer.h"
 #include "UDPSocket.h"
 
 #include <string>
@@ -37,6 +36,8 @@ public:
 	virtual int write(const unsigned char* buffer, unsigned int length);
 
 	virtual void close();
+
+	virtual bool isFramed() const;
 	
 #if defined(__APPLE__)
 	int setNonblock(bool nonblock) { return 0; }
@@ -46,7 +47,14 @@ protected:
 	CUDPSocket       m_socket;
 	sockaddr_storage m_addr;
 	unsigned int     m_addrLen;
-	CRingBuffer<unsigned char> m_buffer;
+	unsigned char*   m_datagrams;
+	unsigned int*    m_lengths;
+	sockaddr_storage* m_addresses;
+	unsigned int     m_count;
+	unsigned int     m_index;
+	unsigned int     m_offset;
+	unsigned char*   m_frame;
+	unsigned int     m_frameLen;
 };
 
 #endif
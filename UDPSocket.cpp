@@ -19,17 +19,25 @@
 #include "UDPSocket.h"
 
 #include <cassert>
+#include <cstdint>
 
 #if !defined(_WIN32) && !defined(_WIN64)
 #include <cerrno>
 #include <cstring>
 #endif
 
+#include "Utils.h"
 #include "Log.h"
 
 CUDPSocket::CUDPSocket(const std::string& address, unsigned short port) :
 m_localAddress(address),
 m_localPort(port),
+m_rxBufferSize(0U),
+m_txBufferSize(0U),
+m_dscp(-1),
+m_keepAliveDSCP(-1),
+m_priority(-1),
+m_drops(0U),
 #if defined(_WIN32) || defined(_WIN64)
 m_fd(INVALID_SOCKET),
 #else
@@ -42,6 +50,12 @@ m_af(AF_UNSPEC)
 CUDPSocket::CUDPSocket(unsigned short port) :
 m_localAddress(),
 m_localPort(port),
+m_rxBufferSize(0U),
+m_txBufferSize(0U),
+m_dscp(-1),
+m_keepAliveDSCP(-1),
+m_priority(-1),
+m_drops(0U),
 #if defined(_WIN32) || defined(_WIN64)
 m_fd(INVALID_SOCKET),
 #else
@@ -155,6 +169,15 @@ bool CUDPSocket::isNone(const sockaddr_storage& addr)
 	return ((addr.ss_family == AF_INET) && (in->sin_addr.s_addr == htonl(INADDR_NONE)));
 }
 
+void CUDPSocket::setOptions(unsigned int rxBufferSize, unsigned int txBufferSize, int dscp, int keepAliveDSCP, int priority)
+{
+	m_rxBufferSize  = rxBufferSize;
+	m_txBufferSize  = txBufferSize;
+	m_dscp          = dscp;
+	m_keepAliveDSCP = keepAliveDSCP;
+	m_priority      = priority;
+}
+
 bool CUDPSocket::open(const sockaddr_storage& address)
 {
 	m_af = address.ss_family;
@@ -222,9 +245,53 @@ bool CUDPSocket::open()
 		LogInfo("Opening UDP port on %hu", m_localPort);
 	}
 
+	setOptions();
+
 	return true;
 }
 
+// Failures here are not fatal, the socket simply runs with the kernel defaults
+void CUDPSocket::setOptions()
+{
+	m_drops = 0U;
+
+	if (m_rxBufferSize > 0U) {
+		int size = int(m_rxBufferSize);
+		if (::setsockopt(m_fd, SOL_SOCKET, SO_RCVBUF, (char *)&size, sizeof(size)) == -1)
+			LogWarning("Cannot set the UDP receive buffer size to %u", m_rxBufferSize);
+	}
+
+	if (m_txBufferSize > 0U) {
+		int size = int(m_txBufferSize);
+		if (::setsockopt(m_fd, SOL_SOCKET, SO_SNDBUF, (char *)&size, sizeof(size)) == -1)
+			LogWarning("Cannot set the UDP send buffer size to %u", m_txBufferSize);
+	}
+
+#if !defined(_WIN32) && !defined(_WIN64)
+	if (m_dscp >= 0) {
+		int tos = m_dscp << 2;
+		int ret;
+		if (m_af == AF_INET6)
+			ret = ::setsockopt(m_fd, IPPROTO_IPV6, IPV6_TCLASS, &tos, sizeof(tos));
+		else
+			ret = ::setsockopt(m_fd, IPPROTO_IP, IP_TOS, &tos, sizeof(tos));
+		if (ret == -1)
+			LogWarning("Cannot set the UDP DSCP to %d, err: %d", m_dscp, errno);
+	}
+#endif
+
+#if defined(__linux__)
+	if (m_priority >= 0) {
+		if (::setsockopt(m_fd, SOL_SOCKET, SO_PRIORITY, &m_priority, sizeof(m_priority)) == -1)
+			LogWarning("Cannot set the UDP socket priority to %d, err: %d", m_priority, errno);
+	}
+
+	// Have the kernel report how many packets it has dropped for want of buffer space
+	int ovfl = 1;
+	::setsockopt(m_fd, SOL_SOCKET, SO_RXQ_OVFL, &ovfl, sizeof(ovfl));
+#endif
+}
+
 int CUDPSocket::read(unsigned char* buffer, unsigned int length, sockaddr_storage& address, unsigned int &addressLength)
 {
 	assert(buffer != nullptr);
@@ -270,6 +337,27 @@ int CUDPSocket::read(unsigned char* buffer, unsigned int length, sockaddr_storag
 
 #if defined(_WIN32) || defined(_WIN64)
 	int len = ::recvfrom(m_fd, (char*)buffer, length, 0, (sockaddr *)&address, &size);
+#elif defined(__linux__)
+	struct iovec iov;
+	iov.iov_base = buffer;
+	iov.iov_len  = length;
+
+	unsigned char control[CMSG_SPACE(sizeof(uint32_t))];
+
+	struct msghdr header;
+	::memset(&header, 0x00, sizeof(struct msghdr));
+	header.msg_name       = &address;
+	header.msg_namelen    = size;
+	header.msg_iov        = &iov;
+	header.msg_iovlen     = 1;
+	header.msg_control    = control;
+	header.msg_controllen = sizeof(control);
+
+	ssize_t len = ::recvmsg(m_fd, &header, 0);
+	if (len > 0) {
+		size = header.msg_namelen;
+		checkDrops(header);
+	}
 #else
 	ssize_t len = ::recvfrom(m_fd, (char*)buffer, length, 0, (sockaddr *)&address, &size);
 #endif
@@ -293,6 +381,68 @@ int CUDPSocket::read(unsigned char* buffer, unsigned int length, sockaddr_storag
 	return len;
 }
 
+// Reads up to count datagrams, each into its own length sized slot of buffers
+int CUDPSocket::read(unsigned char* buffers, unsigned int length, unsigned int count, unsigned int* lengths, sockaddr_storage* addresses)
+{
+	assert(buffers != nullptr);
+	assert(length > 0U);
+	assert(count > 0U && count <= UDP_MAX_DATAGRAMS);
+	assert(lengths != nullptr);
+	assert(addresses != nullptr);
+
+#if defined(__linux__)
+	if (m_fd == -1)
+		return 0;
+
+	struct mmsghdr msgs[UDP_MAX_DATAGRAMS];
+	struct iovec   iovs[UDP_MAX_DATAGRAMS];
+	unsigned char  control[UDP_MAX_DATAGRAMS][CMSG_SPACE(sizeof(uint32_t))];
+
+	for (unsigned int i = 0U; i < count; i++) {
+		iovs[i].iov_base = buffers + i * length;
+		iovs[i].iov_len  = length;
+
+		::memset(&msgs[i], 0x00, sizeof(struct mmsghdr));
+		msgs[i].msg_hdr.msg_name       = &addresses[i];
+		msgs[i].msg_hdr.msg_namelen    = sizeof(sockaddr_storage);
+		msgs[i].msg_hdr.msg_iov        = &iovs[i];
+		msgs[i].msg_hdr.msg_iovlen     = 1;
+		msgs[i].msg_hdr.msg_control    = control[i];
+		msgs[i].msg_hdr.msg_controllen = sizeof(control[i]);
+	}
+
+	int ret = ::recvmmsg(m_fd, msgs, count, MSG_DONTWAIT, nullptr);
+	if (ret < 0) {
+		if (errno == EAGAIN || errno == EWOULDBLOCK)
+			return 0;
+
+		LogError("Error returned from recvmmsg, err: %d", errno);
+		return -1;
+	}
+
+	for (int i = 0; i < ret; i++) {
+		lengths[i] = msgs[i].msg_len;
+		checkDrops(msgs[i].msg_hdr);
+	}
+
+	return ret;
+#else
+	unsigned int n = 0U;
+	while (n < count) {
+		unsigned int addressLength;
+		int ret = read(buffers + n * length, length, addresses[n], addressLength);
+		if (ret < 0)
+			return n > 0U ? int(n) : -1;
+		if (ret == 0)
+			break;
+
+		lengths[n++] = ret;
+	}
+
+	return int(n);
+#endif
+}
+
 bool CUDPSocket::write(const unsigned char* buffer, unsigned int length, const sockaddr_storage& address, unsigned int addressLength)
 {
 	assert(buffer != nullptr);
@@ -330,6 +480,87 @@ bool CUDPSocket::write(const unsigned char* buffer, unsigned int length, const s
 	return result;
 }
 
+bool CUDPSocket::writeKeepAlive(const unsigned char* buffer, unsigned int length, const sockaddr_storage& address, unsigned int addressLength)
+{
+#if defined(_WIN32) || defined(_WIN64)
+	return write(buffer, length, address, addressLength);
+#else
+	assert(buffer != nullptr);
+	assert(length > 0U);
+	assert(m_fd >= 0);
+
+	if (m_keepAliveDSCP < 0)
+		return write(buffer, length, address, addressLength);
+
+	// Mark just this packet with the keep-alive traffic class
+	struct iovec iov;
+	iov.iov_base = (void*)buffer;
+	iov.iov_len  = length;
+
+	unsigned char control[CMSG_SPACE(sizeof(int))];
+	::memset(control, 0x00, sizeof(control));
+
+	struct msghdr header;
+	::memset(&header, 0x00, sizeof(struct msghdr));
+	header.msg_name       = (void*)&address;
+	header.msg_namelen    = addressLength;
+	header.msg_iov        = &iov;
+	header.msg_iovlen     = 1;
+	header.msg_control    = control;
+	header.msg_controllen = sizeof(control);
+
+	struct cmsghdr* cmsg = CMSG_FIRSTHDR(&header);
+	cmsg->cmsg_level = (m_af == AF_INET6) ? IPPROTO_IPV6 : IPPROTO_IP;
+	cmsg->cmsg_type  = (m_af == AF_INET6) ? IPV6_TCLASS : IP_TOS;
+	cmsg->cmsg_len   = CMSG_LEN(sizeof(int));
+
+	int tos = m_keepAliveDSCP << 2;
+	::memcpy(CMSG_DATA(cmsg), &tos, sizeof(int));
+
+	ssize_t ret = ::sendmsg(m_fd, &header, 0);
+	if (ret < 0) {
+		LogError("Error returned from sendmsg, err: %d", errno);
+		return false;
+	}
+
+	return ret == ssize_t(length);
+#endif
+}
+
+unsigned int CUDPSocket::getDrops() const
+{
+	return m_drops;
+}
+
+#if defined(__linux__)
+void CUDPSocket::checkDrops(struct msghdr& header)
+{
+	for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&header); cmsg != nullptr; cmsg = CMSG_NXTHDR(&header, cmsg)) {
+		if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SO_RXQ_OVFL)
+			continue;
+
+		uint32_t drops;
+		::memcpy(&drops, CMSG_DATA(cmsg), sizeof(uint32_t));
+
+		// The kernel count is cumulative for the life of the socket
+		if (drops != m_drops) {
+			LogWarning("UDP port %hu, %u packets dropped by the kernel, %u in total", m_localPort, drops - m_drops, drops);
+
+			nlohmann::json json;
+
+			json["timestamp"] = CUtils::createTimestamp();
+			json["port"]      = int(m_localPort);
+			json["dropped"]   = int(drops - m_drops);
+			json["total"]     = int(drops);
+
+			WriteJSON("UDP", json);
+
+			m_drops = drops;
+		}
+	}
+}
+#endif
+
 void CUDPSocket::close()
 {
 #if defined(_WIN32) || defined(_WIN64)
@@ -36,6 +36,8 @@
 #include <Winsock2.h>
 #endif
 
+const unsigned int UDP_MAX_DATAGRAMS = 16U;
+
 enum class IPMATCHTYPE {
 	ADDRESS_AND_PORT,
 	ADDRESS_ONLY
@@ -47,11 +49,17 @@ public:
 	CUDPSocket(unsigned short port = 0U);
 	~CUDPSocket();
 
+	void setOptions(unsigned int rxBufferSize, unsigned int txBufferSize, int dscp, int keepAliveDSCP, int priority);
+
 	bool open();
 	bool open(const sockaddr_storage& address);
 
 	int  read(unsigned char* buffer, unsigned int length, sockaddr_storage& address, unsigned int &addressLength);
+	int  read(unsigned char* buffers, unsigned int length, unsigned int count, unsigned int* lengths, sockaddr_storage* addresses);
 	bool write(const unsigned char* buffer, unsigned int length, const sockaddr_storage& address, unsigned int addressLength);
+	bool writeKeepAlive(const unsigned char* buffer, unsigned int length, const sockaddr_storage& address, unsigned int addressLength);
+
+	unsigned int getDrops() const;
 
 	void close();
 
@@ -68,6 +76,12 @@ public:
 private:
 	std::string    m_localAddress;
 	unsigned short m_localPort;
+	unsigned int   m_rxBufferSize;
+	unsigned int   m_txBufferSize;
+	int            m_dscp;
+	int            m_keepAliveDSCP;
+	int            m_priority;
+	unsigned int   m_drops;
 #if defined(_WIN32) || defined(_WIN64)
 	SOCKET         m_fd;
 	int            m_af;
@@ -75,6 +89,11 @@ private:
 	int            m_fd;
 	sa_family_t    m_af;
 #endif
+
+	void setOptions();
+#if defined(__linux__)
+	void checkDrops(struct msghdr& header);
+#endif
 };
 
 #endif
@@ -17,68 +17,357 @@
  *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
  */
 #include "UserDB.h"
+#include "Thread.h"
+#include "CRC.h"
 #include "Log.h"
 
 #if defined(USE_DMR) || defined(USE_P25) || defined(USE_NXDN)
 
+#include <cstdint>
 #include <cstdio>
 #include <cstring>
 #include <cctype>
+#include <algorithm>
+#include <cassert>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+static_assert(sizeof(UserDBHeader) == 32U, "The binary ID file header must have no padding");
+
+// How long in ms a reload waits for the lookups in progress before it reports them
+const unsigned int USERDB_READER_WARNING = 1000U;
+
+UserDBTable::UserDBTable() :
+m_count(0U),
+m_textLength(0U),
+m_ids(nullptr),
+m_offsets(nullptr),
+m_text(nullptr),
+m_idStore(),
+m_offsetStore(),
+m_textStore(),
+m_map(nullptr),
+m_mapLength(0U)
+{
+}
+
+UserDBTable::~UserDBTable()
+{
+	if (m_map == nullptr)
+		return;
+
+#if defined(_WIN32) || defined(_WIN64)
+	::UnmapViewOfFile(m_map);
+#else
+	::munmap(m_map, m_mapLength);
+#endif
+}
+
+CUserDBView::CUserDBView(const char* callsign) :
+m_readers(nullptr),
+m_text(nullptr),
+m_offsets(nullptr),
+m_callsign()
+{
+	assert(callsign != nullptr);
+	assert(::strlen(callsign) < sizeof(m_callsign));
+
+	::strncpy(m_callsign, callsign, sizeof(m_callsign) - 1U);
+}
+
+CUserDBView::CUserDBView(unsigned int id) :
+m_readers(nullptr),
+m_text(nullptr),
+m_offsets(nullptr),
+m_callsign()
+{
+	::snprintf(m_callsign, sizeof(m_callsign), "%u", id);
+}
+
+CUserDBView::CUserDBView(std::atomic<unsigned int>* readers, const char* text, const unsigned int* offsets) :
+m_readers(readers),
+m_text(text),
+m_offsets(offsets),
+m_callsign()
+{
+	assert(readers != nullptr);
+	assert(text != nullptr);
+	assert(offsets != nullptr);
+}
+
+CUserDBView::CUserDBView(CUserDBView&& view) :
+m_readers(view.m_readers),
+m_text(view.m_text),
+m_offsets(view.m_offsets),
+m_callsign()
+{
+	::memcpy(m_callsign, view.m_callsign, sizeof(m_callsign));
+
+	view.m_readers = nullptr;
+}
+
+CUserDBView::~CUserDBView()
+{
+	if (m_readers != nullptr)
+		m_readers->fetch_sub(1U);
+}
+
+bool CUserDBView::isFound() const
+{
+	return m_offsets != nullptr;
+}
+
+std::string_view CUserDBView::getCallsign() const
+{
+	if (m_offsets == nullptr)
+		return m_callsign;
+
+	// CALLSIGN is the first column after RADIO_ID
+	return m_text + m_offsets[0U];
+}
+
+std::string_view CUserDBView::get(const std::string& key) const
+{
+	int index = CUserDBentry::getKeyIndex(key);
+	if (m_offsets == nullptr || index <= 0)
+		return "";
+
+	return m_text + m_offsets[index - 1];
+}
 
 CUserDB::CUserDB() :
-m_table(),
-m_mutex()
+m_table(new UserDBTable),
+m_epoch(0U),
+m_readers(),
+m_modified(0),
+m_length(0U)
 {
+	m_readers[0U] = 0U;
+	m_readers[1U] = 0U;
 }
 
 CUserDB::~CUserDB()
 {
+	delete m_table.load();
 }
 
-bool CUserDB::lookup(unsigned int id, class CUserDBentry *entry)
+CUserDBView CUserDB::find(unsigned int id)
 {
-	bool rv;
+	std::atomic<unsigned int>* readers = enter();
 
-	m_mutex.lock();
+	const UserDBTable* table = m_table.load();
 
-	try {
-		if (entry != nullptr)
-			*entry = m_table.at(id);
-		else
-			(void)m_table.at(id);
+	const unsigned int* end = table->m_ids + table->m_count;
 
-		rv = true;
-	} catch (...) {
-		rv = false;
+	const unsigned int* it = std::lower_bound(table->m_ids, end, id);
+	if (it == end || *it != id) {
+		readers->fetch_sub(1U);
+		return CUserDBView(id);
+	}
+
+	return CUserDBView(readers, table->m_text, table->m_offsets + (it - table->m_ids) * (USERDB_KEY_COUNT - 1U));
+}
+
+// Count a reader in the current epoch, before it takes the table
+std::atomic<unsigned int>* CUserDB::enter()
+{
+	std::atomic<unsigned int>* readers = &m_readers[m_epoch.load()];
+	readers->fetch_add(1U);
+
+	return readers;
+}
+
+// Any reader that could have the old table is counted in one of the epochs. New readers are
+// moved to the other epoch while the readers of each are waited for, after which nothing can
+// have the old table.
+void CUserDB::publish(UserDBTable* table)
+{
+	assert(table != nullptr);
+
+	const UserDBTable* old = m_table.exchange(table);
+
+	for (unsigned int i = 0U; i < 2U; i++) {
+		unsigned int epoch = m_epoch.fetch_xor(1U);
+
+		// The old table can't be freed early, but a view held for this long has been stored
+		// somewhere rather than used and dropped, which is a bug worth reporting
+		unsigned int waited = 0U;
+		while (m_readers[epoch].load() != 0U) {
+			CThread::sleep(1U);
+
+			if (++waited == USERDB_READER_WARNING)
+				LogWarning("The ID lookup table reload has waited over %ums for a lookup to finish", USERDB_READER_WARNING);
+		}
 	}
 
-	m_mutex.unlock();
+	delete old;
+}
+
+bool CUserDB::lookup(unsigned int id, class CUserDBentry *entry)
+{
+	CUserDBView view = find(id);
+	if (!view.isFound())
+		return false;
+
+	if (entry != nullptr) {
+		entry->clear();
+
+		for (unsigned int i = 1U; i < USERDB_KEY_COUNT; i++)
+			entry->setColumn(i, view.m_text + view.m_offsets[i - 1U]);
+	}
 
-	return rv;
+	return true;
 }
 
 bool CUserDB::load(std::string const& filename)
 {
 	LogInfo("Loading ID lookup table from %s", filename.c_str());
 
+	// Note the file as it is before reading it, so that a reload can tell whether it has changed since
+	time_t modified;
+	uint64_t length;
+	hasChanged(filename, modified, length);
+
+	std::unique_ptr<UserDBTable> table = read(filename);
+	if (table == nullptr)
+		return false;
+
+	m_modified = modified;
+	m_length   = length;
+
+	unsigned int size = table->m_count;
+
+	publish(table.release());
+
+	LogInfo("Loaded %u IDs to lookup table - %s", size, filename.c_str());
+
+	return true;
+}
+
+bool CUserDB::reload(std::string const& filename)
+{
+	time_t modified;
+	uint64_t length;
+	if (!hasChanged(filename, modified, length)) {
+		LogInfo("ID lookup file is unchanged, not reloading - %s", filename.c_str());
+		return true;
+	}
+
+	LogInfo("Reloading ID lookup table from %s", filename.c_str());
+
+	// The file is only noted once it has been read, so that a failed read is tried again next time
+	std::unique_ptr<UserDBTable> table = read(filename);
+	if (table == nullptr)
+		return false;
+
+	m_modified = modified;
+	m_length   = length;
+
+	// Only this thread can replace the table, so it can be used here without counting as a reader
+	const UserDBTable* current = m_table.load();
+
+	unsigned int added, removed, changed;
+	compare(*current, *table, added, removed, changed);
+
+	if (added == 0U && removed == 0U && changed == 0U) {
+		LogInfo("ID lookup file has no changed IDs, keeping the current table - %s", filename.c_str());
+		return true;
+	}
+
+	unsigned int size = table->m_count;
+
+	publish(table.release());
+
+	LogInfo("Loaded %u IDs to lookup table, %u added, %u removed, %u changed - %s", size, added, removed, changed, filename.c_str());
+
+	return true;
+}
+
+// A file is taken to have changed when its modification time or length has, which is also the
+// case when a new file has been renamed over it. The time and length found are returned for the
+// caller to note once the file has been read.
+bool CUserDB::hasChanged(std::string const& filename, time_t& modified, uint64_t& length) const
+{
+	modified = 0;
+	length   = 0U;
+
+	struct stat st;
+	if (::stat(filename.c_str(), &st) != 0)
+		return true;
+
+	modified = st.st_mtime;
+	length   = uint64_t(st.st_size);
+
+	return modified != m_modified || length != m_length;
+}
+
+// Count the IDs that only one table has, and those in both whose values differ, by walking both
+// lists of IDs in order
+void CUserDB::compare(const UserDBTable& table1, const UserDBTable& table2, unsigned int& added, unsigned int& removed, unsigned int& changed) const
+{
+	const unsigned int COLUMNS = USERDB_KEY_COUNT - 1U;
+
+	added   = 0U;
+	removed = 0U;
+	changed = 0U;
+
+	unsigned int i = 0U, j = 0U;
+	while (i < table1.m_count || j < table2.m_count) {
+		if (j == table2.m_count || (i < table1.m_count && table1.m_ids[i] < table2.m_ids[j])) {
+			removed++;
+			i++;
+		} else if (i == table1.m_count || table2.m_ids[j] < table1.m_ids[i]) {
+			added++;
+			j++;
+		} else {
+			const unsigned int* offsets1 = table1.m_offsets + size_t(i) * COLUMNS;
+			const unsigned int* offsets2 = table2.m_offsets + size_t(j) * COLUMNS;
+
+			for (unsigned int n = 0U; n < COLUMNS; n++) {
+				if (::strcmp(table1.m_text + offsets1[n], table2.m_text + offsets2[n]) != 0) {
+					changed++;
+					break;
+				}
+			}
+
+			i++;
+			j++;
+		}
+	}
+}
+
+std::unique_ptr<UserDBTable> CUserDB::read(std::string const& filename)
+{
 	FILE* fp = ::fopen(filename.c_str(), "rt");
 	if (fp == nullptr) {
 		LogWarning("Cannot open ID lookup file - %s", filename.c_str());
-		return false;
+		return nullptr;
 	}
 
-	m_mutex.lock();
+	// A binary file is used in place rather than parsed
+	char magic[8U];
+	if (::fread(magic, 1U, sizeof(magic), fp) == sizeof(magic) && ::memcmp(magic, USERDB_MAGIC, sizeof(magic)) == 0) {
+		::fclose(fp);
+		return readBinary(filename);
+	}
 
-	// Remove the old entries;
-	m_table.clear();
+	::rewind(fp);
 
 	// set index for entries
 	char buffer[256U];
 	if (::fgets(buffer, sizeof(buffer), fp) == nullptr) {
 		LogWarning("ID lookup file has no entry - %s", filename.c_str());
-		m_mutex.unlock();
 		::fclose(fp);
-		return false;
+		return nullptr;
 	}
 
 	// no index - set default
@@ -89,19 +378,187 @@ bool CUserDB::load(std::string const& filename)
 		::rewind(fp);
 	}
 
+	// The key of each column of the file, or -1 when it isn't one that we keep
+	std::vector<int> columns;
+	for (const auto& it : index) {
+		if (columns.size() <= (unsigned int)it.second)
+			columns.resize(it.second + 1U, -1);
+		columns[it.second] = CUserDBentry::getKeyIndex(it.first);
+	}
+
+	// The new entries are loaded into a table that nothing else can see yet
+	auto table = std::make_unique<UserDBTable>();
+
+	// Missing columns all point at the empty string at the start of the text
+	table->m_textStore.push_back('\0');
+
 	while (::fgets(buffer, sizeof(buffer), fp) != nullptr) {
 		if (buffer[0U] != '#')
-			parse(buffer, index);
+			parse(buffer, columns, *table);
 	}
 
 	::fclose(fp);
 
-	size_t size = m_table.size();
-	m_mutex.unlock();
+	sort(*table);
 
-	LogInfo("Loaded %u IDs to lookup table - %s", size, filename.c_str());
+	if (table->m_count == 0U) {
+		LogWarning("No IDs loaded, keeping the old lookup table - %s", filename.c_str());
+		return nullptr;
+	}
 
-	return size != 0U;
+	return table;
+}
+
+std::unique_ptr<UserDBTable> CUserDB::readBinary(std::string const& filename)
+{
+	auto table = std::make_unique<UserDBTable>();
+
+#if defined(_WIN32) || defined(_WIN64)
+	HANDLE file = ::CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		LogWarning("Cannot open ID lookup file - %s", filename.c_str());
+		return nullptr;
+	}
+
+	LARGE_INTEGER length;
+	HANDLE mapping = nullptr;
+	if (::GetFileSizeEx(file, &length) && length.QuadPart > 0)
+		mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0U, 0U, nullptr);
+
+	if (mapping != nullptr) {
+		table->m_map       = ::MapViewOfFile(mapping, FILE_MAP_READ, 0U, 0U, 0U);
+		table->m_mapLength = size_t(length.QuadPart);
+		::CloseHandle(mapping);
+	}
+
+	::CloseHandle(file);
+#else
+	int fd = ::open(filename.c_str(), O_RDONLY);
+	if (fd < 0) {
+		LogWarning("Cannot open ID lookup file - %s", filename.c_str());
+		return nullptr;
+	}
+
+	struct stat st;
+	if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+		void* map = ::mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+		if (map != MAP_FAILED) {
+			table->m_map       = map;
+			table->m_mapLength = size_t(st.st_size);
+		}
+	}
+
+	::close(fd);
+#endif
+
+	if (table->m_map == nullptr) {
+		LogWarning("Cannot map ID lookup file - %s", filename.c_str());
+		return nullptr;
+	}
+
+	const unsigned int COLUMNS = USERDB_KEY_COUNT - 1U;
+
+	const unsigned char* data = (const unsigned char*)table->m_map;
+	const UserDBHeader* header = (const UserDBHeader*)data;
+
+	if (table->m_mapLength < sizeof(UserDBHeader) || header->m_version != USERDB_VERSION || header->m_columns != COLUMNS) {
+		LogWarning("ID lookup file has the wrong version or byte order, keeping the old lookup table - %s", filename.c_str());
+		return nullptr;
+	}
+
+	uint64_t length = sizeof(UserDBHeader) + uint64_t(header->m_count) * (1U + COLUMNS) * sizeof(unsigned int) + header->m_textLength;
+	if (length != table->m_mapLength || length > 0xFFFFFFFFU || header->m_textLength == 0U ||
+	    CCRC::crc32(data + sizeof(UserDBHeader), (unsigned int)length - sizeof(UserDBHeader)) != header->m_checksum) {
+		LogWarning("ID lookup file is damaged, keeping the old lookup table - %s", filename.c_str());
+		return nullptr;
+	}
+
+	table->m_count      = header->m_count;
+	table->m_textLength = header->m_textLength;
+	table->m_ids        = (const unsigned int*)(data + sizeof(UserDBHeader));
+	table->m_offsets    = table->m_ids + table->m_count;
+	table->m_text       = (const char*)(table->m_offsets + size_t(table->m_count) * COLUMNS);
+
+	// A lookup must never read outside of the file, whatever wrote it
+	bool valid = table->m_text[0U] == '\0' && table->m_text[table->m_textLength - 1U] == '\0';
+
+	for (unsigned int i = 1U; valid && i < table->m_count; i++)
+		valid = table->m_ids[i - 1U] < table->m_ids[i];
+
+	for (size_t i = 0U; valid && i < size_t(table->m_count) * COLUMNS; i++)
+		valid = table->m_offsets[i] < table->m_textLength;
+
+	if (!valid) {
+		LogWarning("ID lookup file is damaged, keeping the old lookup table - %s", filename.c_str());
+		return nullptr;
+	}
+
+	if (table->m_count == 0U) {
+		LogWarning("No IDs loaded, keeping the old lookup table - %s", filename.c_str());
+		return nullptr;
+	}
+
+	return table;
+}
+
+bool CUserDB::save(std::string const& filename)
+{
+	const UserDBTable* table = m_table.load();
+
+	if (table->m_count == 0U) {
+		LogWarning("No IDs to write - %s", filename.c_str());
+		return false;
+	}
+
+	const unsigned int COLUMNS = USERDB_KEY_COUNT - 1U;
+
+	size_t idLength     = table->m_count * sizeof(unsigned int);
+	size_t offsetLength = table->m_count * COLUMNS * sizeof(unsigned int);
+
+	std::vector<unsigned char> body(idLength + offsetLength + table->m_textLength);
+	::memcpy(body.data(), table->m_ids, idLength);
+	::memcpy(body.data() + idLength, table->m_offsets, offsetLength);
+	::memcpy(body.data() + idLength + offsetLength, table->m_text, table->m_textLength);
+
+	UserDBHeader header;
+	::memset(&header, 0x00U, sizeof(UserDBHeader));
+	::memcpy(header.m_magic, USERDB_MAGIC, sizeof(header.m_magic));
+	header.m_version    = USERDB_VERSION;
+	header.m_columns    = COLUMNS;
+	header.m_count      = table->m_count;
+	header.m_textLength = table->m_textLength;
+	header.m_checksum   = CCRC::crc32(body.data(), (unsigned int)body.size());
+
+	std::string temp = filename + ".tmp";
+
+	FILE* fp = ::fopen(temp.c_str(), "wb");
+	if (fp == nullptr) {
+		LogError("Cannot create ID lookup file - %s", temp.c_str());
+		return false;
+	}
+
+	bool ok = ::fwrite(&header, sizeof(UserDBHeader), 1U, fp) == 1U && ::fwrite(body.data(), 1U, body.size(), fp) == body.size();
+	ok = (::fclose(fp) == 0) && ok;
+
+	if (!ok) {
+		LogError("Cannot write ID lookup file - %s", temp.c_str());
+		::remove(temp.c_str());
+		return false;
+	}
+
+	// The new file replaces the old one by name, so anything that has the old one mapped keeps it intact
+#if defined(_WIN32) || defined(_WIN64)
+	::remove(filename.c_str());
+#endif
+	if (::rename(temp.c_str(), filename.c_str()) != 0) {
+		LogError("Cannot replace ID lookup file - %s", filename.c_str());
+		::remove(temp.c_str());
+		return false;
+	}
+
+	LogInfo("Saved %u IDs to %s", table->m_count, filename.c_str());
+
+	return true;
 }
 
 bool CUserDB::makeindex(char* buf, std::unordered_map<std::string, int>& index)
@@ -129,42 +586,79 @@ bool CUserDB::makeindex(char* buf, std::unordered_map<std::string, int>& index)
 	}
 }
 
-void CUserDB::parse(char* buf, std::unordered_map<std::string, int>& index)
+void CUserDB::parse(char* buf, const std::vector<int>& columns, UserDBTable& table)
 {
 	int i;
 	char *p1, *p2;
-	std::unordered_map<std::string, char*> ptr;
-	unsigned int id;
+	char* values[USERDB_KEY_COUNT] = {nullptr};
 
 	for (i = 0, p1 = tokenize(buf, &p2); p1 != nullptr;
 	     i++, p1 = tokenize(p2, &p2)) {
-
-		for (auto it = index.begin(); it != index.end(); it++) {
-			// first: column keyword, second: column number
-			if (it->second == i) {
-				ptr[it->first] = p1;
-				break;
-			}
-		}
+		if ((unsigned int)i < columns.size() && columns[i] >= 0)
+			values[columns[i]] = p1;
 	}
 
-	try {
-		(void)ptr.at(keyRADIO_ID);
-		(void)ptr.at(keyCALLSIGN);
-	} catch (...) {
+	// RADIO_ID and CALLSIGN are the first two keys, and both are needed
+	if (values[0U] == nullptr || values[1U] == nullptr)
 		return;
-	}
 
-	id = (unsigned int)::atoi(ptr[keyRADIO_ID]);
-	toupper_string(ptr[keyCALLSIGN]);
+	table.m_idStore.push_back((unsigned int)::atoi(values[0U]));
+	toupper_string(values[1U]);
 
-	for (auto it = ptr.begin(); it != ptr.end(); it++) {
-		// no need to regist radio ID
-		if (it->first == keyRADIO_ID)
-			continue;
+	for (unsigned int n = 1U; n < USERDB_KEY_COUNT; n++) {
+		if (values[n] == nullptr || *values[n] == '\0') {
+			table.m_offsetStore.push_back(0U);
+		} else {
+			table.m_offsetStore.push_back((unsigned int)table.m_textStore.size());
+			table.m_textStore.insert(table.m_textStore.end(), values[n], values[n] + ::strlen(values[n]) + 1U);
+		}
+	}
+}
 
-		m_table[id].set(it->first, it->second);
+// Put the IDs in order for searching and point the table at them. Where an ID appears more than
+// once its entries are merged, each column taking the value from the last entry that has one
+void CUserDB::sort(UserDBTable& table)
+{
+	const unsigned int COLUMNS = USERDB_KEY_COUNT - 1U;
+
+	// The rows are sorted as (ID << 32 | row) keys, so that the rows of a duplicate ID stay in the
+	// order of the file without an indirect stable sort
+	std::vector<uint64_t> order(table.m_idStore.size());
+	for (unsigned int i = 0U; i < order.size(); i++)
+		order[i] = (uint64_t(table.m_idStore[i]) << 32) | i;
+
+	std::sort(order.begin(), order.end());
+
+	std::vector<unsigned int> ids;
+	std::vector<unsigned int> offsets;
+	ids.reserve(order.size());
+	offsets.reserve(order.size() * COLUMNS);
+
+	for (uint64_t key : order) {
+		unsigned int row = (unsigned int)(key & 0xFFFFFFFFU);
+		const unsigned int* columns = table.m_offsetStore.data() + row * COLUMNS;
+
+		if (!ids.empty() && ids.back() == table.m_idStore[row]) {
+			unsigned int* merged = offsets.data() + offsets.size() - COLUMNS;
+			for (unsigned int n = 0U; n < COLUMNS; n++) {
+				if (columns[n] != 0U)
+					merged[n] = columns[n];
+			}
+		} else {
+			ids.push_back(table.m_idStore[row]);
+			offsets.insert(offsets.end(), columns, columns + COLUMNS);
+		}
 	}
+
+	table.m_idStore.swap(ids);
+	table.m_offsetStore.swap(offsets);
+	table.m_textStore.shrink_to_fit();
+
+	table.m_count      = (unsigned int)table.m_idStore.size();
+	table.m_textLength = (unsigned int)table.m_textStore.size();
+	table.m_ids        = table.m_idStore.data();
+	table.m_offsets    = table.m_offsetStore.data();
+	table.m_text       = table.m_textStore.data();
 }
 
 void CUserDB::toupper_string(char* str)
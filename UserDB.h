@@ -21,27 +21,141 @@
 #define USERDB_H
 
 #include "UserDBentry.h"
-#include "Mutex.h"
 #include "Defines.h"
 
 #if defined(USE_DMR) || defined(USE_P25) || defined(USE_NXDN)
 
+#include <atomic>
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+/*
+ * The IDs in order, each with the offset of its columns after RADIO_ID in one block of text.
+ * The arrays are held in the vectors when built from a text file, or are read in place from a
+ * binary file that is mapped into memory until the table is freed.
+ */
+struct UserDBTable {
+	UserDBTable();
+	~UserDBTable();
+
+	UserDBTable(const UserDBTable&) = delete;
+	UserDBTable& operator=(const UserDBTable&) = delete;
+
+	unsigned int        m_count;
+	unsigned int        m_textLength;
+	const unsigned int* m_ids;
+	const unsigned int* m_offsets;
+	const char*         m_text;
+
+	std::vector<unsigned int> m_idStore;
+	std::vector<unsigned int> m_offsetStore;
+	std::vector<char>         m_textStore;
+
+	void*  m_map;
+	size_t m_mapLength;
+};
+
+/*
+ * The binary ID file written by UserDBConvert, in the byte order of the host. The header is
+ * followed by the IDs, their column offsets and the text, exactly as they are in a table, with
+ * a CRC-32 of everything after the header. A file is only ever replaced by renaming a new one
+ * over it, never rewritten in place, as it may be mapped by a running MMDVMHost.
+ */
+const char         USERDB_MAGIC[]  = "MMDVMIDB";
+const unsigned int USERDB_VERSION  = 1U;
+
+struct UserDBHeader {
+	char         m_magic[8U];
+	unsigned int m_version;
+	unsigned int m_columns;
+	unsigned int m_count;
+	unsigned int m_textLength;
+	unsigned int m_checksum;
+	unsigned int m_reserved;
+};
+
+/*
+ * The result of a lookup, which refers to the values in the table rather than copying them. A
+ * reload can't free the table while a view of it exists, and waits for every view to go, so a
+ * view must be a local that is only held while one event is handled. It must never be kept in
+ * a member or anywhere else that outlives the event, as that would stop all reloads. Copy the
+ * values into a std::string to keep them. Every value ends with a NUL, so its data() can be
+ * given to printf.
+ */
+class CUserDBView {
+public:
+	explicit CUserDBView(const char* callsign);
+	CUserDBView(CUserDBView&& view);
+	~CUserDBView();
+
+	CUserDBView(const CUserDBView&) = delete;
+	CUserDBView& operator=(const CUserDBView&) = delete;
+	CUserDBView& operator=(CUserDBView&&) = delete;
+
+	bool isFound() const;
+
+	// The callsign, or the ID itself when it isn't in the table. The ID is held in the view,
+	// so in that case the result is only valid until the view is moved or destroyed
+	std::string_view getCallsign() const;
+
+	std::string_view get(const std::string& key) const;
+
+private:
+	friend class CUserDB;
+
+	explicit CUserDBView(unsigned int id);
+	CUserDBView(std::atomic<unsigned int>* readers, const char* text, const unsigned int* offsets);
+
+	std::atomic<unsigned int>* m_readers;
+	const char*                m_text;
+	const unsigned int*        m_offsets;
+	char                       m_callsign[12U];
+};
+
+/*
+ * A reload builds a new table without any lock held and then swaps it in atomically. Lookups
+ * never lock nor wait: each counts itself as a reader in the current epoch before it takes the
+ * table, and a reload waits for the readers of both epochs in turn to finish before it frees
+ * the table that it replaced. Only one thread at a time may load, reload or save the table.
+ */
 class CUserDB {
 public:
 	CUserDB();
 	~CUserDB();
 
+	CUserDBView find(unsigned int id);
+
 	bool lookup(unsigned int id, class CUserDBentry *entry);
 	bool load(std::string const& filename);
 
+	// Load the file again only if it has changed since it was last loaded, and then only replace
+	// the table if any of the IDs have changed
+	bool reload(std::string const& filename);
+
+	// Write the table as a binary ID file
+	bool save(std::string const& filename);
+
 private:
+	std::unique_ptr<UserDBTable> read(std::string const& filename);
+	std::unique_ptr<UserDBTable> readBinary(std::string const& filename);
+	std::atomic<unsigned int>* enter();
+	void publish(UserDBTable* table);
+	bool hasChanged(std::string const& filename, time_t& modified, uint64_t& length) const;
+	void compare(const UserDBTable& table1, const UserDBTable& table2, unsigned int& added, unsigned int& removed, unsigned int& changed) const;
 	bool makeindex(char* buf, std::unordered_map<std::string, int>& index);
-	void parse(char* buf, std::unordered_map<std::string, int>& index);
+	void parse(char* buf, const std::vector<int>& columns, UserDBTable& table);
+	void sort(UserDBTable& table);
 	void toupper_string(char* str);
 	char* tokenize(char* str, char** next);
 
-	std::unordered_map<unsigned int, class CUserDBentry>    m_table;
-	CMutex                                                  m_mutex;
+	std::atomic<const UserDBTable*> m_table;
+	std::atomic<unsigned int>       m_epoch;
+	std::atomic<unsigned int>       m_readers[2U];
+	time_t                          m_modified;
+	uint64_t                        m_length;
 };
 	
 #endif
@@ -0,0 +1,50 @@
+/*
+ *   Copyright (C) 2025 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/*
+ * Converts a DMR or NXDN ID file from the text format into the binary format, which MMDVMHost
+ * uses in place without parsing it. The output is written to a temporary file and renamed over
+ * the old one, so it can be run against the file that a running MMDVMHost is using. Set the
+ * File setting of the lookup section in MMDVMHost.ini to the binary file to use it. A binary
+ * file can also be given as the input, which checks it and writes it again.
+ *
+ * Usage: UserDBConvert <text file> <binary file>
+ */
+
+#include "UserDB.h"
+#include "Log.h"
+
+#include <cstdio>
+
+int main(int argc, char** argv)
+{
+	if (argc != 3) {
+		::fprintf(stderr, "Usage: UserDBConvert <text file> <binary file>\n");
+		return 1;
+	}
+
+	CUserDB table;
+
+	if (!table.load(argv[1]))
+		return 1;
+
+	if (!table.save(argv[2]))
+		return 1;
+
+	return 0;
+}
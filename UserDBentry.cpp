@@ -21,9 +21,10 @@
 #if defined(USE_DMR) || defined(USE_P25) || defined(USE_NXDN)
 
 #include <algorithm>
+#include <cassert>
 
 CUserDBentry::CUserDBentry() :
-m_db()
+m_values()
 {
 }
 
@@ -37,30 +38,47 @@ const std::vector<std::string> CUserDBentry::keyList {
 };
 
 bool CUserDBentry::isValidKey(const std::string key)
+{
+	return getKeyIndex(key) >= 0;
+}
+
+int CUserDBentry::getKeyIndex(const std::string& key)
 {
 	auto it = std::find(keyList.begin(), keyList.end(), key);
-	return it != keyList.end();
+	if (it == keyList.end())
+		return -1;
+
+	return int(it - keyList.begin());
 }
 
 void CUserDBentry::set(const std::string key, const std::string value)
 {
-	if (!value.empty() && isValidKey(key))
-		m_db[key] = value;
+	int index = getKeyIndex(key);
+	if (!value.empty() && index >= 0)
+		m_values[index] = value;
 }
 
 const std::string CUserDBentry::get(const std::string key) const
 {
-	try {
-		return m_db.at(key);
-	} catch (...) {
+	int index = getKeyIndex(key);
+	if (index < 0)
 		return "";
-	}
+
+	return m_values[index];
 }
 
 void CUserDBentry::clear(void)
 {
-	m_db.clear();
+	for (unsigned int i = 0U; i < USERDB_KEY_COUNT; i++)
+		m_values[i].clear();
 }
 
-#endif
+void CUserDBentry::setColumn(unsigned int index, const char* value)
+{
+	assert(index < USERDB_KEY_COUNT);
+	assert(value != nullptr);
 
+	m_values[index] = value;
+}
+
+#endif
@@ -36,6 +36,9 @@
 #define keySTATE	"STATE"
 #define keyCOUNTRY	"COUNTRY"
 
+// The number of keys in keyList, RADIO_ID first
+const unsigned int USERDB_KEY_COUNT = 7U;
+
 class CUserDBentry {
 public:
 	CUserDBentry();
@@ -43,13 +46,17 @@ public:
 
 	static const std::vector<std::string> keyList;
 	static bool isValidKey(const std::string key);
+	static int getKeyIndex(const std::string& key);
 
 	void set(const std::string key, const std::string value);
 	const std::string get(const std::string key) const;
 	void clear(void);
 
+	// Set a value by its position in keyList, as the ID database does
+	void setColumn(unsigned int index, const char* value);
+
 private:
-	std::unordered_map<std::string, std::string>    m_db;
+	std::string     m_values[USERDB_KEY_COUNT];
 };
 
 #endif
@@ -152,16 +152,19 @@ void CUtils::bitsToByteLE(const bool* bits, unsigned char& byte)
 	byte |= bits[7U] ? 0x80U : 0x00U;
 }
 
+// The popcount builtin is only one instruction when the compiler is allowed to use it, on x86
+// with -mpopcnt or a -march that has it, otherwise it is a library call slower than the sum
 unsigned int CUtils::countBits(unsigned int v)
 {
-	unsigned int count = 0U;
-
-	while (v != 0U) {
-		v &= v - 1U;
-		count++;
-	}
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__POPCNT__) || defined(__aarch64__))
+	return (unsigned int)__builtin_popcount(v);
+#else
+	v = v - ((v >> 1) & 0x55555555U);
+	v = (v & 0x33333333U) + ((v >> 2) & 0x33333333U);
+	v = (v + (v >> 4)) & 0x0F0F0F0FU;
 
-	return count;
+	return (v * 0x01010101U) >> 24;
+#endif
 }
 
 void CUtils::removeChar(unsigned char * haystack, char needdle)
@@ -0,0 +1,231 @@
+/*
+ *   Copyright (C) 2025 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "ViterbiACS.h"
+#include "CPUFeatures.h"
+#include "Log.h"
+
+#if defined(USE_YSF) || defined(USE_NXDN)
+
+#include <cstdio>
+#include <cassert>
+#include <cstring>
+#include <cstdlib>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+const unsigned int NUM_OF_STATES_D2 = 8U;
+
+typedef void (*ACS_FUNCTION)(uint16_t* metrics, uint16_t* decisions, const uint8_t* symbols, unsigned int count,
+			     const uint16_t* branch1, const uint16_t* branch2, uint16_t max);
+
+#if defined(__SSE2__)
+
+// The metrics stay well below 32768, so the signed comparisons are safe
+static void decode16SSE2(uint16_t* metrics, uint16_t* decisions, const uint8_t* symbols, unsigned int count,
+			 const uint16_t* branch1, const uint16_t* branch2, uint16_t max)
+{
+	assert(metrics != nullptr);
+	assert(decisions != nullptr);
+	assert(symbols != nullptr);
+	assert(branch1 != nullptr);
+	assert(branch2 != nullptr);
+
+	__m128i old0 = _mm_loadu_si128((const __m128i*)(metrics + 0U));
+	__m128i old1 = _mm_loadu_si128((const __m128i*)(metrics + NUM_OF_STATES_D2));
+
+	const __m128i b1 = _mm_loadu_si128((const __m128i*)branch1);
+	const __m128i b2 = _mm_loadu_si128((const __m128i*)branch2);
+	const __m128i m  = _mm_set1_epi16(max);
+
+	for (unsigned int n = 0U; n < count; n++) {
+		const __m128i s0 = _mm_set1_epi16(*symbols++);
+		const __m128i s1 = _mm_set1_epi16(*symbols++);
+
+		// The absolute differences from the expected values
+		__m128i metric = _mm_add_epi16(_mm_sub_epi16(_mm_max_epi16(b1, s0), _mm_min_epi16(b1, s0)),
+					       _mm_sub_epi16(_mm_max_epi16(b2, s1), _mm_min_epi16(b2, s1)));
+		__m128i inverse = _mm_sub_epi16(m, metric);
+
+		__m128i even0 = _mm_add_epi16(old0, metric);
+		__m128i even1 = _mm_add_epi16(old1, inverse);
+		__m128i odd0  = _mm_add_epi16(old0, inverse);
+		__m128i odd1  = _mm_add_epi16(old1, metric);
+
+		__m128i even = _mm_min_epi16(even0, even1);
+		__m128i odd  = _mm_min_epi16(odd0, odd1);
+
+		// Set where the lower old state is kept
+		__m128i evenLower = _mm_cmpgt_epi16(even1, even0);
+		__m128i oddLower  = _mm_cmpgt_epi16(odd1, odd0);
+
+		old0 = _mm_unpacklo_epi16(even, odd);
+		old1 = _mm_unpackhi_epi16(even, odd);
+
+		__m128i lower = _mm_packs_epi16(_mm_unpacklo_epi16(evenLower, oddLower), _mm_unpackhi_epi16(evenLower, oddLower));
+		*decisions++ = uint16_t(_mm_movemask_epi8(lower) ^ 0xFFFF);
+	}
+
+	_mm_storeu_si128((__m128i*)(metrics + 0U), old0);
+	_mm_storeu_si128((__m128i*)(metrics + NUM_OF_STATES_D2), old1);
+}
+
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+const uint16_t DECISION_WEIGHTS[] = {0x01U, 0x02U, 0x04U, 0x08U, 0x10U, 0x20U, 0x40U, 0x80U};
+
+static inline uint16_t collectBits(uint16x8_t v)
+{
+	uint64x2_t sum = vpaddlq_u32(vpaddlq_u16(vandq_u16(v, vld1q_u16(DECISION_WEIGHTS))));
+
+	return uint16_t(vgetq_lane_u64(sum, 0) + vgetq_lane_u64(sum, 1));
+}
+
+static void decode16NEON(uint16_t* metrics, uint16_t* decisions, const uint8_t* symbols, unsigned int count,
+			 const uint16_t* branch1, const uint16_t* branch2, uint16_t max)
+{
+	assert(metrics != nullptr);
+	assert(decisions != nullptr);
+	assert(symbols != nullptr);
+	assert(branch1 != nullptr);
+	assert(branch2 != nullptr);
+
+	uint16x8_t old0 = vld1q_u16(metrics + 0U);
+	uint16x8_t old1 = vld1q_u16(metrics + NUM_OF_STATES_D2);
+
+	const uint16x8_t b1 = vld1q_u16(branch1);
+	const uint16x8_t b2 = vld1q_u16(branch2);
+	const uint16x8_t m  = vdupq_n_u16(max);
+
+	for (unsigned int n = 0U; n < count; n++) {
+		const uint16x8_t s0 = vdupq_n_u16(*symbols++);
+		const uint16x8_t s1 = vdupq_n_u16(*symbols++);
+
+		uint16x8_t metric  = vaddq_u16(vabdq_u16(b1, s0), vabdq_u16(b2, s1));
+		uint16x8_t inverse = vsubq_u16(m, metric);
+
+		uint16x8_t even0 = vaddq_u16(old0, metric);
+		uint16x8_t even1 = vaddq_u16(old1, inverse);
+		uint16x8_t odd0  = vaddq_u16(old0, inverse);
+		uint16x8_t odd1  = vaddq_u16(old1, metric);
+
+		uint16x8x2_t next = vzipq_u16(vminq_u16(even0, even1), vminq_u16(odd0, odd1));
+		old0 = next.val[0];
+		old1 = next.val[1];
+
+		// Set where the upper old state is kept
+		uint16x8x2_t upper = vzipq_u16(vcgeq_u16(even0, even1), vcgeq_u16(odd0, odd1));
+		*decisions++ = collectBits(upper.val[0]) | (collectBits(upper.val[1]) << 8);
+	}
+
+	vst1q_u16(metrics + 0U, old0);
+	vst1q_u16(metrics + NUM_OF_STATES_D2, old1);
+}
+
+#endif
+
+static void decode16Scalar(uint16_t* metrics, uint16_t* decisions, const uint8_t* symbols, unsigned int count,
+			   const uint16_t* branch1, const uint16_t* branch2, uint16_t max)
+{
+	assert(metrics != nullptr);
+	assert(decisions != nullptr);
+	assert(symbols != nullptr);
+	assert(branch1 != nullptr);
+	assert(branch2 != nullptr);
+
+	uint16_t buffer1[2U * NUM_OF_STATES_D2];
+	uint16_t buffer2[2U * NUM_OF_STATES_D2];
+	::memcpy(buffer1, metrics, sizeof(buffer1));
+
+	uint16_t* oldMetrics = buffer1;
+	uint16_t* newMetrics = buffer2;
+
+	for (unsigned int n = 0U; n < count; n++) {
+		int s0 = *symbols++;
+		int s1 = *symbols++;
+
+		uint16_t decision = 0U;
+
+		for (unsigned int i = 0U; i < NUM_OF_STATES_D2; i++) {
+			unsigned int j = i * 2U;
+
+			uint16_t metric = std::abs(branch1[i] - s0) + std::abs(branch2[i] - s1);
+
+			uint16_t m0 = oldMetrics[i] + metric;
+			uint16_t m1 = oldMetrics[i + NUM_OF_STATES_D2] + (max - metric);
+			uint16_t decision0 = (m0 >= m1) ? 1U : 0U;
+			newMetrics[j + 0U] = decision0 != 0U ? m1 : m0;
+
+			m0 = oldMetrics[i] + (max - metric);
+			m1 = oldMetrics[i + NUM_OF_STATES_D2] + metric;
+			uint16_t decision1 = (m0 >= m1) ? 1U : 0U;
+			newMetrics[j + 1U] = decision1 != 0U ? m1 : m0;
+
+			decision |= (decision1 << (j + 1U)) | (decision0 << (j + 0U));
+		}
+
+		*decisions++ = decision;
+
+		uint16_t* tmp = oldMetrics;
+		oldMetrics = newMetrics;
+		newMetrics = tmp;
+	}
+
+	::memcpy(metrics, oldMetrics, sizeof(buffer1));
+}
+
+// Until init() is called, use whichever version the compiler's baseline allows
+#if defined(__SSE2__)
+static ACS_FUNCTION acsFunction = decode16SSE2;
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+static ACS_FUNCTION acsFunction = decode16NEON;
+#else
+static ACS_FUNCTION acsFunction = decode16Scalar;
+#endif
+
+void CViterbiACS::init()
+{
+#if defined(__SSE2__)
+	if (CCPUFeatures::has(CPUF_SSE2)) {
+		acsFunction = decode16SSE2;
+		LogInfo("    Viterbi ACS: SSE2");
+		return;
+	}
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	if (CCPUFeatures::has(CPUF_NEON)) {
+		acsFunction = decode16NEON;
+		LogInfo("    Viterbi ACS: NEON");
+		return;
+	}
+#endif
+
+	acsFunction = decode16Scalar;
+	LogInfo("    Viterbi ACS: portable");
+}
+
+void CViterbiACS::decode16(uint16_t* metrics, uint16_t* decisions, const uint8_t* symbols, unsigned int count,
+			   const uint16_t* branch1, const uint16_t* branch2, uint16_t max)
+{
+	acsFunction(metrics, decisions, symbols, count, branch1, branch2, max);
+}
+
+#endif
@@ -0,0 +1,47 @@
+/*
+ *   Copyright (C) 2025 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(ViterbiACS_H)
+#define	ViterbiACS_H
+
+#include "Defines.h"
+
+#if defined(USE_YSF) || defined(USE_NXDN)
+
+#include <cstdint>
+
+/*
+ * The add-compare-select step of the sixteen state, rate 1/2, K=5 Viterbi decoders used by
+ * YSF and NXDN. The eight butterflies are run at once with SSE2 on x86 and NEON on ARM.
+ * Each symbol pair gives one word of decisions, bit n set if state n came from the upper
+ * half of the old states.
+ */
+class CViterbiACS {
+public:
+	// Choose the fastest version that the CPU supports, after CCPUFeatures::init()
+	static void init();
+
+	// The symbols are count pairs of received values, the branch tables give the expected
+	// values for each butterfly and max is the largest branch metric.
+	static void decode16(uint16_t* metrics, uint16_t* decisions, const uint8_t* symbols, unsigned int count,
+			     const uint16_t* branch1, const uint16_t* branch2, uint16_t max);
+};
+
+#endif
+
+#endif
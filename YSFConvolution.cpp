@@ -17,6 +17,7 @@
  */
 
 #include "YSFConvolution.h"
+#include "ViterbiACS.h"
 
 #if defined(USE_YSF)
 
@@ -29,73 +30,50 @@ const unsigned char BIT_MASK_TABLE[] = {0x80U, 0x40U, 0x20U, 0x10U, 0x08U, 0x04U
 #define WRITE_BIT1(p,i,b) p[(i)>>3] = (b) ? (p[(i)>>3] | BIT_MASK_TABLE[(i)&7]) : (p[(i)>>3] & ~BIT_MASK_TABLE[(i)&7])
 #define READ_BIT1(p,i)    (p[(i)>>3] & BIT_MASK_TABLE[(i)&7])
 
-const uint8_t BRANCH_TABLE1[] = {0U, 0U, 0U, 0U, 1U, 1U, 1U, 1U};
-const uint8_t BRANCH_TABLE2[] = {0U, 1U, 1U, 0U, 0U, 1U, 1U, 0U};
+const uint16_t BRANCH_TABLE1[] = {0U, 0U, 0U, 0U, 1U, 1U, 1U, 1U};
+const uint16_t BRANCH_TABLE2[] = {0U, 1U, 1U, 0U, 0U, 1U, 1U, 0U};
 
-const unsigned int NUM_OF_STATES_D2 = 8U;
 const unsigned int NUM_OF_STATES = 16U;
 const uint32_t     M = 2U;
 const unsigned int K = 5U;
 
 CYSFConvolution::CYSFConvolution() :
-m_metrics1(nullptr),
-m_metrics2(nullptr),
-m_oldMetrics(nullptr),
-m_newMetrics(nullptr),
+m_metrics(nullptr),
 m_decisions(nullptr),
 m_dp(nullptr)
 {
-	m_metrics1  = new uint16_t[20U];
-	m_metrics2  = new uint16_t[20U];
-	m_decisions = new uint64_t[180U];
+	m_metrics   = new uint16_t[NUM_OF_STATES];
+	m_decisions = new uint16_t[180U];
 }
 
 CYSFConvolution::~CYSFConvolution()
 {
-	delete[] m_metrics1;
-	delete[] m_metrics2;
+	delete[] m_metrics;
 	delete[] m_decisions;
 }
 
 void CYSFConvolution::start()
 {
-	::memset(m_metrics1, 0x00U, NUM_OF_STATES * sizeof(uint16_t));
-	::memset(m_metrics2, 0x00U, NUM_OF_STATES * sizeof(uint16_t));
+	::memset(m_metrics, 0x00U, NUM_OF_STATES * sizeof(uint16_t));
 
-	m_oldMetrics = m_metrics1;
-	m_newMetrics = m_metrics2;
 	m_dp = m_decisions;
 }
 
 void CYSFConvolution::decode(uint8_t s0, uint8_t s1)
 {
-  *m_dp = 0U;
+	uint8_t symbols[2U] = {s0, s1};
 
-  for (uint8_t i = 0U; i < NUM_OF_STATES_D2; i++) {
-    uint8_t j = i * 2U;
-
-    uint16_t metric = (BRANCH_TABLE1[i] ^ s0) + (BRANCH_TABLE2[i] ^ s1);
-
-    uint16_t m0 = m_oldMetrics[i] + metric;
-    uint16_t m1 = m_oldMetrics[i + NUM_OF_STATES_D2] + (M - metric);
-    uint8_t decision0 = (m0 >= m1) ? 1U : 0U;
-    m_newMetrics[j + 0U] = decision0 != 0U ? m1 : m0;
-
-    m0 = m_oldMetrics[i] + (M - metric);
-    m1 = m_oldMetrics[i + NUM_OF_STATES_D2] + metric;
-    uint8_t decision1 = (m0 >= m1) ? 1U : 0U;
-    m_newMetrics[j + 1U] = decision1 != 0U ? m1 : m0;
-
-    *m_dp |= (uint64_t(decision1) << (j + 1U)) | (uint64_t(decision0) << (j + 0U));
-  }
+	decode(symbols, 1U);
+}
 
-  ++m_dp;
+void CYSFConvolution::decode(const uint8_t* symbols, unsigned int count)
+{
+	assert(symbols != nullptr);
+	assert(((m_dp - m_decisions) + count) <= 180);
 
-  assert((m_dp - m_decisions) <= 180);
+	CViterbiACS::decode16(m_metrics, m_dp, symbols, count, BRANCH_TABLE1, BRANCH_TABLE2, M);
 
-  uint16_t* tmp = m_oldMetrics;
-  m_oldMetrics = m_newMetrics;
-  m_newMetrics = tmp;
+	m_dp += count;
 }
 
 unsigned int CYSFConvolution::chainback(unsigned char* out, unsigned int nBits)
@@ -114,11 +92,11 @@ unsigned int CYSFConvolution::chainback(unsigned char* out, unsigned int nBits)
 		WRITE_BIT1(out, nBits, bit != 0U);
 	}
 
-	unsigned int minCost = m_oldMetrics[0];
+	unsigned int minCost = m_metrics[0];
 
 	for (unsigned int i = 0U; i < NUM_OF_STATES; i++) {
-		if (m_oldMetrics[i] < minCost)
-			minCost = m_oldMetrics[i];
+		if (m_metrics[i] < minCost)
+			minCost = m_metrics[i];
 	}
 
 	return minCost / (M >> 1);
@@ -32,18 +32,16 @@ public:
 
 	void start();
 	void decode(uint8_t s0, uint8_t s1);
+	void decode(const uint8_t* symbols, unsigned int count);
 
 	unsigned int chainback(unsigned char* out, unsigned int nBits);
 
 	void encode(const unsigned char* in, unsigned char* out, unsigned int nBits) const;
 
 private:
-	uint16_t* m_metrics1;
-	uint16_t* m_metrics2;
-	uint16_t* m_oldMetrics;
-	uint16_t* m_newMetrics;
-	uint64_t* m_decisions;
-	uint64_t* m_dp;
+	uint16_t* m_metrics;
+	uint16_t* m_decisions;
+	uint16_t* m_dp;
 };
 
 #endif
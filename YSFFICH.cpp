@@ -88,16 +88,17 @@ bool CYSFFICH::decode(const unsigned char* bytes)
 	viterbi.start();
 
 	// Deinterleave the FICH and send bits to the Viterbi decoder
+	uint8_t symbols[200U];
 	for (unsigned int i = 0U; i < 100U; i++) {
 		unsigned int n = INTERLEAVE_TABLE[i];
-		uint8_t s0 = READ_BIT1(bytes, n) ? 1U : 0U;
+		symbols[i * 2U + 0U] = READ_BIT1(bytes, n) ? 1U : 0U;
 
 		n++;
-		uint8_t s1 = READ_BIT1(bytes, n) ? 1U : 0U;
-
-		viterbi.decode(s0, s1);
+		symbols[i * 2U + 1U] = READ_BIT1(bytes, n) ? 1U : 0U;
 	}
 
+	viterbi.decode(symbols, 100U);
+
 	unsigned char output[13U];
 	viterbi.chainback(output, 96U);
 
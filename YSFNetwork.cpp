@@ -55,6 +55,11 @@ CYSFNetwork::~CYSFNetwork()
 	delete[] m_tag;
 }
 
+void CYSFNetwork::setSocketOptions(unsigned int rxBufferSize, unsigned int txBufferSize, int dscp, int keepAliveDSCP, int priority)
+{
+	m_socket.setOptions(rxBufferSize, txBufferSize, dscp, keepAliveDSCP, priority);
+}
+
 bool CYSFNetwork::open()
 {
 	if (m_addrLen == 0U) {
@@ -119,7 +124,7 @@ bool CYSFNetwork::writePoll()
 	if (m_debug)
 		CUtils::dump(1U, "YSF Network Poll Sent", buffer, 14U);
 
-	return m_socket.write(buffer, 14U, m_addr, m_addrLen);
+	return m_socket.writeKeepAlive(buffer, 14U, m_addr, m_addrLen);
 }
 
 void CYSFNetwork::clock(unsigned int ms)
@@ -120,16 +120,17 @@ bool CYSFPayload::processHeaderData(unsigned char* data)
 	CYSFConvolution conv;
 	conv.start();
 
+	uint8_t symbols[360U];
 	for (unsigned int i = 0U; i < 180U; i++) {
 		unsigned int n = INTERLEAVE_TABLE_9_20[i];
-		uint8_t s0 = READ_BIT1(dch, n) ? 1U : 0U;
+		symbols[i * 2U + 0U] = READ_BIT1(dch, n) ? 1U : 0U;
 
 		n++;
-		uint8_t s1 = READ_BIT1(dch, n) ? 1U : 0U;
-
-		conv.decode(s0, s1);
+		symbols[i * 2U + 1U] = READ_BIT1(dch, n) ? 1U : 0U;
 	}
 
+	conv.decode(symbols, 180U);
+
 	unsigned char output[23U];
 	conv.chainback(output, 176U);
 
@@ -193,14 +194,14 @@ bool CYSFPayload::processHeaderData(unsigned char* data)
 
 	for (unsigned int i = 0U; i < 180U; i++) {
 		unsigned int n = INTERLEAVE_TABLE_9_20[i];
-		uint8_t s0 = READ_BIT1(dch, n) ? 1U : 0U;
+		symbols[i * 2U + 0U] = READ_BIT1(dch, n) ? 1U : 0U;
 
 		n++;
-		uint8_t s1 = READ_BIT1(dch, n) ? 1U : 0U;
-
-		conv.decode(s0, s1);
+		symbols[i * 2U + 1U] = READ_BIT1(dch, n) ? 1U : 0U;
 	}
 
+	conv.decode(symbols, 180U);
+
 	conv.chainback(output, 176U);
 
 	bool valid2 = CCRC::checkCCITT162(output, 22U);
@@ -257,15 +258,8 @@ unsigned int CYSFPayload::processVDMode1Audio(unsigned char* data)
 
 	data += YSF_SYNC_LENGTH_BYTES + YSF_FICH_LENGTH_BYTES;
 
-	// Regenerate the AMBE FEC
-	unsigned int errors = 0U;
-	errors += m_fec.regenerateYSFDN(data + 9U);
-	errors += m_fec.regenerateYSFDN(data + 27U);
-	errors += m_fec.regenerateYSFDN(data + 45U);
-	errors += m_fec.regenerateYSFDN(data + 63U);
-	errors += m_fec.regenerateYSFDN(data + 81U);
-
-	return errors;
+	// Regenerate the AMBE FEC of the five frames, which lie between the DCH sections
+	return m_fec.regenerateYSFDN(data + 9U, 5U, 18U);
 }
 
 bool CYSFPayload::processVDMode1Data(unsigned char* data, unsigned char fn, bool gateway)
@@ -286,16 +280,17 @@ bool CYSFPayload::processVDMode1Data(unsigned char* data, unsigned char fn, bool
 	CYSFConvolution conv;
 	conv.start();
 
+	uint8_t symbols[360U];
 	for (unsigned int i = 0U; i < 180U; i++) {
 		unsigned int n = INTERLEAVE_TABLE_9_20[i];
-		uint8_t s0 = READ_BIT1(dch, n) ? 1U : 0U;
+		symbols[i * 2U + 0U] = READ_BIT1(dch, n) ? 1U : 0U;
 
 		n++;
-		uint8_t s1 = READ_BIT1(dch, n) ? 1U : 0U;
-
-		conv.decode(s0, s1);
+		symbols[i * 2U + 1U] = READ_BIT1(dch, n) ? 1U : 0U;
 	}
 
+	conv.decode(symbols, 180U);
+
 	unsigned char output[23U];
 	conv.chainback(output, 176U);
 
@@ -484,16 +479,17 @@ bool CYSFPayload::processVDMode2Data(unsigned char* data, unsigned char fn, bool
 	CYSFConvolution conv;
 	conv.start();
 
+	uint8_t symbols[200U];
 	for (unsigned int i = 0U; i < 100U; i++) {
 		unsigned int n = INTERLEAVE_TABLE_5_20[i];
-		uint8_t s0 = READ_BIT1(dch, n) ? 1U : 0U;
+		symbols[i * 2U + 0U] = READ_BIT1(dch, n) ? 1U : 0U;
 
 		n++;
-		uint8_t s1 = READ_BIT1(dch, n) ? 1U : 0U;
-
-		conv.decode(s0, s1);
+		symbols[i * 2U + 1U] = READ_BIT1(dch, n) ? 1U : 0U;
 	}
 
+	conv.decode(symbols, 100U);
+
 	unsigned char output[13U];
 	conv.chainback(output, 96U);
 
@@ -594,16 +590,17 @@ bool CYSFPayload::processDataFRModeData(unsigned char* data, unsigned char fn, b
 	CYSFConvolution conv;
 	conv.start();
 
+	uint8_t symbols[360U];
 	for (unsigned int i = 0U; i < 180U; i++) {
 		unsigned int n = INTERLEAVE_TABLE_9_20[i];
-		uint8_t s0 = READ_BIT1(dch, n) ? 1U : 0U;
+		symbols[i * 2U + 0U] = READ_BIT1(dch, n) ? 1U : 0U;
 
 		n++;
-		uint8_t s1 = READ_BIT1(dch, n) ? 1U : 0U;
-
-		conv.decode(s0, s1);
+		symbols[i * 2U + 1U] = READ_BIT1(dch, n) ? 1U : 0U;
 	}
 
+	conv.decode(symbols, 180U);
+
 	unsigned char output[23U];
 	conv.chainback(output, 176U);
 
@@ -705,14 +702,14 @@ bool CYSFPayload::processDataFRModeData(unsigned char* data, unsigned char fn, b
 
 	for (unsigned int i = 0U; i < 180U; i++) {
 		unsigned int n = INTERLEAVE_TABLE_9_20[i];
-		uint8_t s0 = READ_BIT1(dch, n) ? 1U : 0U;
+		symbols[i * 2U + 0U] = READ_BIT1(dch, n) ? 1U : 0U;
 
 		n++;
-		uint8_t s1 = READ_BIT1(dch, n) ? 1U : 0U;
-
-		conv.decode(s0, s1);
+		symbols[i * 2U + 1U] = READ_BIT1(dch, n) ? 1U : 0U;
 	}
 
+	conv.decode(symbols, 180U);
+
 	conv.chainback(output, 176U);
 
 	bool ret2 = CCRC::checkCCITT162(output, 22U);
@@ -844,16 +841,17 @@ bool CYSFPayload::processVoiceFRModeData(unsigned char* data)
 	CYSFConvolution conv;
 	conv.start();
 
+	uint8_t symbols[360U];
 	for (unsigned int i = 0U; i < 180U; i++) {
 		unsigned int n = INTERLEAVE_TABLE_9_20[i];
-		uint8_t s0 = READ_BIT1(dch, n) ? 1U : 0U;
+		symbols[i * 2U + 0U] = READ_BIT1(dch, n) ? 1U : 0U;
 
 		n++;
-		uint8_t s1 = READ_BIT1(dch, n) ? 1U : 0U;
-
-		conv.decode(s0, s1);
+		symbols[i * 2U + 1U] = READ_BIT1(dch, n) ? 1U : 0U;
 	}
 
+	conv.decode(symbols, 180U);
+
 	unsigned char output[23U];
 	conv.chainback(output, 176U);
 
@@ -59,6 +59,11 @@ DATABASEURL='https://database.radioid.net/static/user.csv'
 # How many DMR ID files do you want backed up (0 = do not keep backups)
 DMRFILEBACKUP=1
 #
+# Full path to a binary DMR ID file to create with UserDBConvert, or empty for none.
+# Point the File setting in MMDVMHost.ini at it to have it used without parsing.
+DMRIDBINARY=
+# DMRIDBINARY=${DMRIDPATH}/DMRIds.bin
+#
 # Command line to restart MMDVMHost
 RESTARTCOMMAND="systemctl restart mmdvmhost.service"
 # RESTARTCOMMAND="killall MMDVMHost ; /path/to/MMDVMHost/executable/MMDVMHost /path/to/MMDVM/ini/file/MMDVMHost.ini"
@@ -100,6 +105,11 @@ NUMOFLINES=$(wc -l ${DMRIDPATH}/DMRIds.tmp | awk '{print $1}')
 if [ $NUMOFLINES -gt 1 ]
 then
    mv ${DMRIDPATH}/DMRIds.tmp ${DMRIDFILE}
+
+   if [ -n "${DMRIDBINARY}" ]
+   then
+      UserDBConvert ${DMRIDFILE} ${DMRIDBINARY}
+   fi
 else
    echo " ERROR during file update "
    rm ${DMRIDPATH}/DMRIds.tmp